@@ -0,0 +1,67 @@
+//
+//  MTLBenchmark.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The heap allocations made by the process so far.
+typedef struct {
+	uint64_t count;
+	uint64_t bytes;
+} MTLBenchmarkAllocations;
+
+/// Whether heap allocations can be counted on this platform.
+///
+/// Allocations are counted by interposing malloc(), calloc() and realloc(),
+/// which is only supported with glibc.
+BOOL MTLBenchmarkCountsAllocations(void);
+
+/// Returns the heap allocations made by the process so far, or zeroes if
+/// MTLBenchmarkCountsAllocations() is NO.
+MTLBenchmarkAllocations MTLBenchmarkCurrentAllocations(void);
+
+/// Returns the peak resident set size of the process, in bytes.
+uint64_t MTLBenchmarkPeakResidentBytes(void);
+
+/// Aborts the benchmark run if `value` is nil, which means that a fixture
+/// failed to decode or encode.
+void MTLBenchmarkCheck(id _Nullable value, NSString *name);
+
+/// Times benchmarks and prints one JSON object per benchmark to standard
+/// output, like:
+///
+///   {"name":"wide_model.decode","iterations":4096,"ns_per_op":5123.4,
+///    "allocations_per_op":212.0,"bytes_per_op":9104.0,
+///    "peak_rss_bytes":10354688}
+///
+/// "allocations_per_op" and "bytes_per_op" are null if allocations can't be
+/// counted.
+@interface MTLBenchmarkRunner : NSObject
+
+/// Initializes the receiver.
+///
+/// filter          - If not nil, only benchmarks whose names contain this
+///                   string are run.
+/// minimumDuration - How long each benchmark is run for, not including its
+///                   warm up. This must be positive.
+- (instancetype)initWithFilter:(nullable NSString *)filter minimumDuration:(NSTimeInterval)minimumDuration NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Runs `block` repeatedly, each time in its own autorelease pool, and prints
+/// the time and allocations it takes on average.
+///
+/// The block is run once beforehand to warm up any caches, and then in
+/// growing batches until a batch takes at least the minimum duration. Only the
+/// last batch is reported.
+- (void)runBenchmarkNamed:(NSString *)name block:(void (^)(void))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,215 @@
+//
+//  MTLBenchmark.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBenchmark.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#if defined(__GLIBC__) && !defined(MTL_BENCHMARK_DISABLE_ALLOCATION_COUNTING)
+#define MTL_BENCHMARK_COUNTS_ALLOCATIONS 1
+#else
+#define MTL_BENCHMARK_COUNTS_ALLOCATIONS 0
+#endif
+
+#if MTL_BENCHMARK_COUNTS_ALLOCATIONS
+
+// The allocations made by every thread, updated by the interposed allocators
+// below.
+static uint64_t MTLAllocationCount;
+static uint64_t MTLAllocationBytes;
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void *__libc_valloc(size_t size);
+extern void *__libc_pvalloc(size_t size);
+
+static inline void MTLRecordAllocation(size_t size) {
+	__atomic_fetch_add(&MTLAllocationCount, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&MTLAllocationBytes, size, __ATOMIC_RELAXED);
+}
+
+void *malloc(size_t size) {
+	MTLRecordAllocation(size);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+	MTLRecordAllocation(count * size);
+	return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, size_t size) {
+	MTLRecordAllocation(size);
+	return __libc_realloc(pointer, size);
+}
+
+// glibc doesn't export __libc_ variants of posix_memalign() and
+// aligned_alloc(), so they're built on __libc_memalign(), after checking the
+// alignment as glibc does.
+static inline BOOL MTLIsPowerOfTwo(size_t value) {
+	return value != 0 && (value & (value - 1)) == 0;
+}
+
+int posix_memalign(void **pointer, size_t alignment, size_t size) {
+	if (alignment % sizeof(void *) != 0 || !MTLIsPowerOfTwo(alignment)) return EINVAL;
+
+	MTLRecordAllocation(size);
+
+	void *result = __libc_memalign(alignment, size);
+	if (result == NULL) return ENOMEM;
+
+	*pointer = result;
+	return 0;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+	if (!MTLIsPowerOfTwo(alignment)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	MTLRecordAllocation(size);
+	return __libc_memalign(alignment, size);
+}
+
+void *memalign(size_t alignment, size_t size) {
+	MTLRecordAllocation(size);
+	return __libc_memalign(alignment, size);
+}
+
+void *valloc(size_t size) {
+	MTLRecordAllocation(size);
+	return __libc_valloc(size);
+}
+
+void *pvalloc(size_t size) {
+	MTLRecordAllocation(size);
+	return __libc_pvalloc(size);
+}
+
+#endif
+
+BOOL MTLBenchmarkCountsAllocations(void) {
+	return MTL_BENCHMARK_COUNTS_ALLOCATIONS;
+}
+
+MTLBenchmarkAllocations MTLBenchmarkCurrentAllocations(void) {
+	MTLBenchmarkAllocations allocations = { 0, 0 };
+
+#if MTL_BENCHMARK_COUNTS_ALLOCATIONS
+	allocations.count = __atomic_load_n(&MTLAllocationCount, __ATOMIC_RELAXED);
+	allocations.bytes = __atomic_load_n(&MTLAllocationBytes, __ATOMIC_RELAXED);
+#endif
+
+	return allocations;
+}
+
+uint64_t MTLBenchmarkPeakResidentBytes(void) {
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+#ifdef __APPLE__
+	return (uint64_t)usage.ru_maxrss;
+#else
+	// Linux reports kilobytes.
+	return (uint64_t)usage.ru_maxrss * 1024;
+#endif
+}
+
+void MTLBenchmarkCheck(id value, NSString *name) {
+	if (value != nil) return;
+
+	fprintf(stderr, "Benchmark %s produced nil\n", name.UTF8String);
+	exit(EXIT_FAILURE);
+}
+
+static const uint64_t MTLNanosecondsPerSecond = 1000000000;
+
+static uint64_t MTLMonotonicNanoseconds(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * MTLNanosecondsPerSecond + (uint64_t)time.tv_nsec;
+}
+
+@implementation MTLBenchmarkRunner {
+	NSString *_filter;
+	uint64_t _minimumNanoseconds;
+}
+
+- (instancetype)initWithFilter:(NSString *)filter minimumDuration:(NSTimeInterval)minimumDuration {
+	NSParameterAssert(minimumDuration > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_filter = [filter copy];
+	_minimumNanoseconds = (uint64_t)(minimumDuration * MTLNanosecondsPerSecond);
+
+	return self;
+}
+
+- (void)runBenchmarkNamed:(NSString *)name block:(void (^)(void))block {
+	NSParameterAssert(name != nil);
+	NSParameterAssert(block != nil);
+
+	if (_filter != nil && [name rangeOfString:_filter].location == NSNotFound) return;
+
+	@autoreleasepool {
+		block();
+	}
+
+	uint64_t iterations = 1;
+	uint64_t elapsed = 0;
+	MTLBenchmarkAllocations before;
+	MTLBenchmarkAllocations after;
+
+	while (YES) {
+		before = MTLBenchmarkCurrentAllocations();
+		uint64_t start = MTLMonotonicNanoseconds();
+
+		for (uint64_t i = 0; i < iterations; i++) {
+			@autoreleasepool {
+				block();
+			}
+		}
+
+		elapsed = MTLMonotonicNanoseconds() - start;
+		after = MTLBenchmarkCurrentAllocations();
+
+		if (elapsed >= _minimumNanoseconds) break;
+
+		// Aim past the minimum duration, but grow by at most 10x at a time in
+		// case the first batches were dominated by noise.
+		uint64_t estimate = (elapsed > 0 ? iterations * _minimumNanoseconds * 6 / 5 / elapsed : iterations * 10);
+		iterations = MIN(MAX(estimate, iterations * 2), iterations * 10);
+	}
+
+	NSString *allocationsPerOp = @"null";
+	NSString *bytesPerOp = @"null";
+	if (MTLBenchmarkCountsAllocations()) {
+		allocationsPerOp = [NSString stringWithFormat:@"%.1f", (double)(after.count - before.count) / iterations];
+		bytesPerOp = [NSString stringWithFormat:@"%.1f", (double)(after.bytes - before.bytes) / iterations];
+	}
+
+	printf("{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.1f,\"allocations_per_op\":%s,\"bytes_per_op\":%s,\"peak_rss_bytes\":%llu}\n",
+		name.UTF8String,
+		(unsigned long long)iterations,
+		(double)elapsed / iterations,
+		allocationsPerOp.UTF8String,
+		bytesPerOp.UTF8String,
+		(unsigned long long)MTLBenchmarkPeakResidentBytes());
+	fflush(stdout);
+}
+
+@end
@@ -0,0 +1,81 @@
+//
+//  MTLBenchmarkModels.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+
+// A model with 32 properties of every kind the adapter transforms by default.
+@interface MTLBenchmarkWideModel : MTLModel <MTLJSONSerializing>
+
+@property (nonatomic, copy) NSString *string0;
+@property (nonatomic, copy) NSString *string1;
+@property (nonatomic, copy) NSString *string2;
+@property (nonatomic, copy) NSString *string3;
+@property (nonatomic, copy) NSString *string4;
+@property (nonatomic, copy) NSString *string5;
+@property (nonatomic, copy) NSString *string6;
+@property (nonatomic, copy) NSString *string7;
+
+@property (nonatomic, assign) NSInteger integer0;
+@property (nonatomic, assign) NSInteger integer1;
+@property (nonatomic, assign) NSInteger integer2;
+@property (nonatomic, assign) NSInteger integer3;
+@property (nonatomic, assign) NSInteger integer4;
+@property (nonatomic, assign) NSInteger integer5;
+@property (nonatomic, assign) NSInteger integer6;
+@property (nonatomic, assign) NSInteger integer7;
+
+@property (nonatomic, assign) double double0;
+@property (nonatomic, assign) double double1;
+@property (nonatomic, assign) double double2;
+@property (nonatomic, assign) double double3;
+@property (nonatomic, assign) double double4;
+@property (nonatomic, assign) double double5;
+@property (nonatomic, assign) double double6;
+@property (nonatomic, assign) double double7;
+
+@property (nonatomic, assign) BOOL flag0;
+@property (nonatomic, assign) BOOL flag1;
+@property (nonatomic, assign) BOOL flag2;
+@property (nonatomic, assign) BOOL flag3;
+
+// Transformed by +NSURLJSONTransformer.
+@property (nonatomic, copy) NSURL *URL0;
+@property (nonatomic, copy) NSURL *URL1;
+@property (nonatomic, copy) NSURL *URL2;
+@property (nonatomic, copy) NSURL *URL3;
+
+// Returns a JSON dictionary for the model, varied by `seed`.
++ (NSDictionary *)JSONDictionaryWithSeed:(NSUInteger)seed;
+
+@end
+
+// A model whose properties are nested six levels deep in JSON.
+@interface MTLBenchmarkDeepKeyPathModel : MTLModel <MTLJSONSerializing>
+
+// Associated with "a.b.c.d.e.name".
+@property (nonatomic, copy) NSString *name;
+
+// Associated with "a.b.c.d.e.identifier".
+@property (nonatomic, copy) NSNumber *identifier;
+
+// Associated with "a.b.c.d.f.name".
+@property (nonatomic, copy) NSString *siblingName;
+
+// Associated with "a.b.c.g.h.name".
+@property (nonatomic, copy) NSString *cousinName;
+
+// Associated with "a.b.c.g.h.i".
+@property (nonatomic, copy) NSNumber *cousinValue;
+
+// Associated with "x.y.z.name".
+@property (nonatomic, copy) NSString *otherName;
+
+// Returns a JSON dictionary for the model, varied by `seed`.
++ (NSDictionary *)JSONDictionaryWithSeed:(NSUInteger)seed;
+
+@end
@@ -0,0 +1,82 @@
+//
+//  MTLBenchmarkModels.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBenchmarkModels.h"
+
+@implementation MTLBenchmarkWideModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [NSDictionary mtl_identityPropertyMapWithModel:self];
+}
+
++ (NSDictionary *)JSONDictionaryWithSeed:(NSUInteger)seed {
+	NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+
+	for (NSUInteger i = 0; i < 8; i++) {
+		dictionary[[NSString stringWithFormat:@"string%lu", (unsigned long)i]] = [NSString stringWithFormat:@"string %lu of model %lu", (unsigned long)i, (unsigned long)seed];
+		dictionary[[NSString stringWithFormat:@"integer%lu", (unsigned long)i]] = @(seed * 8 + i);
+		dictionary[[NSString stringWithFormat:@"double%lu", (unsigned long)i]] = @((double)seed + i / 8.0);
+	}
+
+	for (NSUInteger i = 0; i < 4; i++) {
+		dictionary[[NSString stringWithFormat:@"flag%lu", (unsigned long)i]] = @((seed + i) % 2 == 0);
+		dictionary[[NSString stringWithFormat:@"URL%lu", (unsigned long)i]] = [NSString stringWithFormat:@"https://example.com/models/%lu/%lu", (unsigned long)seed, (unsigned long)i];
+	}
+
+	return dictionary;
+}
+
+@end
+
+@implementation MTLBenchmarkDeepKeyPathModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"name": @"a.b.c.d.e.name",
+		@"identifier": @"a.b.c.d.e.identifier",
+		@"siblingName": @"a.b.c.d.f.name",
+		@"cousinName": @"a.b.c.g.h.name",
+		@"cousinValue": @"a.b.c.g.h.i",
+		@"otherName": @"x.y.z.name",
+	};
+}
+
++ (NSDictionary *)JSONDictionaryWithSeed:(NSUInteger)seed {
+	return @{
+		@"a": @{
+			@"b": @{
+				@"c": @{
+					@"d": @{
+						@"e": @{
+							@"name": [NSString stringWithFormat:@"name %lu", (unsigned long)seed],
+							@"identifier": @(seed),
+						},
+						@"f": @{
+							@"name": [NSString stringWithFormat:@"sibling %lu", (unsigned long)seed],
+						},
+					},
+					@"g": @{
+						@"h": @{
+							@"name": [NSString stringWithFormat:@"cousin %lu", (unsigned long)seed],
+							@"i": @(seed * 2),
+						},
+					},
+				},
+			},
+		},
+		@"x": @{
+			@"y": @{
+				@"z": @{
+					@"name": [NSString stringWithFormat:@"other %lu", (unsigned long)seed],
+				},
+			},
+		},
+	};
+}
+
+@end
@@ -0,0 +1,21 @@
+//
+//  MTLGNUstepCompatibility.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+// Included before every source file when building with GNUstep, to fill in
+// the parts of Apple's SDK that Mantle relies on.
+
+#import <Foundation/Foundation.h>
+
+// Apple's Foundation imports CoreFoundation, but GNUstep's doesn't.
+#if __has_include(<CoreFoundation/CoreFoundation.h>)
+#import <CoreFoundation/CoreFoundation.h>
+#endif
+
+#ifndef NS_SWIFT_UNAVAILABLE
+#define NS_SWIFT_UNAVAILABLE(msg)
+#endif
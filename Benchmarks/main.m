@@ -0,0 +1,290 @@
+//
+//  main.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+
+#import "MTLBenchmark.h"
+#import "MTLBenchmarkModels.h"
+#import "MTLTestModel.h"
+
+static void MTLRunWideModelBenchmarks(MTLBenchmarkRunner *runner) {
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLBenchmarkWideModel.class];
+	NSDictionary *JSONDictionary = [MTLBenchmarkWideModel JSONDictionaryWithSeed:1];
+	MTLBenchmarkWideModel *model = [adapter modelFromJSONDictionary:JSONDictionary error:NULL];
+	MTLBenchmarkWideModel *equalModel = [adapter modelFromJSONDictionary:JSONDictionary error:NULL];
+	MTLBenchmarkCheck(model, @"wide_model");
+
+	[runner runBenchmarkNamed:@"wide_model.decode" block:^{
+		MTLBenchmarkCheck([adapter modelFromJSONDictionary:JSONDictionary error:NULL], @"wide_model.decode");
+	}];
+
+	[runner runBenchmarkNamed:@"wide_model.encode" block:^{
+		MTLBenchmarkCheck([adapter JSONDictionaryFromModel:model error:NULL], @"wide_model.encode");
+	}];
+
+	[runner runBenchmarkNamed:@"wide_model.copy" block:^{
+		MTLBenchmarkCheck([model copy], @"wide_model.copy");
+	}];
+
+	[runner runBenchmarkNamed:@"wide_model.is_equal" block:^{
+		if (![model isEqual:equalModel]) MTLBenchmarkCheck(nil, @"wide_model.is_equal");
+	}];
+
+	[runner runBenchmarkNamed:@"wide_model.hash" block:^{
+		(void)model.hash;
+	}];
+}
+
+static void MTLRunDeepKeyPathBenchmarks(MTLBenchmarkRunner *runner) {
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLBenchmarkDeepKeyPathModel.class];
+	NSDictionary *JSONDictionary = [MTLBenchmarkDeepKeyPathModel JSONDictionaryWithSeed:1];
+	MTLBenchmarkDeepKeyPathModel *model = [adapter modelFromJSONDictionary:JSONDictionary error:NULL];
+	MTLBenchmarkCheck(model, @"deep_key_paths");
+
+	[runner runBenchmarkNamed:@"deep_key_paths.decode" block:^{
+		MTLBenchmarkCheck([adapter modelFromJSONDictionary:JSONDictionary error:NULL], @"deep_key_paths.decode");
+	}];
+
+	[runner runBenchmarkNamed:@"deep_key_paths.encode" block:^{
+		MTLBenchmarkCheck([adapter JSONDictionaryFromModel:model error:NULL], @"deep_key_paths.encode");
+	}];
+}
+
+static void MTLRunLargeArrayBenchmarks(MTLBenchmarkRunner *runner) {
+	NSMutableArray *JSONArray = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 1000; i++) {
+		[JSONArray addObject:@{
+			@"username": [NSString stringWithFormat:@"user%lu", (unsigned long)i],
+			@"count": [NSString stringWithFormat:@"%lu", (unsigned long)i],
+			@"nested": @{ @"name": [NSString stringWithFormat:@"nested %lu", (unsigned long)i] },
+		}];
+	}
+
+	NSArray *models = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL];
+	MTLBenchmarkCheck(models, @"large_array");
+
+	[runner runBenchmarkNamed:@"large_array.decode" block:^{
+		MTLBenchmarkCheck([MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL], @"large_array.decode");
+	}];
+
+	[runner runBenchmarkNamed:@"large_array.encode" block:^{
+		MTLBenchmarkCheck([MTLJSONAdapter JSONArrayFromModels:models error:NULL], @"large_array.encode");
+	}];
+
+	[runner runBenchmarkNamed:@"large_array.memory_usage" block:^{
+		MTLBenchmarkCheck([MTLModelMemoryUsage memoryUsageOfObjects:models], @"large_array.memory_usage");
+	}];
+}
+
+static void MTLRunClassClusterBenchmarks(MTLBenchmarkRunner *runner) {
+	NSMutableArray *JSONArray = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 100; i++) {
+		if (i % 2 == 0) {
+			[JSONArray addObject:@{ @"flavor": @"chocolate", @"chocolate_bitterness": [NSString stringWithFormat:@"%lu", (unsigned long)i] }];
+		} else {
+			[JSONArray addObject:@{ @"flavor": @"strawberry", @"strawberry_freshness": @(i) }];
+		}
+	}
+
+	NSArray *models = [MTLJSONAdapter modelsOfClass:MTLClassClusterModel.class fromJSONArray:JSONArray error:NULL];
+	MTLBenchmarkCheck(models, @"class_cluster");
+
+	[runner runBenchmarkNamed:@"class_cluster.decode" block:^{
+		MTLBenchmarkCheck([MTLJSONAdapter modelsOfClass:MTLClassClusterModel.class fromJSONArray:JSONArray error:NULL], @"class_cluster.decode");
+	}];
+
+	[runner runBenchmarkNamed:@"class_cluster.encode" block:^{
+		MTLBenchmarkCheck([MTLJSONAdapter JSONArrayFromModels:models error:NULL], @"class_cluster.encode");
+	}];
+}
+
+static void MTLRunRecursiveModelBenchmarks(MTLBenchmarkRunner *runner) {
+	NSDictionary * (^user)(NSString *, NSArray *) = ^(NSString *name, NSArray *groups) {
+		return @{ @"name": name, @"groups": groups };
+	};
+
+	// A user in 8 groups, each with an owner and 16 members, each of whom is
+	// in a group of their own.
+	NSMutableArray *groups = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 8; i++) {
+		NSMutableArray *users = [NSMutableArray array];
+		for (NSUInteger j = 0; j < 16; j++) {
+			NSString *name = [NSString stringWithFormat:@"member %lu.%lu", (unsigned long)i, (unsigned long)j];
+			NSDictionary *ownGroup = @{ @"owner": user(name, @[]), @"users": @[] };
+
+			[users addObject:user(name, @[ ownGroup ])];
+		}
+
+		[groups addObject:@{
+			@"owner": user([NSString stringWithFormat:@"owner %lu", (unsigned long)i], @[]),
+			@"users": users,
+		}];
+	}
+
+	NSDictionary *JSONDictionary = user(@"root", groups);
+
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveUserModel.class];
+	MTLRecursiveUserModel *model = [adapter modelFromJSONDictionary:JSONDictionary error:NULL];
+	MTLBenchmarkCheck(model, @"recursive_model");
+
+	[runner runBenchmarkNamed:@"recursive_model.decode" block:^{
+		MTLBenchmarkCheck([adapter modelFromJSONDictionary:JSONDictionary error:NULL], @"recursive_model.decode");
+	}];
+
+	[runner runBenchmarkNamed:@"recursive_model.encode" block:^{
+		MTLBenchmarkCheck([adapter JSONDictionaryFromModel:model error:NULL], @"recursive_model.encode");
+	}];
+
+	[runner runBenchmarkNamed:@"recursive_model.memory_usage" block:^{
+		MTLBenchmarkCheck(model.memoryUsage, @"recursive_model.memory_usage");
+	}];
+}
+
+static void MTLRunCodingBenchmarks(MTLBenchmarkRunner *runner) {
+	MTLTestModel *model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @5, @"nestedName": @"bar" } error:NULL];
+	MTLBenchmarkWideModel *wideModel = [MTLJSONAdapter modelOfClass:MTLBenchmarkWideModel.class fromJSONDictionary:[MTLBenchmarkWideModel JSONDictionaryWithSeed:1] error:NULL];
+	MTLBenchmarkCheck(wideModel, @"nscoding");
+
+	[runner runBenchmarkNamed:@"nscoding.round_trip" block:^{
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:model];
+		MTLBenchmarkCheck([NSKeyedUnarchiver unarchiveObjectWithData:data], @"nscoding.round_trip");
+	}];
+
+	[runner runBenchmarkNamed:@"nscoding.wide_model_round_trip" block:^{
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:wideModel];
+		MTLBenchmarkCheck([NSKeyedUnarchiver unarchiveObjectWithData:data], @"nscoding.wide_model_round_trip");
+	}];
+}
+
+static void MTLRunTransformerBenchmarks(MTLBenchmarkRunner *runner) {
+	NSValueTransformer *URLTransformer = [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+	[runner runBenchmarkNamed:@"transformer.url" block:^{
+		MTLBenchmarkCheck([URLTransformer transformedValue:@"https://example.com/path?query=value"], @"transformer.url");
+	}];
+
+	NSValueTransformer *booleanTransformer = [NSValueTransformer valueTransformerForName:MTLBooleanValueTransformerName];
+	[runner runBenchmarkNamed:@"transformer.boolean" block:^{
+		MTLBenchmarkCheck([booleanTransformer transformedValue:@YES], @"transformer.boolean");
+	}];
+
+	NSMutableData *data = [NSMutableData dataWithLength:4096];
+	uint8_t *bytes = data.mutableBytes;
+	for (NSUInteger i = 0; i < data.length; i++) {
+		bytes[i] = (uint8_t)(i * 31);
+	}
+
+	NSValueTransformer *base64Transformer = [NSValueTransformer valueTransformerForName:MTLBase64DataValueTransformerName];
+	NSString *base64String = [base64Transformer reverseTransformedValue:data];
+	[runner runBenchmarkNamed:@"transformer.base64_decode" block:^{
+		MTLBenchmarkCheck([base64Transformer transformedValue:base64String], @"transformer.base64_decode");
+	}];
+
+	[runner runBenchmarkNamed:@"transformer.base64_encode" block:^{
+		MTLBenchmarkCheck([base64Transformer reverseTransformedValue:data], @"transformer.base64_encode");
+	}];
+
+	NSValueTransformer *hexTransformer = [NSValueTransformer valueTransformerForName:MTLHexDataValueTransformerName];
+	NSString *hexString = [hexTransformer reverseTransformedValue:data];
+	[runner runBenchmarkNamed:@"transformer.hex_decode" block:^{
+		MTLBenchmarkCheck([hexTransformer transformedValue:hexString], @"transformer.hex_decode");
+	}];
+
+	// A multi-megabyte payload, compared against the equivalent Foundation APIs.
+	NSMutableData *largeData = [NSMutableData dataWithLength:4 * 1024 * 1024];
+	uint8_t *largeBytes = largeData.mutableBytes;
+	for (NSUInteger i = 0; i < largeData.length; i++) {
+		largeBytes[i] = (uint8_t)(i * 31 + (i >> 8));
+	}
+
+	NSString *largeBase64String = [base64Transformer reverseTransformedValue:largeData];
+	NSString *largeHexString = [hexTransformer reverseTransformedValue:largeData];
+
+	[runner runBenchmarkNamed:@"transformer.base64_encode_4mb" block:^{
+		MTLBenchmarkCheck([base64Transformer reverseTransformedValue:largeData], @"transformer.base64_encode_4mb");
+	}];
+
+	[runner runBenchmarkNamed:@"foundation.base64_encode_4mb" block:^{
+		MTLBenchmarkCheck([largeData base64EncodedStringWithOptions:0], @"foundation.base64_encode_4mb");
+	}];
+
+	[runner runBenchmarkNamed:@"transformer.base64_decode_4mb" block:^{
+		MTLBenchmarkCheck([base64Transformer transformedValue:largeBase64String], @"transformer.base64_decode_4mb");
+	}];
+
+	[runner runBenchmarkNamed:@"foundation.base64_decode_4mb" block:^{
+		MTLBenchmarkCheck([[NSData alloc] initWithBase64EncodedString:largeBase64String options:0], @"foundation.base64_decode_4mb");
+	}];
+
+	[runner runBenchmarkNamed:@"transformer.hex_encode_4mb" block:^{
+		MTLBenchmarkCheck([hexTransformer reverseTransformedValue:largeData], @"transformer.hex_encode_4mb");
+	}];
+
+	[runner runBenchmarkNamed:@"transformer.hex_decode_4mb" block:^{
+		MTLBenchmarkCheck([hexTransformer transformedValue:largeHexString], @"transformer.hex_decode_4mb");
+	}];
+
+	NSValueTransformer *valueMappingTransformer = [NSValueTransformer mtl_valueMappingTransformerWithDictionary:@{
+		@"pending": @0,
+		@"active": @1,
+		@"suspended": @2,
+		@"closed": @3,
+	}];
+
+	[runner runBenchmarkNamed:@"transformer.value_mapping" block:^{
+		MTLBenchmarkCheck([valueMappingTransformer transformedValue:@"suspended"], @"transformer.value_mapping");
+	}];
+
+	NSMutableArray *URLStrings = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 100; i++) {
+		[URLStrings addObject:[NSString stringWithFormat:@"https://example.com/items/%lu", (unsigned long)i]];
+	}
+
+	NSValueTransformer *arrayMappingTransformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:URLTransformer];
+	[runner runBenchmarkNamed:@"transformer.array_mapping" block:^{
+		MTLBenchmarkCheck([arrayMappingTransformer transformedValue:URLStrings], @"transformer.array_mapping");
+	}];
+}
+
+static void MTLPrintUsage(const char *program) {
+	fprintf(stderr, "usage: %s [--filter <substring>] [--min-time-ms <milliseconds>]\n", program);
+}
+
+int main(int argc, const char *argv[]) {
+	@autoreleasepool {
+		NSString *filter = nil;
+		NSTimeInterval minimumDuration = 0.5;
+
+		for (int i = 1; i < argc; i++) {
+			if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+				filter = @(argv[++i]);
+			} else if (strcmp(argv[i], "--min-time-ms") == 0 && i + 1 < argc) {
+				minimumDuration = atof(argv[++i]) / 1000;
+			} else {
+				MTLPrintUsage(argv[0]);
+				return EXIT_FAILURE;
+			}
+		}
+
+		if (minimumDuration <= 0) {
+			MTLPrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+
+		MTLBenchmarkRunner *runner = [[MTLBenchmarkRunner alloc] initWithFilter:filter minimumDuration:minimumDuration];
+
+		MTLRunWideModelBenchmarks(runner);
+		MTLRunDeepKeyPathBenchmarks(runner);
+		MTLRunLargeArrayBenchmarks(runner);
+		MTLRunClassClusterBenchmarks(runner);
+		MTLRunRecursiveModelBenchmarks(runner);
+		MTLRunCodingBenchmarks(runner);
+		MTLRunTransformerBenchmarks(runner);
+	}
+
+	return EXIT_SUCCESS;
+}
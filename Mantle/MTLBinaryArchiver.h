@@ -0,0 +1,97 @@
+//
+//  MTLBinaryArchiver.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The domain for errors originating from MTLBinaryArchiver and
+/// MTLBinaryUnarchiver.
+extern NSString * const MTLBinaryArchiverErrorDomain;
+
+/// The archive is malformed, truncated or followed by trailing bytes.
+extern const NSInteger MTLBinaryArchiverErrorInvalidArchive;
+
+/// An object in the graph could not be archived, either because it does not
+/// support <NSSecureCoding>, or because it (strongly) refers back to itself.
+extern const NSInteger MTLBinaryArchiverErrorUnsupportedValue;
+
+/// An archived object was not of one of the classes allowed at its position.
+extern const NSInteger MTLBinaryArchiverErrorDisallowedClass;
+
+/// A model's -initWithCoder: returned nil, e.g. because it was archived by a
+/// newer +modelVersion.
+extern const NSInteger MTLBinaryArchiverErrorModelInitialization;
+
+/// Archives MTLModel object graphs into a compact binary format.
+///
+/// This is a faster, smaller alternative to NSKeyedArchiver for models. Every
+/// model class is described once per archive by a schema listing its keys, and
+/// each encoded value is tagged with the index of its key instead of the key
+/// itself. Numbers are written as variable-length integers or raw doubles, and
+/// models which appear more than once are written once and referenced
+/// afterwards.
+///
+/// Models are archived through their usual -encodeWithCoder:, so
+/// +encodingBehaviorsByPropertyKey and +modelVersion are honored. Strings,
+/// numbers, data, dates, URLs, NSNull and the standard collections are written
+/// natively, while any other object supporting <NSSecureCoding> is embedded
+/// as a keyed archive.
+///
+/// Conditionally encoded objects are kept only if they were archived
+/// unconditionally earlier in the archive.
+@interface MTLBinaryArchiver : NSCoder
+
+/// Archives an object graph.
+///
+/// rootObject - The root of the object graph. This argument must not be nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              archiving.
+///
+/// Returns the archived data, or nil if an error occurred.
++ (nullable NSData *)archivedDataWithRootObject:(id)rootObject error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// Unarchives object graphs created by MTLBinaryArchiver.
+///
+/// Unarchiving always requires secure coding. Models are created through
+/// their usual -initWithCoder:, so +allowedSecureCodingClassesByPropertyKey
+/// restricts the classes found under each key, and
+/// -decodeValueForKey:withCoder:modelVersion: can be used to migrate archives
+/// of older model versions. Values decoded with -decodeObjectForKey: may
+/// additionally be property list objects, URLs or NSNull.
+@interface MTLBinaryUnarchiver : NSCoder
+
+/// Unarchives an object graph.
+///
+/// classes - The classes that the root object may be an instance of. Objects
+///           within collections must be instances of these classes as well.
+///           This argument must not be nil.
+/// data    - An archive created by +[MTLBinaryArchiver
+///           archivedDataWithRootObject:error:]. This argument must not be nil.
+/// error   - If not NULL, this may be set to an error that occurs during
+///           unarchiving.
+///
+/// Returns the root object, or nil if an error occurred.
++ (nullable id)unarchivedObjectOfClasses:(NSSet<Class> *)classes fromData:(NSData *)data error:(NSError **)error;
+
+/// Unarchives an object graph whose root object is an instance of a single
+/// class.
+///
+/// This is equivalent to calling +unarchivedObjectOfClasses:fromData:error:
+/// with a set containing only `cls`.
++ (nullable id)unarchivedObjectOfClass:(Class)cls fromData:(NSData *)data error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,1126 @@
+//
+//  MTLBinaryArchiver.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLBinaryArchiver.h"
+#import "MTLModel.h"
+
+NSString * const MTLBinaryArchiverErrorDomain = @"MTLBinaryArchiverErrorDomain";
+const NSInteger MTLBinaryArchiverErrorInvalidArchive = 1;
+const NSInteger MTLBinaryArchiverErrorUnsupportedValue = 2;
+const NSInteger MTLBinaryArchiverErrorDisallowedClass = 3;
+const NSInteger MTLBinaryArchiverErrorModelInitialization = 4;
+
+// Archives start with these bytes, followed by the format version.
+static const uint8_t MTLBinaryArchiveMagic[4] = { 'M', 'T', 'L', 'B' };
+static const uint8_t MTLBinaryArchiveFormatVersion = 1;
+
+// Deeper object graphs are considered malformed, to bound the recursion of the
+// unarchiver.
+static const NSUInteger MTLBinaryArchiveMaximumDepth = 512;
+
+// The key +[NSKeyedArchiver archivedDataWithRootObject:] stores the root object
+// under. NSKeyedArchiveRootObjectKey is only available from iOS 9 and OS X
+// 10.11.
+static NSString * const MTLKeyedArchiveRootObjectKey = @"root";
+
+// Precedes every value in an archive.
+typedef NS_ENUM(uint8_t, MTLBinaryArchiveTag) {
+	MTLBinaryArchiveTagNil = 0,
+	MTLBinaryArchiveTagNull,
+	MTLBinaryArchiveTagFalse,
+	MTLBinaryArchiveTagTrue,
+
+	// Followed by a zigzag-encoded varint.
+	MTLBinaryArchiveTagInteger,
+
+	// Followed by a varint, for values which don't fit into an int64_t.
+	MTLBinaryArchiveTagUnsignedInteger,
+
+	// Followed by 8 little-endian bytes.
+	MTLBinaryArchiveTagDouble,
+
+	// Followed by a varint length and that many bytes of UTF-8.
+	MTLBinaryArchiveTagString,
+
+	// Followed by a varint length and that many bytes.
+	MTLBinaryArchiveTagData,
+
+	// Followed by the time interval since the reference date, as a double.
+	MTLBinaryArchiveTagDate,
+
+	// Followed by the absolute string of the URL, as a string.
+	MTLBinaryArchiveTagURL,
+
+	// Followed by a varint count and that many values.
+	MTLBinaryArchiveTagArray,
+	MTLBinaryArchiveTagSet,
+
+	// Followed by a varint count and that many key/value pairs.
+	MTLBinaryArchiveTagDictionary,
+
+	// Followed by a varint schema index and the model's fields. Each field is
+	// the varint index of its key within the schema plus one, followed by its
+	// value. A zero byte ends the fields.
+	MTLBinaryArchiveTagModel,
+
+	// Followed by the varint offset of a model tag earlier in the archive.
+	MTLBinaryArchiveTagReference,
+
+	// Followed by the length and bytes of an NSKeyedArchiver archive.
+	MTLBinaryArchiveTagKeyedArchive,
+};
+
+#pragma mark Writing
+
+static void MTLBinaryArchiveAppendVarint(NSMutableData *data, uint64_t value) {
+	uint8_t buffer[10];
+	size_t length = 0;
+
+	do {
+		uint8_t byte = value & 0x7F;
+		value >>= 7;
+		if (value != 0) byte |= 0x80;
+
+		buffer[length++] = byte;
+	} while (value != 0);
+
+	[data appendBytes:buffer length:length];
+}
+
+static void MTLBinaryArchiveAppendTag(NSMutableData *data, MTLBinaryArchiveTag tag) {
+	[data appendBytes:&tag length:1];
+}
+
+static void MTLBinaryArchiveAppendDouble(NSMutableData *data, double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	bits = CFSwapInt64HostToLittle(bits);
+
+	[data appendBytes:&bits length:sizeof(bits)];
+}
+
+static void MTLBinaryArchiveAppendString(NSMutableData *data, NSString *string) {
+	NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+	MTLBinaryArchiveAppendVarint(data, length);
+
+	NSUInteger start = data.length;
+	data.length += length;
+
+	[string getBytes:(uint8_t *)data.mutableBytes + start maxLength:length usedLength:NULL encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, string.length) remainingRange:NULL];
+}
+
+#pragma mark Reading
+
+typedef struct {
+	const uint8_t *bytes;
+	NSUInteger length;
+	NSUInteger position;
+} MTLBinaryArchiveReader;
+
+static BOOL MTLBinaryArchiveReadVarint(MTLBinaryArchiveReader *reader, uint64_t *value) {
+	uint64_t result = 0;
+
+	for (unsigned shift = 0; shift < 64; shift += 7) {
+		if (reader->position >= reader->length) return NO;
+
+		uint8_t byte = reader->bytes[reader->position++];
+		result |= (uint64_t)(byte & 0x7F) << shift;
+
+		if ((byte & 0x80) == 0) {
+			*value = result;
+			return YES;
+		}
+	}
+
+	return NO;
+}
+
+// Reads a varint which is used as a length or count of at least one byte per
+// element, and therefore cannot exceed the remaining length of the archive.
+static BOOL MTLBinaryArchiveReadCount(MTLBinaryArchiveReader *reader, NSUInteger *count) {
+	uint64_t value = 0;
+	if (!MTLBinaryArchiveReadVarint(reader, &value)) return NO;
+	if (value > reader->length - reader->position) return NO;
+
+	*count = (NSUInteger)value;
+	return YES;
+}
+
+static BOOL MTLBinaryArchiveReadBytes(MTLBinaryArchiveReader *reader, NSUInteger length, const uint8_t **bytes) {
+	if (length > reader->length - reader->position) return NO;
+
+	*bytes = reader->bytes + reader->position;
+	reader->position += length;
+	return YES;
+}
+
+static BOOL MTLBinaryArchiveReadDouble(MTLBinaryArchiveReader *reader, double *value) {
+	const uint8_t *bytes = NULL;
+	if (!MTLBinaryArchiveReadBytes(reader, sizeof(uint64_t), &bytes)) return NO;
+
+	uint64_t bits;
+	memcpy(&bits, bytes, sizeof(bits));
+	bits = CFSwapInt64LittleToHost(bits);
+	memcpy(value, &bits, sizeof(bits));
+
+	return YES;
+}
+
+static NSString *MTLBinaryArchiveReadString(MTLBinaryArchiveReader *reader) {
+	NSUInteger length = 0;
+	const uint8_t *bytes = NULL;
+	if (!MTLBinaryArchiveReadCount(reader, &length) || !MTLBinaryArchiveReadBytes(reader, length, &bytes)) return nil;
+
+	return [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+}
+
+// Advances past the value at the current position of `reader`.
+//
+// Returns whether the value was well-formed.
+static BOOL MTLBinaryArchiveSkipValue(MTLBinaryArchiveReader *reader, NSUInteger depth) {
+	if (depth > MTLBinaryArchiveMaximumDepth || reader->position >= reader->length) return NO;
+
+	uint64_t varint = 0;
+	NSUInteger count = 0;
+	const uint8_t *bytes = NULL;
+
+	switch ((MTLBinaryArchiveTag)reader->bytes[reader->position++]) {
+		case MTLBinaryArchiveTagNil:
+		case MTLBinaryArchiveTagNull:
+		case MTLBinaryArchiveTagFalse:
+		case MTLBinaryArchiveTagTrue:
+			return YES;
+
+		case MTLBinaryArchiveTagInteger:
+		case MTLBinaryArchiveTagUnsignedInteger:
+		case MTLBinaryArchiveTagReference:
+			return MTLBinaryArchiveReadVarint(reader, &varint);
+
+		case MTLBinaryArchiveTagDouble:
+		case MTLBinaryArchiveTagDate:
+			return MTLBinaryArchiveReadBytes(reader, sizeof(uint64_t), &bytes);
+
+		case MTLBinaryArchiveTagString:
+		case MTLBinaryArchiveTagData:
+		case MTLBinaryArchiveTagURL:
+		case MTLBinaryArchiveTagKeyedArchive:
+			return MTLBinaryArchiveReadCount(reader, &count) && MTLBinaryArchiveReadBytes(reader, count, &bytes);
+
+		case MTLBinaryArchiveTagArray:
+		case MTLBinaryArchiveTagSet:
+			if (!MTLBinaryArchiveReadCount(reader, &count)) return NO;
+
+			for (NSUInteger i = 0; i < count; i++) {
+				if (!MTLBinaryArchiveSkipValue(reader, depth + 1)) return NO;
+			}
+
+			return YES;
+
+		case MTLBinaryArchiveTagDictionary:
+			if (!MTLBinaryArchiveReadCount(reader, &count)) return NO;
+
+			for (NSUInteger i = 0; i < count; i++) {
+				if (!MTLBinaryArchiveSkipValue(reader, depth + 1)) return NO;
+				if (!MTLBinaryArchiveSkipValue(reader, depth + 1)) return NO;
+			}
+
+			return YES;
+
+		case MTLBinaryArchiveTagModel:
+			if (!MTLBinaryArchiveReadVarint(reader, &varint)) return NO;
+
+			while (YES) {
+				if (!MTLBinaryArchiveReadVarint(reader, &varint)) return NO;
+				if (varint == 0) return YES;
+
+				if (!MTLBinaryArchiveSkipValue(reader, depth + 1)) return NO;
+			}
+	}
+
+	return NO;
+}
+
+#pragma mark Schemas
+
+// Describes the keys a model class encodes within one archive.
+@interface MTLBinaryArchiveSchema : NSObject
+
+// The name of the model class.
+@property (nonatomic, copy, readonly) NSString *className;
+
+// The position of the receiver within the archive's schemas.
+@property (nonatomic, assign) NSUInteger schemaIndex;
+
+// The class named by `className`, or Nil if it doesn't exist.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+// The encoded keys, in the order they were first encountered.
+@property (nonatomic, strong, readonly) NSMutableArray<NSString *> *keys;
+
+// Maps each element of `keys` to its index.
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSNumber *> *indexesByKey;
+
+- (instancetype)initWithClassName:(NSString *)className;
+
+// Returns the index of `key`, adding it to the schema if necessary.
+- (NSUInteger)indexOfKey:(NSString *)key;
+
+@end
+
+@implementation MTLBinaryArchiveSchema
+
+- (instancetype)initWithClassName:(NSString *)className {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_className = [className copy];
+	_modelClass = NSClassFromString(className);
+	_keys = [[NSMutableArray alloc] init];
+	_indexesByKey = [[NSMutableDictionary alloc] init];
+
+	return self;
+}
+
+- (NSUInteger)indexOfKey:(NSString *)key {
+	NSNumber *index = self.indexesByKey[key];
+	if (index != nil) return index.unsignedIntegerValue;
+
+	NSUInteger newIndex = self.keys.count;
+	[self.keys addObject:key];
+	self.indexesByKey[key] = @(newIndex);
+
+	return newIndex;
+}
+
+@end
+
+#pragma mark Errors
+
+static NSError *MTLBinaryArchiverError(NSInteger code, NSString *description, NSString *failureReason) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: description,
+		NSLocalizedFailureReasonErrorKey: failureReason
+	};
+
+	return [NSError errorWithDomain:MTLBinaryArchiverErrorDomain code:code userInfo:userInfo];
+}
+
+#pragma mark - MTLBinaryArchiver
+
+@implementation MTLBinaryArchiver {
+	// The encoded root object. Schemas are written in front of it once
+	// archiving has finished.
+	NSMutableData *_body;
+
+	NSMutableArray<MTLBinaryArchiveSchema *> *_schemas;
+	NSMapTable *_schemasByClass;
+
+	// Maps models which have been encoded completely to the offset of their
+	// tag within `_body`.
+	NSMapTable *_offsetsByModel;
+
+	// The models whose fields are being encoded.
+	NSHashTable *_modelsInProgress;
+
+	// The schema of the innermost model being encoded.
+	MTLBinaryArchiveSchema *_currentSchema;
+
+	// The first error that occurred.
+	NSError *_error;
+}
+
+#pragma mark Lifecycle
+
++ (NSData *)archivedDataWithRootObject:(id)rootObject error:(NSError **)error {
+	NSParameterAssert(rootObject != nil);
+
+	MTLBinaryArchiver *archiver = [[self alloc] initForWriting];
+	[archiver writeValue:rootObject];
+
+	if (archiver->_error != nil) {
+		if (error != NULL) *error = archiver->_error;
+		return nil;
+	}
+
+	return [archiver archivedData];
+}
+
+- (instancetype)initForWriting {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_body = [[NSMutableData alloc] init];
+	_schemas = [[NSMutableArray alloc] init];
+	_schemasByClass = [NSMapTable strongToStrongObjectsMapTable];
+	_offsetsByModel = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+	_modelsInProgress = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+
+	return self;
+}
+
+- (NSData *)archivedData {
+	NSMutableData *data = [[NSMutableData alloc] initWithCapacity:_body.length + 64 * _schemas.count];
+	[data appendBytes:MTLBinaryArchiveMagic length:sizeof(MTLBinaryArchiveMagic)];
+	[data appendBytes:&MTLBinaryArchiveFormatVersion length:1];
+
+	MTLBinaryArchiveAppendVarint(data, _schemas.count);
+	for (MTLBinaryArchiveSchema *schema in _schemas) {
+		MTLBinaryArchiveAppendString(data, schema.className);
+		MTLBinaryArchiveAppendVarint(data, schema.keys.count);
+
+		for (NSString *key in schema.keys) {
+			MTLBinaryArchiveAppendString(data, key);
+		}
+	}
+
+	[data appendData:_body];
+	return data;
+}
+
+#pragma mark Encoding
+
+- (void)failWithReason:(NSString *)failureReason {
+	if (_error != nil) return;
+
+	_error = MTLBinaryArchiverError(MTLBinaryArchiverErrorUnsupportedValue, NSLocalizedString(@"Could not archive object", @""), failureReason);
+}
+
+- (void)writeValue:(id)value {
+	if (_error != nil) return;
+
+	if (value == nil) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagNil);
+	} else if (value == NSNull.null) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagNull);
+	} else if ([value isKindOfClass:NSString.class]) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagString);
+		MTLBinaryArchiveAppendString(_body, value);
+	} else if ([value isKindOfClass:NSNumber.class] && ![value isKindOfClass:NSDecimalNumber.class]) {
+		[self writeNumber:value];
+	} else if ([value isKindOfClass:NSData.class]) {
+		NSData *data = value;
+
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagData);
+		MTLBinaryArchiveAppendVarint(_body, data.length);
+		[_body appendData:data];
+	} else if ([value isKindOfClass:NSDate.class]) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagDate);
+		MTLBinaryArchiveAppendDouble(_body, [value timeIntervalSinceReferenceDate]);
+	} else if ([value isKindOfClass:NSURL.class]) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagURL);
+		MTLBinaryArchiveAppendString(_body, [value absoluteString]);
+	} else if ([value isKindOfClass:NSArray.class] || [value isKindOfClass:NSSet.class]) {
+		MTLBinaryArchiveAppendTag(_body, [value isKindOfClass:NSArray.class] ? MTLBinaryArchiveTagArray : MTLBinaryArchiveTagSet);
+		MTLBinaryArchiveAppendVarint(_body, [value count]);
+
+		for (id element in value) {
+			[self writeValue:element];
+		}
+	} else if ([value isKindOfClass:NSDictionary.class]) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagDictionary);
+		MTLBinaryArchiveAppendVarint(_body, [value count]);
+
+		[value enumerateKeysAndObjectsUsingBlock:^(id key, id object, BOOL *stop) {
+			[self writeValue:key];
+			[self writeValue:object];
+		}];
+	} else if ([value isKindOfClass:MTLModel.class]) {
+		[self writeModel:value];
+	} else if ([value conformsToProtocol:@protocol(NSSecureCoding)] && [[value class] supportsSecureCoding]) {
+		// Keyed archives are always unarchived securely, so anything within
+		// them which doesn't support secure coding couldn't be read back.
+		NSMutableData *data = [NSMutableData data];
+		NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initForWritingWithMutableData:data];
+		archiver.requiresSecureCoding = YES;
+
+		@try {
+			[archiver encodeObject:value forKey:MTLKeyedArchiveRootObjectKey];
+			[archiver finishEncoding];
+		} @catch (NSException *ex) {
+			[self failWithReason:ex.reason ?: ex.name];
+			return;
+		}
+
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagKeyedArchive);
+		MTLBinaryArchiveAppendVarint(_body, data.length);
+		[_body appendData:data];
+	} else {
+		[self failWithReason:[NSString stringWithFormat:NSLocalizedString(@"%@ does not support NSSecureCoding.", @""), value]];
+	}
+}
+
+- (void)writeNumber:(NSNumber *)number {
+	CFNumberRef numberRef = (__bridge CFNumberRef)number;
+
+	if (numberRef == (CFNumberRef)kCFBooleanTrue) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagTrue);
+	} else if (numberRef == (CFNumberRef)kCFBooleanFalse) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagFalse);
+	} else if (CFNumberIsFloatType(numberRef)) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagDouble);
+		MTLBinaryArchiveAppendDouble(_body, number.doubleValue);
+	} else if (*number.objCType == *@encode(unsigned long long) && number.unsignedLongLongValue > INT64_MAX) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagUnsignedInteger);
+		MTLBinaryArchiveAppendVarint(_body, number.unsignedLongLongValue);
+	} else {
+		int64_t value = number.longLongValue;
+
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagInteger);
+		MTLBinaryArchiveAppendVarint(_body, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+	}
+}
+
+- (void)writeModel:(MTLModel *)model {
+	NSNumber *offset = [_offsetsByModel objectForKey:model];
+	if (offset != nil) {
+		MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagReference);
+		MTLBinaryArchiveAppendVarint(_body, offset.unsignedIntegerValue);
+		return;
+	}
+
+	if ([_modelsInProgress containsObject:model]) {
+		[self failWithReason:[NSString stringWithFormat:NSLocalizedString(@"%@ contains a strong reference to itself.", @""), model]];
+		return;
+	}
+
+	MTLBinaryArchiveSchema *schema = [_schemasByClass objectForKey:model.class];
+	if (schema == nil) {
+		schema = [[MTLBinaryArchiveSchema alloc] initWithClassName:NSStringFromClass(model.class)];
+		schema.schemaIndex = _schemas.count;
+
+		[_schemasByClass setObject:schema forKey:model.class];
+		[_schemas addObject:schema];
+	}
+
+	NSUInteger start = _body.length;
+	MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagModel);
+	MTLBinaryArchiveAppendVarint(_body, schema.schemaIndex);
+
+	MTLBinaryArchiveSchema *previousSchema = _currentSchema;
+	_currentSchema = schema;
+	[_modelsInProgress addObject:model];
+
+	[model encodeWithCoder:self];
+
+	[_modelsInProgress removeObject:model];
+	_currentSchema = previousSchema;
+
+	MTLBinaryArchiveAppendVarint(_body, 0);
+	[_offsetsByModel setObject:@(start) forKey:model];
+}
+
+- (void)writeKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+	NSAssert(_currentSchema != nil, @"%@ can only encode keyed values from within -encodeWithCoder: of a MTLModel", self.class);
+
+	MTLBinaryArchiveAppendVarint(_body, [_currentSchema indexOfKey:key] + 1);
+}
+
+#pragma mark NSCoder
+
+- (BOOL)allowsKeyedCoding {
+	return YES;
+}
+
+- (BOOL)requiresSecureCoding {
+	// Archives are always unarchived securely, so catch missing
+	// +allowedSecureCodingClassesByPropertyKey entries while archiving.
+	return YES;
+}
+
+- (void)encodeObject:(id)object forKey:(NSString *)key {
+	[self writeKey:key];
+	[self writeValue:object];
+}
+
+- (void)encodeConditionalObject:(id)object forKey:(NSString *)key {
+	if (object == nil) return;
+
+	NSNumber *offset = [_offsetsByModel objectForKey:object];
+	if (offset == nil) return;
+
+	[self writeKey:key];
+	MTLBinaryArchiveAppendTag(_body, MTLBinaryArchiveTagReference);
+	MTLBinaryArchiveAppendVarint(_body, offset.unsignedIntegerValue);
+}
+
+- (void)encodeBool:(BOOL)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeInt:(int)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeInt32:(int32_t)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeInt64:(int64_t)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeInteger:(NSInteger)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeFloat:(float)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeDouble:(double)value forKey:(NSString *)key {
+	[self encodeObject:@(value) forKey:key];
+}
+
+- (void)encodeBytes:(const uint8_t *)bytes length:(NSUInteger)length forKey:(NSString *)key {
+	[self encodeObject:[NSData dataWithBytes:bytes length:length] forKey:key];
+}
+
+@end
+
+#pragma mark - MTLBinaryUnarchiver
+
+// The classes allowed at some position in the object graph, given either as
+// a single class or as a set.
+typedef struct {
+	__unsafe_unretained Class singleClass;
+	__unsafe_unretained NSSet *classes;
+
+	// Whether the property list classes, plus NSURL and NSNull, are allowed in
+	// addition to the above. Used for -decodeObjectForKey:, whose callers don't
+	// name the classes they expect.
+	BOOL allowsPropertyListClasses;
+} MTLBinaryArchiveAllowedClasses;
+
+static BOOL MTLBinaryArchiveIsClassAllowed(Class cls, MTLBinaryArchiveAllowedClasses allowedClasses) {
+	if (allowedClasses.singleClass != Nil && [cls isSubclassOfClass:allowedClasses.singleClass]) return YES;
+
+	for (Class allowedClass in allowedClasses.classes) {
+		if ([cls isSubclassOfClass:allowedClass]) return YES;
+	}
+
+	if (allowedClasses.allowsPropertyListClasses) {
+		static NSArray *propertyListClasses;
+		static dispatch_once_t onceToken;
+		dispatch_once(&onceToken, ^{
+			propertyListClasses = @[ NSString.class, NSNumber.class, NSData.class, NSDate.class, NSArray.class, NSDictionary.class, NSURL.class, NSNull.class ];
+		});
+
+		for (Class allowedClass in propertyListClasses) {
+			if ([cls isSubclassOfClass:allowedClass]) return YES;
+		}
+	}
+
+	return NO;
+}
+
+@implementation MTLBinaryUnarchiver {
+	// Retains the bytes `_reader` points into.
+	NSData *_data;
+
+	// Reads the encoded root object, after the schemas.
+	MTLBinaryArchiveReader _reader;
+
+	NSArray<MTLBinaryArchiveSchema *> *_schemas;
+
+	// Maps the offsets of model tags to the models decoded from them.
+	NSMutableDictionary<NSNumber *, id> *_modelsByOffset;
+
+	// The offsets of the models being initialized.
+	NSMutableIndexSet *_offsetsInProgress;
+
+	NSUInteger _depth;
+
+	// The innermost model being initialized, the offsets of its fields indexed
+	// like the keys of its schema, and the classes that model was allowed to be
+	// an instance of.
+	MTLBinaryArchiveSchema *_currentSchema;
+	NSUInteger *_currentFieldOffsets;
+	MTLBinaryArchiveAllowedClasses _currentAllowedClasses;
+
+	// Keeps the results of -decodeBytesForKey:returnedLength: alive.
+	NSMutableArray<NSData *> *_decodedByteBuffers;
+
+	// The first error that occurred.
+	NSError *_error;
+}
+
+#pragma mark Lifecycle
+
++ (id)unarchivedObjectOfClasses:(NSSet *)classes fromData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(classes != nil);
+
+	return [self unarchivedObjectOfAllowedClasses:(MTLBinaryArchiveAllowedClasses){ .classes = classes } fromData:data error:error];
+}
+
++ (id)unarchivedObjectOfClass:(Class)cls fromData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(cls != nil);
+
+	return [self unarchivedObjectOfAllowedClasses:(MTLBinaryArchiveAllowedClasses){ .singleClass = cls } fromData:data error:error];
+}
+
++ (id)unarchivedObjectOfAllowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses fromData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(data != nil);
+
+	MTLBinaryUnarchiver *unarchiver = [[self alloc] initForReadingWithData:data];
+
+	id object = [unarchiver readValueWithAllowedClasses:allowedClasses];
+	if (object == nil && unarchiver->_error == nil) [unarchiver failWithInvalidArchive];
+
+	// The root object must be the last thing in the archive.
+	if (unarchiver->_reader.position != unarchiver->_reader.length) [unarchiver failWithInvalidArchive];
+
+	if (unarchiver->_error != nil) {
+		if (error != NULL) *error = unarchiver->_error;
+		return nil;
+	}
+
+	return object;
+}
+
+- (instancetype)initForReadingWithData:(NSData *)data {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_data = [data copy];
+	_modelsByOffset = [[NSMutableDictionary alloc] init];
+	_offsetsInProgress = [[NSMutableIndexSet alloc] init];
+	_decodedByteBuffers = [[NSMutableArray alloc] init];
+
+	MTLBinaryArchiveReader reader = { .bytes = _data.bytes, .length = _data.length };
+
+	const uint8_t *header = NULL;
+	if (!MTLBinaryArchiveReadBytes(&reader, sizeof(MTLBinaryArchiveMagic) + 1, &header) || memcmp(header, MTLBinaryArchiveMagic, sizeof(MTLBinaryArchiveMagic)) != 0 || header[sizeof(MTLBinaryArchiveMagic)] != MTLBinaryArchiveFormatVersion) {
+		[self failWithInvalidArchive];
+		return self;
+	}
+
+	NSUInteger schemaCount = 0;
+	if (!MTLBinaryArchiveReadCount(&reader, &schemaCount)) {
+		[self failWithInvalidArchive];
+		return self;
+	}
+
+	NSMutableArray *schemas = [[NSMutableArray alloc] initWithCapacity:schemaCount];
+	for (NSUInteger i = 0; i < schemaCount; i++) {
+		NSString *className = MTLBinaryArchiveReadString(&reader);
+
+		NSUInteger keyCount = 0;
+		if (className == nil || !MTLBinaryArchiveReadCount(&reader, &keyCount)) {
+			[self failWithInvalidArchive];
+			return self;
+		}
+
+		MTLBinaryArchiveSchema *schema = [[MTLBinaryArchiveSchema alloc] initWithClassName:className];
+		for (NSUInteger j = 0; j < keyCount; j++) {
+			NSString *key = MTLBinaryArchiveReadString(&reader);
+			if (key == nil || [schema indexOfKey:key] != j) {
+				[self failWithInvalidArchive];
+				return self;
+			}
+		}
+
+		[schemas addObject:schema];
+	}
+
+	_schemas = schemas;
+	_reader = (MTLBinaryArchiveReader){ .bytes = reader.bytes + reader.position, .length = reader.length - reader.position };
+
+	return self;
+}
+
+#pragma mark Decoding
+
+- (void)failWithCode:(NSInteger)code reason:(NSString *)failureReason {
+	if (_error != nil) return;
+
+	_error = MTLBinaryArchiverError(code, NSLocalizedString(@"Could not unarchive data", @""), failureReason);
+}
+
+- (void)failWithInvalidArchive {
+	[self failWithCode:MTLBinaryArchiverErrorInvalidArchive reason:NSLocalizedString(@"The archive is corrupt or truncated.", @"")];
+}
+
+// Checks that a decoded object of class `cls` is allowed, failing otherwise.
+- (BOOL)verifyClass:(Class)cls isAllowed:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	if (MTLBinaryArchiveIsClassAllowed(cls, allowedClasses)) return YES;
+
+	[self failWithCode:MTLBinaryArchiverErrorDisallowedClass reason:[NSString stringWithFormat:NSLocalizedString(@"Instances of %@ are not allowed at this position of the archive.", @""), cls]];
+	return NO;
+}
+
+- (id)readValueWithAllowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	if (_error != nil) return nil;
+
+	if (_depth >= MTLBinaryArchiveMaximumDepth || _reader.position >= _reader.length) {
+		[self failWithInvalidArchive];
+		return nil;
+	}
+
+	_depth++;
+	id value = [self readTaggedValueWithAllowedClasses:allowedClasses];
+	_depth--;
+
+	return value;
+}
+
+- (id)readTaggedValueWithAllowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	NSUInteger tagOffset = _reader.position;
+	MTLBinaryArchiveTag tag = _reader.bytes[_reader.position++];
+
+	uint64_t varint = 0;
+	double doubleValue = 0;
+	NSUInteger count = 0;
+	const uint8_t *bytes = NULL;
+
+	switch (tag) {
+		case MTLBinaryArchiveTagNil:
+			return nil;
+
+		case MTLBinaryArchiveTagNull:
+			if (![self verifyClass:NSNull.class isAllowed:allowedClasses]) return nil;
+
+			return NSNull.null;
+
+		case MTLBinaryArchiveTagFalse:
+		case MTLBinaryArchiveTagTrue:
+			if (![self verifyClass:NSNumber.class isAllowed:allowedClasses]) return nil;
+
+			return (tag == MTLBinaryArchiveTagTrue ? @YES : @NO);
+
+		case MTLBinaryArchiveTagInteger:
+			if (!MTLBinaryArchiveReadVarint(&_reader, &varint)) break;
+			if (![self verifyClass:NSNumber.class isAllowed:allowedClasses]) return nil;
+
+			return @((int64_t)(varint >> 1) ^ -(int64_t)(varint & 1));
+
+		case MTLBinaryArchiveTagUnsignedInteger:
+			if (!MTLBinaryArchiveReadVarint(&_reader, &varint)) break;
+			if (![self verifyClass:NSNumber.class isAllowed:allowedClasses]) return nil;
+
+			return @(varint);
+
+		case MTLBinaryArchiveTagDouble:
+			if (!MTLBinaryArchiveReadDouble(&_reader, &doubleValue)) break;
+			if (![self verifyClass:NSNumber.class isAllowed:allowedClasses]) return nil;
+
+			return @(doubleValue);
+
+		case MTLBinaryArchiveTagString: {
+			NSString *string = MTLBinaryArchiveReadString(&_reader);
+			if (string == nil) break;
+			if (![self verifyClass:NSString.class isAllowed:allowedClasses]) return nil;
+
+			return string;
+		}
+
+		case MTLBinaryArchiveTagData:
+			if (!MTLBinaryArchiveReadCount(&_reader, &count) || !MTLBinaryArchiveReadBytes(&_reader, count, &bytes)) break;
+			if (![self verifyClass:NSData.class isAllowed:allowedClasses]) return nil;
+
+			return [NSData dataWithBytes:bytes length:count];
+
+		case MTLBinaryArchiveTagDate:
+			if (!MTLBinaryArchiveReadDouble(&_reader, &doubleValue)) break;
+			if (![self verifyClass:NSDate.class isAllowed:allowedClasses]) return nil;
+
+			return [NSDate dateWithTimeIntervalSinceReferenceDate:doubleValue];
+
+		case MTLBinaryArchiveTagURL: {
+			NSString *string = MTLBinaryArchiveReadString(&_reader);
+			NSURL *URL = (string != nil ? [NSURL URLWithString:string] : nil);
+			if (URL == nil) break;
+			if (![self verifyClass:NSURL.class isAllowed:allowedClasses]) return nil;
+
+			return URL;
+		}
+
+		case MTLBinaryArchiveTagArray:
+		case MTLBinaryArchiveTagSet:
+			return [self readCollectionWithTag:tag allowedClasses:allowedClasses];
+
+		case MTLBinaryArchiveTagDictionary:
+			return [self readDictionaryWithAllowedClasses:allowedClasses];
+
+		case MTLBinaryArchiveTagModel:
+			return [self readModelAtOffset:tagOffset allowedClasses:allowedClasses];
+
+		case MTLBinaryArchiveTagReference: {
+			if (!MTLBinaryArchiveReadVarint(&_reader, &varint)) break;
+
+			// References may only point backwards, to a model tag.
+			if (varint >= tagOffset || _reader.bytes[varint] != MTLBinaryArchiveTagModel) break;
+
+			NSUInteger position = _reader.position;
+			_reader.position = (NSUInteger)varint;
+
+			id model = [self readValueWithAllowedClasses:allowedClasses];
+
+			_reader.position = position;
+			return model;
+		}
+
+		case MTLBinaryArchiveTagKeyedArchive:
+			if (!MTLBinaryArchiveReadCount(&_reader, &count) || !MTLBinaryArchiveReadBytes(&_reader, count, &bytes)) break;
+
+			return [self readKeyedArchive:[NSData dataWithBytesNoCopy:(void *)bytes length:count freeWhenDone:NO] allowedClasses:allowedClasses];
+	}
+
+	[self failWithInvalidArchive];
+	return nil;
+}
+
+- (id)readCollectionWithTag:(MTLBinaryArchiveTag)tag allowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	if (![self verifyClass:(tag == MTLBinaryArchiveTagArray ? NSArray.class : NSSet.class) isAllowed:allowedClasses]) return nil;
+
+	NSUInteger count = 0;
+	if (!MTLBinaryArchiveReadCount(&_reader, &count)) {
+		[self failWithInvalidArchive];
+		return nil;
+	}
+
+	NSMutableArray *elements = [[NSMutableArray alloc] initWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		id element = [self readValueWithAllowedClasses:allowedClasses];
+		if (element == nil) {
+			if (_error == nil) [self failWithInvalidArchive];
+			return nil;
+		}
+
+		[elements addObject:element];
+	}
+
+	return (tag == MTLBinaryArchiveTagArray ? [elements copy] : [NSSet setWithArray:elements]);
+}
+
+- (id)readDictionaryWithAllowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	if (![self verifyClass:NSDictionary.class isAllowed:allowedClasses]) return nil;
+
+	NSUInteger count = 0;
+	if (!MTLBinaryArchiveReadCount(&_reader, &count)) {
+		[self failWithInvalidArchive];
+		return nil;
+	}
+
+	NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] initWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		id key = [self readValueWithAllowedClasses:allowedClasses];
+		id object = [self readValueWithAllowedClasses:allowedClasses];
+
+		if (![key conformsToProtocol:@protocol(NSCopying)] || object == nil) {
+			if (_error == nil) [self failWithInvalidArchive];
+			return nil;
+		}
+
+		dictionary[key] = object;
+	}
+
+	return [dictionary copy];
+}
+
+- (id)readKeyedArchive:(NSData *)data allowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	NSMutableSet *classes = [NSMutableSet setWithSet:allowedClasses.classes ?: [NSSet set]];
+	if (allowedClasses.singleClass != Nil) [classes addObject:allowedClasses.singleClass];
+
+	NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:data];
+	unarchiver.requiresSecureCoding = YES;
+
+	id object = nil;
+	@try {
+		object = [unarchiver decodeObjectOfClasses:classes forKey:MTLKeyedArchiveRootObjectKey];
+	} @catch (NSException *ex) {
+		[self failWithCode:MTLBinaryArchiverErrorDisallowedClass reason:ex.reason ?: ex.name];
+		return nil;
+	} @finally {
+		[unarchiver finishDecoding];
+	}
+
+	if (object == nil) [self failWithInvalidArchive];
+
+	return object;
+}
+
+- (id)readModelAtOffset:(NSUInteger)offset allowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	id model = _modelsByOffset[@(offset)];
+	if (model != nil) {
+		// The model was decoded through a reference before reaching it here.
+		_reader.position = offset;
+		if (!MTLBinaryArchiveSkipValue(&_reader, _depth)) {
+			[self failWithInvalidArchive];
+			return nil;
+		}
+
+		return [self verifyClass:[model class] isAllowed:allowedClasses] ? model : nil;
+	}
+
+	uint64_t schemaIndex = 0;
+	if ([_offsetsInProgress containsIndex:offset] || !MTLBinaryArchiveReadVarint(&_reader, &schemaIndex) || schemaIndex >= _schemas.count) {
+		[self failWithInvalidArchive];
+		return nil;
+	}
+
+	MTLBinaryArchiveSchema *schema = _schemas[(NSUInteger)schemaIndex];
+	Class modelClass = schema.modelClass;
+
+	if (modelClass == Nil || ![modelClass isSubclassOfClass:MTLModel.class]) {
+		[self failWithCode:MTLBinaryArchiverErrorDisallowedClass reason:[NSString stringWithFormat:NSLocalizedString(@"%@ is not a MTLModel subclass.", @""), schema.className]];
+		return nil;
+	}
+
+	if (![self verifyClass:modelClass isAllowed:allowedClasses]) return nil;
+
+	NSUInteger keyCount = schema.keys.count;
+	NSUInteger *fieldOffsets = malloc(MAX(keyCount, 1) * sizeof(*fieldOffsets));
+	for (NSUInteger i = 0; i < keyCount; i++) {
+		fieldOffsets[i] = NSNotFound;
+	}
+
+	while (YES) {
+		uint64_t field = 0;
+		if (!MTLBinaryArchiveReadVarint(&_reader, &field) || field > keyCount) {
+			free(fieldOffsets);
+			[self failWithInvalidArchive];
+			return nil;
+		}
+
+		if (field == 0) break;
+
+		fieldOffsets[field - 1] = _reader.position;
+		if (!MTLBinaryArchiveSkipValue(&_reader, _depth)) {
+			free(fieldOffsets);
+			[self failWithInvalidArchive];
+			return nil;
+		}
+	}
+
+	NSUInteger endPosition = _reader.position;
+
+	MTLBinaryArchiveSchema *previousSchema = _currentSchema;
+	NSUInteger *previousFieldOffsets = _currentFieldOffsets;
+	MTLBinaryArchiveAllowedClasses previousAllowedClasses = _currentAllowedClasses;
+
+	_currentSchema = schema;
+	_currentFieldOffsets = fieldOffsets;
+	_currentAllowedClasses = allowedClasses;
+	[_offsetsInProgress addIndex:offset];
+
+	@try {
+		model = [[modelClass alloc] initWithCoder:self];
+	} @finally {
+		[_offsetsInProgress removeIndex:offset];
+		_currentSchema = previousSchema;
+		_currentFieldOffsets = previousFieldOffsets;
+		_currentAllowedClasses = previousAllowedClasses;
+		_reader.position = endPosition;
+
+		free(fieldOffsets);
+	}
+
+	if (_error != nil) return nil;
+
+	if (model == nil) {
+		[self failWithCode:MTLBinaryArchiverErrorModelInitialization reason:[NSString stringWithFormat:NSLocalizedString(@"%@ could not be initialized from the archive.", @""), modelClass]];
+		return nil;
+	}
+
+	_modelsByOffset[@(offset)] = model;
+	return model;
+}
+
+// Returns the offset of the field for `key` in the innermost model being
+// initialized, or NSNotFound.
+- (NSUInteger)offsetOfFieldForKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+	NSAssert(_currentSchema != nil, @"%@ can only decode keyed values from within -initWithCoder: of a MTLModel", self.class);
+
+	NSNumber *index = _currentSchema.indexesByKey[key];
+	if (index == nil) return NSNotFound;
+
+	return _currentFieldOffsets[index.unsignedIntegerValue];
+}
+
+- (id)decodeFieldForKey:(NSString *)key allowedClasses:(MTLBinaryArchiveAllowedClasses)allowedClasses {
+	NSUInteger offset = [self offsetOfFieldForKey:key];
+	if (offset == NSNotFound) return nil;
+
+	NSUInteger position = _reader.position;
+	_reader.position = offset;
+
+	id value = [self readValueWithAllowedClasses:allowedClasses];
+
+	_reader.position = position;
+	return value;
+}
+
+#pragma mark NSCoder
+
+- (BOOL)allowsKeyedCoding {
+	return YES;
+}
+
+- (BOOL)requiresSecureCoding {
+	return YES;
+}
+
+- (BOOL)containsValueForKey:(NSString *)key {
+	return [self offsetOfFieldForKey:key] != NSNotFound;
+}
+
+- (id)decodeObjectForKey:(NSString *)key {
+	MTLBinaryArchiveAllowedClasses allowedClasses = _currentAllowedClasses;
+	allowedClasses.allowsPropertyListClasses = YES;
+
+	return [self decodeFieldForKey:key allowedClasses:allowedClasses];
+}
+
+- (id)decodeObjectOfClass:(Class)cls forKey:(NSString *)key {
+	return [self decodeFieldForKey:key allowedClasses:(MTLBinaryArchiveAllowedClasses){ .singleClass = cls }];
+}
+
+- (id)decodeObjectOfClasses:(NSSet *)classes forKey:(NSString *)key {
+	return [self decodeFieldForKey:key allowedClasses:(MTLBinaryArchiveAllowedClasses){ .classes = classes }];
+}
+
+- (BOOL)decodeBoolForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] boolValue];
+}
+
+- (int)decodeIntForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] intValue];
+}
+
+- (int32_t)decodeInt32ForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] intValue];
+}
+
+- (int64_t)decodeInt64ForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] longLongValue];
+}
+
+- (NSInteger)decodeIntegerForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] integerValue];
+}
+
+- (float)decodeFloatForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] floatValue];
+}
+
+- (double)decodeDoubleForKey:(NSString *)key {
+	return [[self decodeObjectOfClass:NSNumber.class forKey:key] doubleValue];
+}
+
+- (const uint8_t *)decodeBytesForKey:(NSString *)key returnedLength:(NSUInteger *)length {
+	NSData *data = [self decodeObjectOfClass:NSData.class forKey:key];
+	if (length != NULL) *length = data.length;
+	if (data == nil) return NULL;
+
+	[_decodedByteBuffers addObject:data];
+	return data.bytes;
+}
+
+@end
@@ -0,0 +1,158 @@
+//
+//  MTLColumnarBatch.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class MTLJSONAdapter;
+
+/// The domain for errors originating from MTLColumnarBatch.
+extern NSString * const MTLColumnarBatchErrorDomain;
+
+/// A property can't be stored in a column, either because it doesn't exist or
+/// because of its type.
+extern const NSInteger MTLColumnarBatchErrorUnsupportedProperty;
+
+/// The representation of the values in an MTLColumn.
+typedef NS_ENUM(NSInteger, MTLColumnType) {
+	/// Integer and BOOL properties, stored as int64_t.
+	MTLColumnTypeInt64,
+
+	/// Floating point and NSNumber properties, stored as double. NSDate
+	/// properties are stored as their time interval since the reference date.
+	MTLColumnTypeDouble,
+
+	/// NSString properties, stored as indexes into a dictionary of the
+	/// distinct strings.
+	MTLColumnTypeString,
+};
+
+/// The values of one property across all models of an MTLColumnarBatch.
+///
+/// Values are stored in contiguous buffers, with one bit per model recording
+/// whether the value was nil. The buffers hold 0 for nil values.
+@interface MTLColumn : NSObject
+
+/// The property whose values are stored in the column.
+@property (nonatomic, copy, readonly) NSString *propertyKey;
+
+/// The representation of the values.
+@property (nonatomic, assign, readonly) MTLColumnType type;
+
+/// The number of values.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The number of nil values.
+@property (nonatomic, assign, readonly) NSUInteger nullCount;
+
+/// A bitmap with one bit per value, in which the bit `i % 8` of byte `i / 8`
+/// is set if value `i` is not nil.
+@property (nonatomic, assign, readonly) const uint8_t *validityBitmap NS_RETURNS_INNER_POINTER;
+
+/// The values of an MTLColumnTypeInt64 column, or NULL.
+@property (nonatomic, assign, readonly, nullable) const int64_t *int64Values NS_RETURNS_INNER_POINTER;
+
+/// The values of an MTLColumnTypeDouble column, or NULL.
+@property (nonatomic, assign, readonly, nullable) const double *doubleValues NS_RETURNS_INNER_POINTER;
+
+/// For an MTLColumnTypeString column, the index of each value within
+/// `stringDictionary`, or NULL.
+@property (nonatomic, assign, readonly, nullable) const uint32_t *stringIndexes NS_RETURNS_INNER_POINTER;
+
+/// For an MTLColumnTypeString column, every distinct string in the order they
+/// first appeared, or nil.
+@property (nonatomic, copy, readonly, nullable) NSArray<NSString *> *stringDictionary;
+
+/// Whether the value at the given index is not nil.
+- (BOOL)isValidAtIndex:(NSUInteger)index;
+
+/// Returns the value at the given index of a numeric column, converted to a
+/// double, or 0 if it's nil.
+- (double)doubleValueAtIndex:(NSUInteger)index;
+
+/// Returns the value at the given index of a string column, or nil.
+- (nullable NSString *)stringAtIndex:(NSUInteger)index;
+
+/// The sum of the non-nil values of a numeric column.
+///
+/// Int64 columns are summed as integers, and converted afterwards.
+- (double)sum;
+
+/// Finds the smallest and largest non-nil values of a numeric column.
+///
+/// Returns NO if the column has no non-nil values.
+- (BOOL)getMinimum:(nullable double *)minimum maximum:(nullable double *)maximum;
+
+/// Returns the indexes of the non-nil values of a numeric column which are
+/// between `lower` and `upper`, inclusive.
+- (NSIndexSet *)indexesOfValuesBetween:(double)lower and:(double)upper;
+
+/// Returns the indexes of the values of a string column which are equal to
+/// `string`.
+- (NSIndexSet *)indexesOfString:(NSString *)string;
+
+@end
+
+/// Stores some properties of an array of models as columns, for analytics over
+/// many models.
+///
+/// Reading a property of many models through KVC boxes every value. A batch
+/// reads each value once, through the property's getter, and stores it in a
+/// primitive buffer that numeric kernels can process without any boxing.
+@interface MTLColumnarBatch : NSObject
+
+/// Creates a batch from models.
+///
+/// models       - The models to read. Every model must be an instance of
+///                `modelClass` or one of its subclasses. This argument must
+///                not be nil.
+/// modelClass   - The MTLModel subclass declaring the properties. This argument
+///                must not be nil.
+/// propertyKeys - The properties to store. Each must be of an integer, BOOL or
+///                floating point type, or an NSNumber, NSDate or NSString. This
+///                argument must not be nil.
+/// error        - If not NULL, this may be set to an error that occurs while
+///                creating the batch.
+///
+/// Returns a batch, or nil if an error occurred.
++ (nullable instancetype)batchWithModels:(NSArray *)models ofClass:(Class)modelClass propertyKeys:(NSArray<NSString *> *)propertyKeys error:(NSError **)error;
+
+/// Creates a batch from a JSON array.
+///
+/// The dictionaries are deserialized with
+/// -[MTLJSONAdapter enumerateModelsFromJSONArray:projection:error:usingBlock:],
+/// using a projection of `propertyKeys`, so no model is created per dictionary
+/// and other properties aren't deserialized at all.
+///
+/// JSONArray    - An array of dictionaries representing JSON data. This
+///                argument must not be nil.
+/// adapter      - The adapter to deserialize the dictionaries with. This
+///                argument must not be nil.
+/// propertyKeys - The properties to store, as for
+///                +batchWithModels:ofClass:propertyKeys:error:.
+/// error        - If not NULL, this may be set to an error that occurs while
+///                deserializing or creating the batch.
+///
+/// Returns a batch, or nil if an error occurred.
++ (nullable instancetype)batchWithJSONArray:(NSArray<NSDictionary<NSString *, id> *> *)JSONArray JSONAdapter:(MTLJSONAdapter *)adapter propertyKeys:(NSArray<NSString *> *)propertyKeys error:(NSError **)error;
+
+/// The number of models in the batch.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// The columns, in the order of the property keys the batch was created with.
+@property (nonatomic, copy, readonly) NSArray<MTLColumn *> *columns;
+
+/// Returns the column of a property, or nil if it's not stored in the batch.
+- (nullable MTLColumn *)columnForPropertyKey:(NSString *)propertyKey;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,460 @@
+//
+//  MTLColumnarBatch.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLColumnarBatch.h"
+#import "MTLJSONAdapter.h"
+#import "MTLModel.h"
+#import "MTLPropertyAccessor.h"
+
+NSString * const MTLColumnarBatchErrorDomain = @"MTLColumnarBatchErrorDomain";
+const NSInteger MTLColumnarBatchErrorUnsupportedProperty = 1;
+
+static NSError *MTLUnsupportedPropertyError(Class modelClass, NSString *propertyKey) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: NSLocalizedString(@"Could not create columnar batch", @""),
+		NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Property \"%@\" of %@ does not exist or cannot be stored in a column.", @""), propertyKey, modelClass]
+	};
+
+	return [NSError errorWithDomain:MTLColumnarBatchErrorDomain code:MTLColumnarBatchErrorUnsupportedProperty userInfo:userInfo];
+}
+
+// Returns the indexes of the nonzero bytes in `mask`.
+static NSIndexSet *MTLIndexSetWithMask(const uint8_t *mask, NSUInteger count) {
+	NSMutableIndexSet *indexes = [NSMutableIndexSet indexSet];
+
+	NSUInteger start = NSNotFound;
+	for (NSUInteger i = 0; i < count; i++) {
+		if (mask[i] != 0) {
+			if (start == NSNotFound) start = i;
+		} else if (start != NSNotFound) {
+			[indexes addIndexesInRange:NSMakeRange(start, i - start)];
+			start = NSNotFound;
+		}
+	}
+
+	if (start != NSNotFound) [indexes addIndexesInRange:NSMakeRange(start, count - start)];
+
+	return indexes;
+}
+
+@interface MTLColumn ()
+
+// Initializes a column to read a property from models of `modelClass`.
+//
+// Returns nil if the property can't be stored in a column.
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey modelClass:(Class)modelClass capacity:(NSUInteger)capacity;
+
+// Reads the property from `model` and appends it.
+- (void)appendValueFromModel:(id)model;
+
+@end
+
+@implementation MTLColumn {
+	// The values, the bitmap and, for string columns, the strings by their
+	// index.
+	NSMutableData *_values;
+	NSMutableData *_validity;
+	NSMutableArray *_strings;
+	NSMutableDictionary *_stringIndexesByString;
+
+	MTLPropertyAccessor *_accessor;
+}
+
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey modelClass:(Class)modelClass capacity:(NSUInteger)capacity {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_accessor = [MTLPropertyAccessor accessorForPropertyKey:propertyKey ofClass:modelClass];
+	if (_accessor == nil) return nil;
+
+	_propertyKey = [propertyKey copy];
+
+	size_t valueSize = 0;
+
+	switch (_accessor.kind) {
+		case MTLPropertyAccessorKindInt64:
+			_type = MTLColumnTypeInt64;
+			valueSize = sizeof(int64_t);
+			break;
+
+		case MTLPropertyAccessorKindDouble:
+			_type = MTLColumnTypeDouble;
+			valueSize = sizeof(double);
+			break;
+
+		case MTLPropertyAccessorKindObject:
+			if ([_accessor.objectClass isSubclassOfClass:NSNumber.class] || [_accessor.objectClass isSubclassOfClass:NSDate.class]) {
+				_type = MTLColumnTypeDouble;
+				valueSize = sizeof(double);
+			} else if ([_accessor.objectClass isSubclassOfClass:NSString.class]) {
+				_type = MTLColumnTypeString;
+				valueSize = sizeof(uint32_t);
+				_strings = [NSMutableArray array];
+				_stringIndexesByString = [NSMutableDictionary dictionary];
+			} else {
+				return nil;
+			}
+
+			break;
+	}
+
+	_values = [NSMutableData dataWithCapacity:capacity * valueSize];
+	_validity = [NSMutableData dataWithCapacity:(capacity + 7) / 8];
+
+	return self;
+}
+
+- (void)appendValueFromModel:(id)model {
+	NSUInteger index = _count++;
+	if (index % 8 == 0) [_validity increaseLengthBy:1];
+
+	BOOL valid = YES;
+	int64_t int64Value = 0;
+	double doubleValue = 0;
+	uint32_t stringIndex = 0;
+
+	switch (_accessor.kind) {
+		case MTLPropertyAccessorKindInt64:
+			int64Value = [_accessor int64ValueOfModel:model];
+			break;
+
+		case MTLPropertyAccessorKindDouble:
+			doubleValue = [_accessor doubleValueOfModel:model];
+			break;
+
+		case MTLPropertyAccessorKindObject: {
+			id value = [_accessor objectValueOfModel:model];
+
+			if (value == nil) {
+				valid = NO;
+			} else if (_type == MTLColumnTypeString) {
+				NSNumber *existingIndex = _stringIndexesByString[value];
+				if (existingIndex != nil) {
+					stringIndex = existingIndex.unsignedIntValue;
+				} else {
+					stringIndex = (uint32_t)_strings.count;
+
+					NSString *string = [value copy];
+					[_strings addObject:string];
+					_stringIndexesByString[string] = @(stringIndex);
+				}
+			} else if ([value isKindOfClass:NSDate.class]) {
+				doubleValue = [value timeIntervalSinceReferenceDate];
+			} else {
+				doubleValue = [value doubleValue];
+			}
+
+			break;
+		}
+	}
+
+	switch (_type) {
+		case MTLColumnTypeInt64:
+			[_values appendBytes:&int64Value length:sizeof(int64Value)];
+			break;
+
+		case MTLColumnTypeDouble:
+			[_values appendBytes:&doubleValue length:sizeof(doubleValue)];
+			break;
+
+		case MTLColumnTypeString:
+			[_values appendBytes:&stringIndex length:sizeof(stringIndex)];
+			break;
+	}
+
+	if (valid) {
+		((uint8_t *)_validity.mutableBytes)[index / 8] |= (uint8_t)(1 << (index % 8));
+	} else {
+		_nullCount++;
+	}
+}
+
+#pragma mark Properties
+
+- (const uint8_t *)validityBitmap {
+	return _validity.bytes;
+}
+
+- (const int64_t *)int64Values {
+	return (_type == MTLColumnTypeInt64 ? _values.bytes : NULL);
+}
+
+- (const double *)doubleValues {
+	return (_type == MTLColumnTypeDouble ? _values.bytes : NULL);
+}
+
+- (const uint32_t *)stringIndexes {
+	return (_type == MTLColumnTypeString ? _values.bytes : NULL);
+}
+
+- (NSArray *)stringDictionary {
+	return [_strings copy];
+}
+
+#pragma mark Values
+
+- (BOOL)isValidAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < _count);
+
+	return (self.validityBitmap[index / 8] & (1 << (index % 8))) != 0;
+}
+
+- (double)doubleValueAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < _count);
+	NSAssert(_type != MTLColumnTypeString, @"%@ is not a numeric column", self);
+
+	return (_type == MTLColumnTypeInt64 ? (double)self.int64Values[index] : self.doubleValues[index]);
+}
+
+- (NSString *)stringAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < _count);
+	NSAssert(_type == MTLColumnTypeString, @"%@ is not a string column", self);
+
+	if (![self isValidAtIndex:index]) return nil;
+
+	return _strings[self.stringIndexes[index]];
+}
+
+#pragma mark Kernels
+
+// The loops below are kept free of branches where possible, so that the
+// compiler can vectorize them. Nil values are stored as 0, so they can be
+// included in sums without looking at the bitmap.
+
+- (double)sum {
+	NSAssert(_type != MTLColumnTypeString, @"%@ is not a numeric column", self);
+
+	NSUInteger count = _count;
+
+	if (_type == MTLColumnTypeInt64) {
+		const int64_t *values = self.int64Values;
+
+		int64_t sum = 0;
+		for (NSUInteger i = 0; i < count; i++) {
+			sum += values[i];
+		}
+
+		return (double)sum;
+	} else {
+		const double *values = self.doubleValues;
+
+		double sum = 0;
+		for (NSUInteger i = 0; i < count; i++) {
+			sum += values[i];
+		}
+
+		return sum;
+	}
+}
+
+- (BOOL)getMinimum:(double *)minimumPtr maximum:(double *)maximumPtr {
+	NSAssert(_type != MTLColumnTypeString, @"%@ is not a numeric column", self);
+
+	NSUInteger count = _count;
+	if (_nullCount == count) return NO;
+
+	const uint8_t *validity = self.validityBitmap;
+	double minimum = INFINITY;
+	double maximum = -INFINITY;
+
+	#define MTL_MIN_MAX(VALUES) \
+		if (_nullCount == 0) { \
+			for (NSUInteger i = 0; i < count; i++) { \
+				double value = (double)VALUES[i]; \
+				minimum = (value < minimum ? value : minimum); \
+				maximum = (value > maximum ? value : maximum); \
+			} \
+		} else { \
+			for (NSUInteger i = 0; i < count; i++) { \
+				if ((validity[i / 8] & (1 << (i % 8))) == 0) continue; \
+				\
+				double value = (double)VALUES[i]; \
+				minimum = (value < minimum ? value : minimum); \
+				maximum = (value > maximum ? value : maximum); \
+			} \
+		}
+
+	if (_type == MTLColumnTypeInt64) {
+		const int64_t *values = self.int64Values;
+		MTL_MIN_MAX(values)
+	} else {
+		const double *values = self.doubleValues;
+		MTL_MIN_MAX(values)
+	}
+
+	#undef MTL_MIN_MAX
+
+	if (minimumPtr != NULL) *minimumPtr = minimum;
+	if (maximumPtr != NULL) *maximumPtr = maximum;
+
+	return YES;
+}
+
+- (NSIndexSet *)indexesOfValuesBetween:(double)lower and:(double)upper {
+	NSAssert(_type != MTLColumnTypeString, @"%@ is not a numeric column", self);
+
+	NSUInteger count = _count;
+	const uint8_t *validity = self.validityBitmap;
+
+	NSMutableData *maskData = [NSMutableData dataWithLength:count];
+	uint8_t *mask = maskData.mutableBytes;
+
+	if (_type == MTLColumnTypeInt64) {
+		const int64_t *values = self.int64Values;
+		for (NSUInteger i = 0; i < count; i++) {
+			double value = (double)values[i];
+			mask[i] = (uint8_t)((value >= lower) & (value <= upper));
+		}
+	} else {
+		const double *values = self.doubleValues;
+		for (NSUInteger i = 0; i < count; i++) {
+			mask[i] = (uint8_t)((values[i] >= lower) & (values[i] <= upper));
+		}
+	}
+
+	if (_nullCount > 0) {
+		for (NSUInteger i = 0; i < count; i++) {
+			mask[i] &= (validity[i / 8] >> (i % 8)) & 1;
+		}
+	}
+
+	return MTLIndexSetWithMask(mask, count);
+}
+
+- (NSIndexSet *)indexesOfString:(NSString *)string {
+	NSParameterAssert(string != nil);
+	NSAssert(_type == MTLColumnTypeString, @"%@ is not a string column", self);
+
+	NSNumber *stringIndex = _stringIndexesByString[string];
+	if (stringIndex == nil) return [NSIndexSet indexSet];
+
+	NSUInteger count = _count;
+	const uint32_t *indexes = self.stringIndexes;
+	const uint8_t *validity = self.validityBitmap;
+	uint32_t target = stringIndex.unsignedIntValue;
+
+	NSMutableData *maskData = [NSMutableData dataWithLength:count];
+	uint8_t *mask = maskData.mutableBytes;
+
+	for (NSUInteger i = 0; i < count; i++) {
+		mask[i] = (uint8_t)((indexes[i] == target) & ((validity[i / 8] >> (i % 8)) & 1));
+	}
+
+	return MTLIndexSetWithMask(mask, count);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> { propertyKey = %@, count = %lu, nullCount = %lu }", self.class, self, self.propertyKey, (unsigned long)self.count, (unsigned long)self.nullCount];
+}
+
+@end
+
+@interface MTLColumnarBatch ()
+
+- (instancetype)initWithColumns:(NSArray *)columns count:(NSUInteger)count;
+
+@end
+
+@implementation MTLColumnarBatch {
+	NSDictionary *_columnsByPropertyKey;
+}
+
+#pragma mark Lifecycle
+
+// Returns columns for the given properties, or nil if one isn't supported.
++ (NSArray *)columnsForModelClass:(Class)modelClass propertyKeys:(NSArray *)propertyKeys capacity:(NSUInteger)capacity error:(NSError **)error {
+	NSMutableArray *columns = [NSMutableArray arrayWithCapacity:propertyKeys.count];
+
+	for (NSString *propertyKey in propertyKeys) {
+		MTLColumn *column = [[MTLColumn alloc] initWithPropertyKey:propertyKey modelClass:modelClass capacity:capacity];
+		if (column == nil) {
+			if (error != NULL) *error = MTLUnsupportedPropertyError(modelClass, propertyKey);
+			return nil;
+		}
+
+		[columns addObject:column];
+	}
+
+	return columns;
+}
+
++ (instancetype)batchWithModels:(NSArray *)models ofClass:(Class)modelClass propertyKeys:(NSArray *)propertyKeys error:(NSError **)error {
+	NSParameterAssert(models != nil);
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(propertyKeys != nil);
+
+	NSArray *columns = [self columnsForModelClass:modelClass propertyKeys:propertyKeys capacity:models.count error:error];
+	if (columns == nil) return nil;
+
+	for (id model in models) {
+		NSAssert([model isKindOfClass:modelClass], @"%@ is not an instance of %@", model, modelClass);
+
+		for (MTLColumn *column in columns) {
+			[column appendValueFromModel:model];
+		}
+	}
+
+	return [[self alloc] initWithColumns:columns count:models.count];
+}
+
++ (instancetype)batchWithJSONArray:(NSArray *)JSONArray JSONAdapter:(MTLJSONAdapter *)adapter propertyKeys:(NSArray *)propertyKeys error:(NSError **)error {
+	NSParameterAssert(JSONArray != nil);
+	NSParameterAssert(adapter != nil);
+	NSParameterAssert(propertyKeys != nil);
+
+	NSArray *columns = [self columnsForModelClass:adapter.modelClass propertyKeys:propertyKeys capacity:JSONArray.count error:error];
+	if (columns == nil) return nil;
+
+	MTLJSONProjection *projection = [MTLJSONProjection projectionWithPropertyKeys:[NSSet setWithArray:propertyKeys]];
+	__block NSUInteger count = 0;
+
+	BOOL success = [adapter enumerateModelsFromJSONArray:JSONArray projection:projection error:error usingBlock:^(id model, NSUInteger index, BOOL *stop) {
+		for (MTLColumn *column in columns) {
+			[column appendValueFromModel:model];
+		}
+
+		count++;
+	}];
+
+	if (!success) return nil;
+
+	return [[self alloc] initWithColumns:columns count:count];
+}
+
+- (instancetype)initWithColumns:(NSArray *)columns count:(NSUInteger)count {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_columns = [columns copy];
+	_count = count;
+
+	NSMutableDictionary *columnsByPropertyKey = [NSMutableDictionary dictionaryWithCapacity:columns.count];
+	for (MTLColumn *column in columns) {
+		columnsByPropertyKey[column.propertyKey] = column;
+	}
+
+	_columnsByPropertyKey = [columnsByPropertyKey copy];
+
+	return self;
+}
+
+#pragma mark Columns
+
+- (MTLColumn *)columnForPropertyKey:(NSString *)propertyKey {
+	return _columnsByPropertyKey[propertyKey];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> { count = %lu, columns = %@ }", self.class, self, (unsigned long)self.count, self.columns];
+}
+
+@end
@@ -0,0 +1,85 @@
+//
+//  MTLCompiledPredicate.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The domain for errors originating from MTLCompiledPredicate.
+extern NSString * const MTLCompiledPredicateErrorDomain;
+
+/// The predicate could not be parsed, or refers to a key which the model class
+/// doesn't have.
+extern const NSInteger MTLCompiledPredicateErrorInvalidPredicate;
+
+/// Options for evaluating a compiled predicate over an array.
+typedef NS_OPTIONS(NSUInteger, MTLPredicateEvaluationOptions) {
+	MTLPredicateEvaluationOptionsNone = 0,
+
+	/// Evaluates large arrays on multiple threads. The models' getters must be
+	/// safe to call concurrently.
+	MTLPredicateEvaluationOptionsConcurrent = 1 << 0,
+};
+
+/// An NSPredicate compiled against a model class, for filtering many models.
+///
+/// NSPredicate evaluates key paths through KVC for every object, which looks up
+/// the key and boxes primitive values each time. A compiled predicate resolves
+/// every property it compares to the implementation of the property's getter
+/// once, and compares numbers without boxing them.
+///
+/// Compound predicates, TRUEPREDICATE, FALSEPREDICATE and comparisons between a
+/// property of the model class and a constant are compiled. The supported
+/// operators are <, <=, >, >=, ==, !=, BETWEEN and IN, as well as BEGINSWITH,
+/// ENDSWITH and CONTAINS for strings, along with the case and diacritic
+/// insensitive options. Any other comparison, such as one using a key path, a
+/// modifier like ANY, or MATCHES, is evaluated with NSPredicate instead, so
+/// the results are always the same as those of the original predicate.
+@interface MTLCompiledPredicate : NSObject
+
+/// Compiles a predicate.
+///
+/// predicate  - The predicate to compile. This argument must not be nil.
+/// modelClass - The class of the models which will be evaluated. This argument
+///              must not be nil.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              compiling.
+///
+/// Returns a compiled predicate, or nil if an error occurred.
++ (nullable instancetype)predicateWithPredicate:(NSPredicate *)predicate modelClass:(Class)modelClass error:(NSError **)error;
+
+/// Parses and compiles a predicate.
+///
+/// This is a convenience for +predicateWithPredicate:modelClass:error:, which
+/// reports syntax errors in `format` as an error instead of an exception.
++ (nullable instancetype)predicateWithFormat:(NSString *)format argumentArray:(nullable NSArray *)arguments modelClass:(Class)modelClass error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The predicate which was compiled.
+@property (nonatomic, copy, readonly) NSPredicate *predicate;
+
+/// The class of the models which will be evaluated.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// Whether every comparison in the predicate was compiled, rather than left to
+/// NSPredicate.
+@property (nonatomic, assign, readonly, getter = isFullyCompiled) BOOL fullyCompiled;
+
+/// Evaluates the predicate against a model.
+- (BOOL)evaluateWithModel:(id)model;
+
+/// Returns the indexes of the models in `models` matching the predicate.
+- (NSIndexSet *)indexesOfModelsInArray:(NSArray *)models options:(MTLPredicateEvaluationOptions)options;
+
+/// Returns the models in `models` matching the predicate, in order.
+- (NSArray *)filteredArrayFromModels:(NSArray *)models options:(MTLPredicateEvaluationOptions)options;
+
+@end
+
+NS_ASSUME_NONNULL_END
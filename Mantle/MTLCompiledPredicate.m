@@ -0,0 +1,516 @@
+//
+//  MTLCompiledPredicate.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLCompiledPredicate.h"
+#import "MTLPropertyAccessor.h"
+
+NSString * const MTLCompiledPredicateErrorDomain = @"MTLCompiledPredicateErrorDomain";
+const NSInteger MTLCompiledPredicateErrorInvalidPredicate = 1;
+
+// Arrays with at least this many models are evaluated concurrently, in chunks
+// of MTLConcurrentPredicateChunkLength models, if requested.
+static const NSUInteger MTLConcurrentPredicateMinimumCount = 2048;
+static const NSUInteger MTLConcurrentPredicateChunkLength = 1024;
+
+typedef BOOL (^MTLPredicateBlock)(id model);
+
+static NSError *MTLInvalidPredicateError(NSString *failureReason) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: NSLocalizedString(@"Could not compile predicate", @""),
+		NSLocalizedFailureReasonErrorKey: failureReason
+	};
+
+	return [NSError errorWithDomain:MTLCompiledPredicateErrorDomain code:MTLCompiledPredicateErrorInvalidPredicate userInfo:userInfo];
+}
+
+// Whether the given number holds an integer, rather than a floating point
+// value.
+static BOOL MTLNumberIsIntegral(NSNumber *number) {
+	return strchr("cislqCISLQB", number.objCType[0]) != NULL;
+}
+
+static int MTLCompareDoubles(const void *a, const void *b) {
+	double left = *(const double *)a;
+	double right = *(const double *)b;
+	return (left > right) - (left < right);
+}
+
+// Returns the operator to use when the operands of `operatorType` are swapped,
+// or NSCustomSelectorPredicateOperatorType if it can't be swapped.
+static NSPredicateOperatorType MTLSwappedPredicateOperatorType(NSPredicateOperatorType operatorType) {
+	switch (operatorType) {
+		case NSLessThanPredicateOperatorType:
+			return NSGreaterThanPredicateOperatorType;
+
+		case NSLessThanOrEqualToPredicateOperatorType:
+			return NSGreaterThanOrEqualToPredicateOperatorType;
+
+		case NSGreaterThanPredicateOperatorType:
+			return NSLessThanPredicateOperatorType;
+
+		case NSGreaterThanOrEqualToPredicateOperatorType:
+			return NSLessThanOrEqualToPredicateOperatorType;
+
+		case NSEqualToPredicateOperatorType:
+		case NSNotEqualToPredicateOperatorType:
+			return operatorType;
+
+		default:
+			return NSCustomSelectorPredicateOperatorType;
+	}
+}
+
+// Creates a block comparing a value read from the model by READ to CONSTANT,
+// according to `operatorType`, and returns it from the enclosing function.
+#define MTL_RETURN_ORDERED_COMPARISON(TYPE, READ, CONSTANT) \
+	do { \
+		TYPE constantValue = (CONSTANT); \
+		\
+		switch (operatorType) { \
+			case NSLessThanPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) < constantValue; }; \
+			\
+			case NSLessThanOrEqualToPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) <= constantValue; }; \
+			\
+			case NSGreaterThanPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) > constantValue; }; \
+			\
+			case NSGreaterThanOrEqualToPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) >= constantValue; }; \
+			\
+			case NSEqualToPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) == constantValue; }; \
+			\
+			case NSNotEqualToPredicateOperatorType: \
+				return ^ BOOL (id model) { return (TYPE)(READ) != constantValue; }; \
+			\
+			default: \
+				return nil; \
+		} \
+	} while (0)
+
+// Compiles a comparison of a primitive property to a number.
+//
+// Returns nil if the comparison isn't supported.
+static MTLPredicateBlock MTLCompileNumericComparison(MTLPropertyAccessor *accessor, NSPredicateOperatorType operatorType, id constant) {
+	if (operatorType == NSBetweenPredicateOperatorType) {
+		if (![constant isKindOfClass:NSArray.class] || [constant count] != 2) return nil;
+		if (![constant[0] isKindOfClass:NSNumber.class] || ![constant[1] isKindOfClass:NSNumber.class]) return nil;
+
+		double lower = [constant[0] doubleValue];
+		double upper = [constant[1] doubleValue];
+
+		return ^ BOOL (id model) {
+			double value = [accessor doubleValueOfModel:model];
+			return value >= lower && value <= upper;
+		};
+	}
+
+	if (operatorType == NSInPredicateOperatorType) {
+		id<NSFastEnumeration> collection = ([constant isKindOfClass:NSDictionary.class] ? [constant allValues] : constant);
+		if (![(id)collection conformsToProtocol:@protocol(NSFastEnumeration)]) return nil;
+
+		NSMutableArray *numbers = [NSMutableArray array];
+		for (id element in collection) {
+			if (![element isKindOfClass:NSNumber.class]) return nil;
+
+			[numbers addObject:element];
+		}
+
+		// Sorted, for a binary search.
+		NSUInteger count = numbers.count;
+		NSMutableData *valuesData = [NSMutableData dataWithLength:count * sizeof(double)];
+		double *values = valuesData.mutableBytes;
+
+		for (NSUInteger i = 0; i < count; i++) {
+			values[i] = [numbers[i] doubleValue];
+		}
+
+		qsort(values, count, sizeof(double), MTLCompareDoubles);
+
+		return ^ BOOL (id model) {
+			double value = [accessor doubleValueOfModel:model];
+			const double *sortedValues = valuesData.bytes;
+
+			NSUInteger low = 0;
+			NSUInteger high = count;
+			while (low < high) {
+				NSUInteger middle = low + (high - low) / 2;
+				if (sortedValues[middle] < value) {
+					low = middle + 1;
+				} else {
+					high = middle;
+				}
+			}
+
+			return low < count && sortedValues[low] == value;
+		};
+	}
+
+	if (![constant isKindOfClass:NSNumber.class]) return nil;
+
+	NSNumber *number = constant;
+
+	if (accessor.kind == MTLPropertyAccessorKindInt64 && MTLNumberIsIntegral(number)) {
+		if (!accessor.isUnsigned) {
+			MTL_RETURN_ORDERED_COMPARISON(int64_t, [accessor int64ValueOfModel:model], number.longLongValue);
+		} else if (number.longLongValue >= 0) {
+			MTL_RETURN_ORDERED_COMPARISON(uint64_t, [accessor int64ValueOfModel:model], number.unsignedLongLongValue);
+		}
+	}
+
+	MTL_RETURN_ORDERED_COMPARISON(double, [accessor doubleValueOfModel:model], number.doubleValue);
+}
+
+// Compiles a comparison of an object property to a constant.
+//
+// Returns nil if the comparison isn't supported.
+static MTLPredicateBlock MTLCompileObjectComparison(MTLPropertyAccessor *accessor, NSPredicateOperatorType operatorType, NSComparisonPredicateOptions predicateOptions, id constant) {
+	NSStringCompareOptions compareOptions = 0;
+	if ((predicateOptions & NSCaseInsensitivePredicateOption) != 0) compareOptions |= NSCaseInsensitiveSearch;
+	if ((predicateOptions & NSDiacriticInsensitivePredicateOption) != 0) compareOptions |= NSDiacriticInsensitiveSearch;
+
+	BOOL comparesStrings = (compareOptions != 0);
+	if (comparesStrings && ![constant isKindOfClass:NSString.class] && operatorType != NSBetweenPredicateOperatorType) return nil;
+
+	switch (operatorType) {
+		case NSEqualToPredicateOperatorType:
+		case NSNotEqualToPredicateOperatorType: {
+			BOOL expectsEqual = (operatorType == NSEqualToPredicateOperatorType);
+
+			if (comparesStrings) {
+				return ^ BOOL (id model) {
+					id value = [accessor objectValueOfModel:model];
+					BOOL equal = [value isKindOfClass:NSString.class] && [value compare:constant options:compareOptions] == NSOrderedSame;
+
+					return equal == expectsEqual;
+				};
+			}
+
+			return ^ BOOL (id model) {
+				id value = [accessor objectValueOfModel:model];
+				BOOL equal = (constant == nil ? value == nil : [constant isEqual:value]);
+
+				return equal == expectsEqual;
+			};
+		}
+
+		case NSLessThanPredicateOperatorType:
+		case NSLessThanOrEqualToPredicateOperatorType:
+		case NSGreaterThanPredicateOperatorType:
+		case NSGreaterThanOrEqualToPredicateOperatorType: {
+			if (constant == nil) return nil;
+
+			return ^ BOOL (id model) {
+				id value = [accessor objectValueOfModel:model];
+				if (value == nil || ![value respondsToSelector:@selector(compare:)]) return NO;
+
+				NSComparisonResult result = (comparesStrings ? [value compare:constant options:compareOptions] : [value compare:constant]);
+
+				switch (operatorType) {
+					case NSLessThanPredicateOperatorType:
+						return result == NSOrderedAscending;
+
+					case NSLessThanOrEqualToPredicateOperatorType:
+						return result != NSOrderedDescending;
+
+					case NSGreaterThanPredicateOperatorType:
+						return result == NSOrderedDescending;
+
+					default:
+						return result != NSOrderedAscending;
+				}
+			};
+		}
+
+		case NSBeginsWithPredicateOperatorType:
+		case NSEndsWithPredicateOperatorType:
+		case NSContainsPredicateOperatorType: {
+			if (![constant isKindOfClass:NSString.class] || [constant length] == 0) return nil;
+
+			NSStringCompareOptions searchOptions = compareOptions;
+			if (operatorType == NSBeginsWithPredicateOperatorType) searchOptions |= NSAnchoredSearch;
+			if (operatorType == NSEndsWithPredicateOperatorType) searchOptions |= NSAnchoredSearch | NSBackwardsSearch;
+
+			BOOL searchesCollections = (operatorType == NSContainsPredicateOperatorType && !comparesStrings);
+
+			return ^ BOOL (id model) {
+				id value = [accessor objectValueOfModel:model];
+
+				if ([value isKindOfClass:NSString.class]) {
+					return [value rangeOfString:constant options:searchOptions].location != NSNotFound;
+				} else if (searchesCollections && [value respondsToSelector:@selector(containsObject:)]) {
+					return [value containsObject:constant];
+				}
+
+				return NO;
+			};
+		}
+
+		case NSInPredicateOperatorType: {
+			if (comparesStrings) return nil;
+
+			NSSet *set = nil;
+			if ([constant isKindOfClass:NSSet.class]) {
+				set = constant;
+			} else if ([constant isKindOfClass:NSArray.class]) {
+				set = [NSSet setWithArray:constant];
+			} else if ([constant isKindOfClass:NSDictionary.class]) {
+				set = [NSSet setWithArray:[constant allValues]];
+			} else {
+				return nil;
+			}
+
+			return ^ BOOL (id model) {
+				id value = [accessor objectValueOfModel:model];
+				return value != nil && [set containsObject:value];
+			};
+		}
+
+		case NSBetweenPredicateOperatorType: {
+			if (![constant isKindOfClass:NSArray.class] || [constant count] != 2) return nil;
+
+			id lower = constant[0];
+			id upper = constant[1];
+
+			return ^ BOOL (id model) {
+				id value = [accessor objectValueOfModel:model];
+				if (value == nil || ![value respondsToSelector:@selector(compare:)]) return NO;
+
+				return [value compare:lower] != NSOrderedAscending && [value compare:upper] != NSOrderedDescending;
+			};
+		}
+
+		default:
+			return nil;
+	}
+}
+
+@implementation MTLCompiledPredicate {
+	MTLPredicateBlock _block;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)predicateWithPredicate:(NSPredicate *)predicate modelClass:(Class)modelClass error:(NSError **)error {
+	NSParameterAssert(predicate != nil);
+	NSParameterAssert(modelClass != nil);
+
+	MTLCompiledPredicate *compiledPredicate = [[self alloc] initWithPredicate:predicate modelClass:modelClass];
+
+	compiledPredicate->_block = [compiledPredicate compilePredicate:predicate error:error];
+	if (compiledPredicate->_block == nil) return nil;
+
+	return compiledPredicate;
+}
+
++ (instancetype)predicateWithFormat:(NSString *)format argumentArray:(NSArray *)arguments modelClass:(Class)modelClass error:(NSError **)error {
+	NSParameterAssert(format != nil);
+
+	NSPredicate *predicate = nil;
+
+	@try {
+		predicate = [NSPredicate predicateWithFormat:format argumentArray:arguments];
+	} @catch (NSException *ex) {
+		if (error != NULL) *error = MTLInvalidPredicateError(ex.reason ?: ex.name);
+		return nil;
+	}
+
+	return [self predicateWithPredicate:predicate modelClass:modelClass error:error];
+}
+
+- (instancetype)initWithPredicate:(NSPredicate *)predicate modelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_predicate = [predicate copy];
+	_modelClass = modelClass;
+	_fullyCompiled = YES;
+
+	return self;
+}
+
+#pragma mark Compiling
+
+- (MTLPredicateBlock)compilePredicate:(NSPredicate *)predicate error:(NSError **)error {
+	if ([predicate isKindOfClass:NSCompoundPredicate.class]) {
+		return [self compileCompoundPredicate:(NSCompoundPredicate *)predicate error:error];
+	} else if ([predicate isKindOfClass:NSComparisonPredicate.class]) {
+		return [self compileComparisonPredicate:(NSComparisonPredicate *)predicate error:error];
+	} else if ([predicate isEqual:[NSPredicate predicateWithValue:YES]]) {
+		return ^ BOOL (id model) {
+			return YES;
+		};
+	} else if ([predicate isEqual:[NSPredicate predicateWithValue:NO]]) {
+		return ^ BOOL (id model) {
+			return NO;
+		};
+	}
+
+	return [self fallbackForPredicate:predicate];
+}
+
+- (MTLPredicateBlock)compileCompoundPredicate:(NSCompoundPredicate *)predicate error:(NSError **)error {
+	NSMutableArray *blocks = [NSMutableArray arrayWithCapacity:predicate.subpredicates.count];
+	for (NSPredicate *subpredicate in predicate.subpredicates) {
+		MTLPredicateBlock block = [self compilePredicate:subpredicate error:error];
+		if (block == nil) return nil;
+
+		[blocks addObject:block];
+	}
+
+	NSArray *subpredicateBlocks = [blocks copy];
+
+	switch (predicate.compoundPredicateType) {
+		case NSNotPredicateType: {
+			if (subpredicateBlocks.count != 1) return [self fallbackForPredicate:predicate];
+
+			MTLPredicateBlock block = subpredicateBlocks.firstObject;
+			return ^ BOOL (id model) {
+				return !block(model);
+			};
+		}
+
+		case NSAndPredicateType:
+			return ^ BOOL (id model) {
+				for (MTLPredicateBlock block in subpredicateBlocks) {
+					if (!block(model)) return NO;
+				}
+
+				return YES;
+			};
+
+		case NSOrPredicateType:
+			return ^ BOOL (id model) {
+				for (MTLPredicateBlock block in subpredicateBlocks) {
+					if (block(model)) return YES;
+				}
+
+				return NO;
+			};
+	}
+
+	return [self fallbackForPredicate:predicate];
+}
+
+- (MTLPredicateBlock)compileComparisonPredicate:(NSComparisonPredicate *)predicate error:(NSError **)error {
+	if (predicate.comparisonPredicateModifier != NSDirectPredicateModifier) return [self fallbackForPredicate:predicate];
+
+	NSPredicateOperatorType operatorType = predicate.predicateOperatorType;
+	NSExpression *keyPathExpression = predicate.leftExpression;
+	NSExpression *constantExpression = predicate.rightExpression;
+
+	if (keyPathExpression.expressionType == NSConstantValueExpressionType && constantExpression.expressionType == NSKeyPathExpressionType) {
+		operatorType = MTLSwappedPredicateOperatorType(operatorType);
+
+		NSExpression *expression = keyPathExpression;
+		keyPathExpression = constantExpression;
+		constantExpression = expression;
+	}
+
+	if (keyPathExpression.expressionType != NSKeyPathExpressionType || constantExpression.expressionType != NSConstantValueExpressionType) {
+		return [self fallbackForPredicate:predicate];
+	}
+
+	NSString *key = keyPathExpression.keyPath;
+	if ([key rangeOfString:@"."].location != NSNotFound) return [self fallbackForPredicate:predicate];
+
+	MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:self.modelClass];
+	if (accessor == nil) {
+		if ([self.modelClass instancesRespondToSelector:NSSelectorFromString(key)]) return [self fallbackForPredicate:predicate];
+
+		if (error != NULL) {
+			*error = MTLInvalidPredicateError([NSString stringWithFormat:NSLocalizedString(@"%@ has no property \"%@\".", @""), self.modelClass, key]);
+		}
+
+		return nil;
+	}
+
+	// Only the string options are understood.
+	NSComparisonPredicateOptions options = predicate.options & ~(NSComparisonPredicateOptions)NSNormalizedPredicateOption;
+	id constant = constantExpression.constantValue;
+
+	MTLPredicateBlock block = nil;
+	if (operatorType != NSCustomSelectorPredicateOperatorType) {
+		if (accessor.kind != MTLPropertyAccessorKindObject) {
+			if (options == 0) block = MTLCompileNumericComparison(accessor, operatorType, constant);
+		} else {
+			block = MTLCompileObjectComparison(accessor, operatorType, options, constant);
+		}
+	}
+
+	return block ?: [self fallbackForPredicate:predicate];
+}
+
+- (MTLPredicateBlock)fallbackForPredicate:(NSPredicate *)predicate {
+	_fullyCompiled = NO;
+
+	return ^ BOOL (id model) {
+		return [predicate evaluateWithObject:model];
+	};
+}
+
+#pragma mark Evaluation
+
+- (BOOL)evaluateWithModel:(id)model {
+	return _block(model);
+}
+
+- (NSIndexSet *)indexesOfModelsInArray:(NSArray *)models options:(MTLPredicateEvaluationOptions)options {
+	NSParameterAssert(models != nil);
+
+	NSUInteger count = models.count;
+	MTLPredicateBlock block = _block;
+
+	if ((options & MTLPredicateEvaluationOptionsConcurrent) == 0 || count < MTLConcurrentPredicateMinimumCount) {
+		NSMutableIndexSet *indexes = [NSMutableIndexSet indexSet];
+
+		NSUInteger index = 0;
+		for (id model in models) {
+			if (block(model)) [indexes addIndex:index];
+			index++;
+		}
+
+		return indexes;
+	}
+
+	NSUInteger chunkCount = (count + MTLConcurrentPredicateChunkLength - 1) / MTLConcurrentPredicateChunkLength;
+	NSMutableData *maskData = [NSMutableData dataWithLength:count];
+	uint8_t *mask = maskData.mutableBytes;
+
+	dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+		@autoreleasepool {
+			NSUInteger start = chunk * MTLConcurrentPredicateChunkLength;
+			NSUInteger end = MIN(start + MTLConcurrentPredicateChunkLength, count);
+
+			for (NSUInteger i = start; i < end; i++) {
+				mask[i] = (uint8_t)block(models[i]);
+			}
+		}
+	});
+
+	NSMutableIndexSet *indexes = [NSMutableIndexSet indexSet];
+	for (NSUInteger i = 0; i < count; i++) {
+		if (mask[i] != 0) [indexes addIndex:i];
+	}
+
+	return indexes;
+}
+
+- (NSArray *)filteredArrayFromModels:(NSArray *)models options:(MTLPredicateEvaluationOptions)options {
+	return [models objectsAtIndexes:[self indexesOfModelsInArray:models options:options]];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ (%@)", self.class, self, self.predicate.predicateFormat, self.modelClass];
+}
+
+@end
@@ -0,0 +1,92 @@
+//
+//  MTLDataEncoding.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "MTLDefines.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The alphabets supported by the base64 kernels.
+///
+/// MTLBase64AlphabetStandard - The RFC 4648 §4 alphabet, using `+` and `/`.
+/// MTLBase64AlphabetURLSafe  - The RFC 4648 §5 alphabet, using `-` and `_`.
+typedef NS_ENUM(NSInteger, MTLBase64Alphabet) {
+	MTLBase64AlphabetStandard,
+	MTLBase64AlphabetURLSafe,
+};
+
+/// Returns the number of characters needed to base64 encode `length` bytes.
+///
+/// length - The number of bytes to encode.
+/// padded - Whether the encoded output will be padded with `=` to a multiple
+///          of four characters.
+MANTLE_PRIVATE
+size_t MTLBase64EncodedLength(size_t length, BOOL padded);
+
+/// Returns an upper bound for the number of bytes produced by decoding
+/// `length` base64 characters.
+MANTLE_PRIVATE
+size_t MTLBase64DecodedLengthUpperBound(size_t length);
+
+/// Base64 encodes a buffer, using vectorized code where the target supports it
+/// and a scalar loop otherwise.
+///
+/// bytes    - The bytes to encode. This argument may only be NULL if `length`
+///            is zero.
+/// length   - The number of bytes to encode.
+/// output   - A buffer of at least MTLBase64EncodedLength(length, padded)
+///            characters. No terminating NUL is written.
+/// alphabet - The alphabet to encode with.
+/// padded   - Whether to pad the output with `=` to a multiple of four
+///            characters.
+///
+/// Returns the number of characters written.
+MANTLE_PRIVATE
+size_t MTLBase64Encode(const uint8_t * _Nullable bytes, size_t length, char *output, MTLBase64Alphabet alphabet, BOOL padded);
+
+/// Decodes base64 characters, using vectorized code where the target supports
+/// it and a scalar loop otherwise.
+///
+/// Both padded and unpadded input is accepted. Any character outside of
+/// `alphabet` (including whitespace) is considered an error.
+///
+/// characters - The characters to decode. This argument may only be NULL if
+///              `length` is zero.
+/// length     - The number of characters to decode.
+/// output     - A buffer of at least MTLBase64DecodedLengthUpperBound(length)
+///              bytes.
+/// alphabet   - The alphabet to decode with.
+/// outLength  - Set to the number of bytes written on success.
+///
+/// Returns whether the input was valid base64.
+MANTLE_PRIVATE
+BOOL MTLBase64Decode(const char * _Nullable characters, size_t length, uint8_t *output, MTLBase64Alphabet alphabet, size_t *outLength);
+
+/// Encodes a buffer as lowercase hexadecimal characters.
+///
+/// bytes  - The bytes to encode. This argument may only be NULL if `length` is
+///          zero.
+/// length - The number of bytes to encode.
+/// output - A buffer of at least `length * 2` characters. No terminating NUL
+///          is written.
+MANTLE_PRIVATE
+void MTLHexEncode(const uint8_t * _Nullable bytes, size_t length, char *output);
+
+/// Decodes hexadecimal characters of either case.
+///
+/// characters - The characters to decode. This argument may only be NULL if
+///              `length` is zero.
+/// length     - The number of characters to decode. This must be even for the
+///              input to be valid.
+/// output     - A buffer of at least `length / 2` bytes.
+///
+/// Returns whether the input was valid hexadecimal.
+MANTLE_PRIVATE
+BOOL MTLHexDecode(const char * _Nullable characters, size_t length, uint8_t *output);
+
+NS_ASSUME_NONNULL_END
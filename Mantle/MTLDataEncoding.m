@@ -0,0 +1,496 @@
+//
+//  MTLDataEncoding.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLDataEncoding.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define MTL_DATA_ENCODING_NEON 1
+#import <arm_neon.h>
+#elif defined(__SSSE3__)
+#define MTL_DATA_ENCODING_SSSE3 1
+#import <tmmintrin.h>
+#endif
+
+static const char MTLBase64StandardCharacters[64] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char MTLBase64URLSafeCharacters[64] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static const char MTLHexCharacters[16] = "0123456789abcdef";
+
+// The alphabet differs only in the characters used for 62 and 63, so all of
+// the kernels below are parameterized on those two characters.
+static inline const char *MTLBase64Characters(MTLBase64Alphabet alphabet) {
+	return (alphabet == MTLBase64AlphabetURLSafe ? MTLBase64URLSafeCharacters : MTLBase64StandardCharacters);
+}
+
+#pragma mark Scalar
+
+// Returns the 6-bit value of the given character, or 0xFF if it is not part of
+// the alphabet.
+static inline uint8_t MTLBase64DecodeCharacter(uint8_t c, uint8_t c62, uint8_t c63) {
+	if (c >= 'A' && c <= 'Z') return (uint8_t)(c - 'A');
+	if (c >= 'a' && c <= 'z') return (uint8_t)(c - 'a' + 26);
+	if (c >= '0' && c <= '9') return (uint8_t)(c - '0' + 52);
+	if (c == c62) return 62;
+	if (c == c63) return 63;
+
+	return 0xFF;
+}
+
+// Returns the 4-bit value of the given character, or 0xFF if it is not a
+// hexadecimal digit.
+static inline uint8_t MTLHexDecodeCharacter(uint8_t c) {
+	if (c >= '0' && c <= '9') return (uint8_t)(c - '0');
+	if (c >= 'a' && c <= 'f') return (uint8_t)(c - 'a' + 10);
+	if (c >= 'A' && c <= 'F') return (uint8_t)(c - 'A' + 10);
+
+	return 0xFF;
+}
+
+static size_t MTLBase64EncodeScalar(const uint8_t *bytes, size_t length, char *output, const char *characters, BOOL padded) {
+	char *start = output;
+	size_t i = 0;
+
+	for (; i + 3 <= length; i += 3) {
+		uint32_t triple = ((uint32_t)bytes[i] << 16) | ((uint32_t)bytes[i + 1] << 8) | bytes[i + 2];
+
+		*output++ = characters[(triple >> 18) & 0x3F];
+		*output++ = characters[(triple >> 12) & 0x3F];
+		*output++ = characters[(triple >> 6) & 0x3F];
+		*output++ = characters[triple & 0x3F];
+	}
+
+	size_t remaining = length - i;
+	if (remaining > 0) {
+		uint32_t triple = (uint32_t)bytes[i] << 16;
+		if (remaining == 2) triple |= (uint32_t)bytes[i + 1] << 8;
+
+		*output++ = characters[(triple >> 18) & 0x3F];
+		*output++ = characters[(triple >> 12) & 0x3F];
+
+		if (remaining == 2) {
+			*output++ = characters[(triple >> 6) & 0x3F];
+		} else if (padded) {
+			*output++ = '=';
+		}
+
+		if (padded) *output++ = '=';
+	}
+
+	return (size_t)(output - start);
+}
+
+// Decodes whole quanta of four characters. Returns the number of characters
+// consumed, which is less than `length` if an invalid character was found.
+static size_t MTLBase64DecodeQuantaScalar(const uint8_t *characters, size_t length, uint8_t *output, uint8_t c62, uint8_t c63, size_t *written) {
+	size_t i = 0;
+	uint8_t *start = output;
+
+	for (; i + 4 <= length; i += 4) {
+		uint8_t a = MTLBase64DecodeCharacter(characters[i], c62, c63);
+		uint8_t b = MTLBase64DecodeCharacter(characters[i + 1], c62, c63);
+		uint8_t c = MTLBase64DecodeCharacter(characters[i + 2], c62, c63);
+		uint8_t d = MTLBase64DecodeCharacter(characters[i + 3], c62, c63);
+		if ((a | b | c | d) & 0x80) break;
+
+		*output++ = (uint8_t)((a << 2) | (b >> 4));
+		*output++ = (uint8_t)((b << 4) | (c >> 2));
+		*output++ = (uint8_t)((c << 6) | d);
+	}
+
+	*written = (size_t)(output - start);
+	return i;
+}
+
+#pragma mark Vectorized
+
+#if MTL_DATA_ENCODING_NEON
+
+// Encodes 48 bytes into 64 characters per iteration. Returns the number of
+// bytes consumed.
+static size_t MTLBase64EncodeVector(const uint8_t *bytes, size_t length, char *output, const char *characters) {
+	const uint8x16x4_t table = vld1q_u8_x4((const uint8_t *)characters);
+	const uint8x16_t mask6 = vdupq_n_u8(0x3F);
+	size_t i = 0;
+
+	for (; i + 48 <= length; i += 48) {
+		uint8x16x3_t in = vld3q_u8(bytes + i);
+		uint8x16x4_t out;
+
+		out.val[0] = vshrq_n_u8(in.val[0], 2);
+		out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask6);
+		out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask6);
+		out.val[3] = vandq_u8(in.val[2], mask6);
+
+		out.val[0] = vqtbl4q_u8(table, out.val[0]);
+		out.val[1] = vqtbl4q_u8(table, out.val[1]);
+		out.val[2] = vqtbl4q_u8(table, out.val[2]);
+		out.val[3] = vqtbl4q_u8(table, out.val[3]);
+
+		vst4q_u8((uint8_t *)output + (i / 3) * 4, out);
+	}
+
+	return i;
+}
+
+static inline uint8x16_t MTLBase64DecodeVectorLane(uint8x16_t v, uint8x16_t c62, uint8x16_t c63, uint8x16_t *valid) {
+	uint8x16_t upper = vandq_u8(vcgeq_u8(v, vdupq_n_u8('A')), vcleq_u8(v, vdupq_n_u8('Z')));
+	uint8x16_t lower = vandq_u8(vcgeq_u8(v, vdupq_n_u8('a')), vcleq_u8(v, vdupq_n_u8('z')));
+	uint8x16_t digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+	uint8x16_t is62 = vceqq_u8(v, c62);
+	uint8x16_t is63 = vceqq_u8(v, c63);
+
+	*valid = vandq_u8(*valid, vorrq_u8(vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, is62)), is63));
+
+	uint8x16_t result = vandq_u8(upper, vsubq_u8(v, vdupq_n_u8('A')));
+	result = vorrq_u8(result, vandq_u8(lower, vsubq_u8(v, vdupq_n_u8('a' - 26))));
+	result = vorrq_u8(result, vandq_u8(digit, vaddq_u8(v, vdupq_n_u8(52 - '0'))));
+	result = vorrq_u8(result, vandq_u8(is62, vdupq_n_u8(62)));
+	result = vorrq_u8(result, vandq_u8(is63, vdupq_n_u8(63)));
+
+	return result;
+}
+
+// Decodes 64 characters into 48 bytes per iteration, stopping at the first
+// block that contains a character outside of the alphabet. Returns the number
+// of characters consumed.
+static size_t MTLBase64DecodeVector(const uint8_t *characters, size_t length, uint8_t *output, uint8_t c62, uint8_t c63) {
+	const uint8x16_t v62 = vdupq_n_u8(c62);
+	const uint8x16_t v63 = vdupq_n_u8(c63);
+	size_t i = 0;
+
+	for (; i + 64 <= length; i += 64) {
+		uint8x16x4_t in = vld4q_u8(characters + i);
+		uint8x16_t valid = vdupq_n_u8(0xFF);
+
+		uint8x16_t a = MTLBase64DecodeVectorLane(in.val[0], v62, v63, &valid);
+		uint8x16_t b = MTLBase64DecodeVectorLane(in.val[1], v62, v63, &valid);
+		uint8x16_t c = MTLBase64DecodeVectorLane(in.val[2], v62, v63, &valid);
+		uint8x16_t d = MTLBase64DecodeVectorLane(in.val[3], v62, v63, &valid);
+
+		if (vminvq_u8(valid) != 0xFF) break;
+
+		uint8x16x3_t out;
+		out.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+		out.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+		out.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+		vst3q_u8(output + (i / 4) * 3, out);
+	}
+
+	return i;
+}
+
+// Encodes 16 bytes into 32 characters per iteration. Returns the number of
+// bytes consumed.
+static size_t MTLHexEncodeVector(const uint8_t *bytes, size_t length, char *output) {
+	const uint8x16_t table = vld1q_u8((const uint8_t *)MTLHexCharacters);
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+		uint8x16_t in = vld1q_u8(bytes + i);
+		uint8x16x2_t out;
+
+		out.val[0] = vqtbl1q_u8(table, vshrq_n_u8(in, 4));
+		out.val[1] = vqtbl1q_u8(table, vandq_u8(in, vdupq_n_u8(0x0F)));
+
+		vst2q_u8((uint8_t *)output + i * 2, out);
+	}
+
+	return i;
+}
+
+static inline uint8x16_t MTLHexDecodeVectorLane(uint8x16_t v, uint8x16_t *valid) {
+	uint8x16_t digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+	uint8x16_t lower = vandq_u8(vcgeq_u8(v, vdupq_n_u8('a')), vcleq_u8(v, vdupq_n_u8('f')));
+	uint8x16_t upper = vandq_u8(vcgeq_u8(v, vdupq_n_u8('A')), vcleq_u8(v, vdupq_n_u8('F')));
+
+	*valid = vandq_u8(*valid, vorrq_u8(vorrq_u8(digit, lower), upper));
+
+	uint8x16_t result = vandq_u8(digit, vsubq_u8(v, vdupq_n_u8('0')));
+	result = vorrq_u8(result, vandq_u8(lower, vsubq_u8(v, vdupq_n_u8('a' - 10))));
+	result = vorrq_u8(result, vandq_u8(upper, vsubq_u8(v, vdupq_n_u8('A' - 10))));
+
+	return result;
+}
+
+// Decodes 32 characters into 16 bytes per iteration, stopping at the first
+// invalid block. Returns the number of characters consumed.
+static size_t MTLHexDecodeVector(const uint8_t *characters, size_t length, uint8_t *output) {
+	size_t i = 0;
+
+	for (; i + 32 <= length; i += 32) {
+		uint8x16x2_t in = vld2q_u8(characters + i);
+		uint8x16_t valid = vdupq_n_u8(0xFF);
+
+		uint8x16_t high = MTLHexDecodeVectorLane(in.val[0], &valid);
+		uint8x16_t low = MTLHexDecodeVectorLane(in.val[1], &valid);
+
+		if (vminvq_u8(valid) != 0xFF) break;
+
+		vst1q_u8(output + i / 2, vorrq_u8(vshlq_n_u8(high, 4), low));
+	}
+
+	return i;
+}
+
+#elif MTL_DATA_ENCODING_SSSE3
+
+// Selects bytes from `b` where `mask` is set, and from `a` otherwise.
+static inline __m128i MTLSelect(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+}
+
+// Returns a mask of the bytes of `v` within [lo, hi]. Only valid for ASCII
+// bounds, since the comparisons are signed.
+static inline __m128i MTLInRange(__m128i v, char lo, char hi) {
+	return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8((char)(lo - 1))), _mm_cmplt_epi8(v, _mm_set1_epi8((char)(hi + 1))));
+}
+
+// Encodes 12 bytes into 16 characters per iteration, using the multiply-based
+// bit extraction described by Wojciech Muła. Returns the number of bytes
+// consumed.
+static size_t MTLBase64EncodeVector(const uint8_t *bytes, size_t length, char *output, const char *characters) {
+	const __m128i offset62 = _mm_set1_epi8((char)(characters[62] - 62));
+	const __m128i offset63 = _mm_set1_epi8((char)(characters[63] - 63));
+	size_t i = 0;
+
+	// Each iteration loads 16 bytes but only consumes 12.
+	for (; i + 16 <= length; i += 12) {
+		__m128i in = _mm_loadu_si128((const __m128i *)(bytes + i));
+		in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+		__m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+		__m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+		__m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+		__m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+		__m128i indices = _mm_or_si128(t1, t3);
+
+		__m128i offset = _mm_set1_epi8('A');
+		offset = MTLSelect(_mm_cmpgt_epi8(indices, _mm_set1_epi8(25)), offset, _mm_set1_epi8('a' - 26));
+		offset = MTLSelect(_mm_cmpgt_epi8(indices, _mm_set1_epi8(51)), offset, _mm_set1_epi8('0' - 52));
+		offset = MTLSelect(_mm_cmpeq_epi8(indices, _mm_set1_epi8(62)), offset, offset62);
+		offset = MTLSelect(_mm_cmpeq_epi8(indices, _mm_set1_epi8(63)), offset, offset63);
+
+		_mm_storeu_si128((__m128i *)(output + (i / 3) * 4), _mm_add_epi8(indices, offset));
+	}
+
+	return i;
+}
+
+// Decodes 16 characters into 12 bytes per iteration, stopping at the first
+// block that contains a character outside of the alphabet. Returns the number
+// of characters consumed.
+static size_t MTLBase64DecodeVector(const uint8_t *characters, size_t length, uint8_t *output, uint8_t c62, uint8_t c63) {
+	const __m128i v62 = _mm_set1_epi8((char)c62);
+	const __m128i v63 = _mm_set1_epi8((char)c63);
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(characters + i));
+
+		__m128i upper = MTLInRange(v, 'A', 'Z');
+		__m128i lower = MTLInRange(v, 'a', 'z');
+		__m128i digit = MTLInRange(v, '0', '9');
+		__m128i is62 = _mm_cmpeq_epi8(v, v62);
+		__m128i is63 = _mm_cmpeq_epi8(v, v63);
+
+		__m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is62)), is63);
+		if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+		__m128i values = _mm_and_si128(upper, _mm_sub_epi8(v, _mm_set1_epi8('A')));
+		values = _mm_or_si128(values, _mm_and_si128(lower, _mm_sub_epi8(v, _mm_set1_epi8('a' - 26))));
+		values = _mm_or_si128(values, _mm_and_si128(digit, _mm_add_epi8(v, _mm_set1_epi8(52 - '0'))));
+		values = _mm_or_si128(values, _mm_and_si128(is62, _mm_set1_epi8(62)));
+		values = _mm_or_si128(values, _mm_and_si128(is63, _mm_set1_epi8(63)));
+
+		// Merge pairs of 6-bit values into 12 bits, then pairs of those into
+		// 24 bits, and finally gather the three bytes of each 32-bit lane in
+		// big endian order.
+		__m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+		merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+		merged = _mm_shuffle_epi8(merged, pack);
+
+		uint8_t buffer[16];
+		_mm_storeu_si128((__m128i *)buffer, merged);
+		memcpy(output + (i / 4) * 3, buffer, 12);
+	}
+
+	return i;
+}
+
+// Encodes 16 bytes into 32 characters per iteration. Returns the number of
+// bytes consumed.
+static size_t MTLHexEncodeVector(const uint8_t *bytes, size_t length, char *output) {
+	const __m128i table = _mm_loadu_si128((const __m128i *)MTLHexCharacters);
+	const __m128i mask4 = _mm_set1_epi8(0x0F);
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i in = _mm_loadu_si128((const __m128i *)(bytes + i));
+
+		__m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(in, 4), mask4));
+		__m128i low = _mm_shuffle_epi8(table, _mm_and_si128(in, mask4));
+
+		_mm_storeu_si128((__m128i *)(output + i * 2), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128((__m128i *)(output + i * 2 + 16), _mm_unpackhi_epi8(high, low));
+	}
+
+	return i;
+}
+
+static inline __m128i MTLHexDecodeVectorLane(__m128i v, __m128i *valid) {
+	__m128i digit = MTLInRange(v, '0', '9');
+	__m128i lower = MTLInRange(v, 'a', 'f');
+	__m128i upper = MTLInRange(v, 'A', 'F');
+
+	*valid = _mm_and_si128(*valid, _mm_or_si128(_mm_or_si128(digit, lower), upper));
+
+	__m128i result = _mm_and_si128(digit, _mm_sub_epi8(v, _mm_set1_epi8('0')));
+	result = _mm_or_si128(result, _mm_and_si128(lower, _mm_sub_epi8(v, _mm_set1_epi8('a' - 10))));
+	result = _mm_or_si128(result, _mm_and_si128(upper, _mm_sub_epi8(v, _mm_set1_epi8('A' - 10))));
+
+	return result;
+}
+
+// Decodes 32 characters into 16 bytes per iteration, stopping at the first
+// invalid block. Returns the number of characters consumed.
+static size_t MTLHexDecodeVector(const uint8_t *characters, size_t length, uint8_t *output) {
+	const __m128i merge = _mm_set1_epi16(0x0110);
+	size_t i = 0;
+
+	for (; i + 32 <= length; i += 32) {
+		__m128i valid = _mm_set1_epi8((char)0xFF);
+
+		__m128i first = MTLHexDecodeVectorLane(_mm_loadu_si128((const __m128i *)(characters + i)), &valid);
+		__m128i second = MTLHexDecodeVectorLane(_mm_loadu_si128((const __m128i *)(characters + i + 16)), &valid);
+
+		if (_mm_movemask_epi8(valid) != 0xFFFF) break;
+
+		// Combine each pair of nibbles into a byte, as `high * 16 + low`.
+		first = _mm_maddubs_epi16(first, merge);
+		second = _mm_maddubs_epi16(second, merge);
+
+		_mm_storeu_si128((__m128i *)(output + i / 2), _mm_packus_epi16(first, second));
+	}
+
+	return i;
+}
+
+#else
+
+static size_t MTLBase64EncodeVector(const uint8_t *bytes, size_t length, char *output, const char *characters) {
+	return 0;
+}
+
+static size_t MTLBase64DecodeVector(const uint8_t *characters, size_t length, uint8_t *output, uint8_t c62, uint8_t c63) {
+	return 0;
+}
+
+static size_t MTLHexEncodeVector(const uint8_t *bytes, size_t length, char *output) {
+	return 0;
+}
+
+static size_t MTLHexDecodeVector(const uint8_t *characters, size_t length, uint8_t *output) {
+	return 0;
+}
+
+#endif
+
+#pragma mark Base64
+
+size_t MTLBase64EncodedLength(size_t length, BOOL padded) {
+	if (padded) return ((length + 2) / 3) * 4;
+
+	return (length / 3) * 4 + ((length % 3) * 4 + 2) / 3;
+}
+
+size_t MTLBase64DecodedLengthUpperBound(size_t length) {
+	return (length / 4) * 3 + (length % 4);
+}
+
+size_t MTLBase64Encode(const uint8_t *bytes, size_t length, char *output, MTLBase64Alphabet alphabet, BOOL padded) {
+	const char *characters = MTLBase64Characters(alphabet);
+
+	// The vector loop always consumes a multiple of three bytes, so the scalar
+	// loop can pick up exactly where it left off.
+	size_t consumed = MTLBase64EncodeVector(bytes, length, output, characters);
+	size_t written = (consumed / 3) * 4;
+
+	return written + MTLBase64EncodeScalar(bytes + consumed, length - consumed, output + written, characters, padded);
+}
+
+BOOL MTLBase64Decode(const char *characters, size_t length, uint8_t *output, MTLBase64Alphabet alphabet, size_t *outLength) {
+	NSCParameterAssert(outLength != NULL);
+
+	const uint8_t *input = (const uint8_t *)characters;
+	const char *alphabetCharacters = MTLBase64Characters(alphabet);
+	uint8_t c62 = (uint8_t)alphabetCharacters[62];
+	uint8_t c63 = (uint8_t)alphabetCharacters[63];
+
+	// Padding is optional, but if present must complete the final quantum.
+	if (length > 0 && input[length - 1] == '=') {
+		if (length % 4 != 0) return NO;
+
+		length--;
+		if (input[length - 1] == '=') length--;
+	}
+
+	if (length % 4 == 1) return NO;
+
+	size_t consumed = MTLBase64DecodeVector(input, length, output, c62, c63);
+	size_t written = (consumed / 4) * 3;
+
+	size_t quantaWritten = 0;
+	size_t quantaLength = length - (length % 4);
+	consumed += MTLBase64DecodeQuantaScalar(input + consumed, quantaLength - consumed, output + written, c62, c63, &quantaWritten);
+	written += quantaWritten;
+
+	if (consumed != quantaLength) return NO;
+
+	size_t remaining = length - consumed;
+	if (remaining > 0) {
+		uint8_t a = MTLBase64DecodeCharacter(input[consumed], c62, c63);
+		uint8_t b = MTLBase64DecodeCharacter(input[consumed + 1], c62, c63);
+		uint8_t c = (remaining == 3 ? MTLBase64DecodeCharacter(input[consumed + 2], c62, c63) : 0);
+		if ((a | b | c) & 0x80) return NO;
+
+		output[written++] = (uint8_t)((a << 2) | (b >> 4));
+		if (remaining == 3) output[written++] = (uint8_t)((b << 4) | (c >> 2));
+	}
+
+	*outLength = written;
+	return YES;
+}
+
+#pragma mark Hex
+
+void MTLHexEncode(const uint8_t *bytes, size_t length, char *output) {
+	size_t i = MTLHexEncodeVector(bytes, length, output);
+
+	for (; i < length; i++) {
+		output[i * 2] = MTLHexCharacters[bytes[i] >> 4];
+		output[i * 2 + 1] = MTLHexCharacters[bytes[i] & 0x0F];
+	}
+}
+
+BOOL MTLHexDecode(const char *characters, size_t length, uint8_t *output) {
+	if (length % 2 != 0) return NO;
+
+	const uint8_t *input = (const uint8_t *)characters;
+	size_t i = MTLHexDecodeVector(input, length, output);
+
+	for (; i < length; i += 2) {
+		uint8_t high = MTLHexDecodeCharacter(input[i]);
+		uint8_t low = MTLHexDecodeCharacter(input[i + 1]);
+		if ((high | low) & 0x80) return NO;
+
+		output[i / 2] = (uint8_t)((high << 4) | low);
+	}
+
+	return YES;
+}
@@ -0,0 +1,48 @@
+//
+//  MTLEnumMappingValueTransformer.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "MTLTransformerErrorHandling.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A reversible transformer between strings and integer enum values, backing
+/// +mtl_enumMappingTransformerWithDictionary:defaultValue:reverseDefaultValue:.
+///
+/// The string cases are compiled into a perfect hash when the transformer is
+/// created, so forward transformations hash the input once and compare it
+/// against a single candidate. Every case is boxed exactly once, so neither
+/// direction allocates.
+@interface MTLEnumMappingValueTransformer : NSValueTransformer <MTLTransformerErrorHandling>
+
+/// Initializes the receiver.
+///
+/// dictionary          - Maps strings to NSNumbers holding enum values. The
+///                       values must be unique. This argument must not be nil.
+/// defaultValue        - The enum value to use for unknown strings.
+/// reverseDefaultValue - The string to use for unknown enum values.
+- (instancetype)initWithDictionary:(NSDictionary<NSString *, NSNumber *> *)dictionary defaultValue:(NSInteger)defaultValue reverseDefaultValue:(nullable NSString *)reverseDefaultValue NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Looks up the enum value for a string without boxing it.
+///
+/// string - The string to look up. May be nil.
+/// found  - If not NULL, set to whether `string` was one of the known cases.
+///
+/// Returns the enum value for `string`, or the default value.
+- (NSInteger)integerValueForString:(nullable NSString *)string found:(nullable BOOL *)found;
+
+/// Looks up the string for an enum value.
+///
+/// Returns the string for `value`, or the reverse default value.
+- (nullable NSString *)stringForIntegerValue:(NSInteger)value;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,365 @@
+//
+//  MTLEnumMappingValueTransformer.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLEnumMappingValueTransformer.h"
+
+// The maximum number of displacements tried for a single bucket before giving
+// up on building a perfect hash.
+static const uint32_t MTLEnumMappingMaximumDisplacement = 1 << 16;
+
+// FNV-1a over the UTF-8 bytes of a case.
+static inline uint64_t MTLEnumMappingHash(const uint8_t *bytes, size_t length) {
+	uint64_t hash = 0xCBF29CE484222325ULL;
+
+	for (size_t i = 0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	return hash;
+}
+
+// Re-mixes a hash with a bucket's displacement (the splitmix64 finalizer).
+static inline uint64_t MTLEnumMappingMix(uint64_t hash, uint32_t displacement) {
+	hash += (uint64_t)displacement * 0x9E3779B97F4A7C15ULL;
+	hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+
+	return hash ^ (hash >> 31);
+}
+
+static inline uint32_t MTLEnumMappingIntegerSlot(NSInteger value, uint32_t mask) {
+	return (uint32_t)(((uint64_t)value * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+// Returns the smallest power of two greater than or equal to `value`.
+static uint32_t MTLEnumMappingPowerOfTwo(NSUInteger value) {
+	uint32_t result = 1;
+	while (result < value) result <<= 1;
+
+	return result;
+}
+
+@implementation MTLEnumMappingValueTransformer {
+	// The cases, indexed by the slot tables below.
+	NSArray<NSString *> *_strings;
+	NSArray<NSNumber *> *_boxes;
+	NSInteger *_integers;
+
+	// The UTF-8 bytes of every case, back to back.
+	uint8_t *_caseBytes;
+	size_t *_caseOffsets;
+	size_t *_caseLengths;
+	size_t _maximumCaseLength;
+
+	// The perfect hash from strings to case indices: a hash selects a bucket,
+	// whose displacement selects a slot holding a case index or -1.
+	uint32_t _bucketCount;
+	uint32_t *_displacements;
+	uint32_t _slotMask;
+	int32_t *_slots;
+
+	// Used instead of the perfect hash if it could not be built, e.g. because
+	// two cases hash identically.
+	NSDictionary<NSString *, NSNumber *> *_fallbackIndexesByString;
+
+	// Open addressed table from enum values to case indices.
+	uint32_t _integerSlotMask;
+	int32_t *_integerSlots;
+
+	NSInteger _defaultValue;
+	NSNumber *_defaultBox;
+	NSString *_reverseDefaultValue;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"%@ must be initialized with a dictionary", self.class);
+	return nil;
+}
+
+- (instancetype)initWithDictionary:(NSDictionary *)dictionary defaultValue:(NSInteger)defaultValue reverseDefaultValue:(NSString *)reverseDefaultValue {
+	NSParameterAssert(dictionary != nil);
+	NSParameterAssert(dictionary.count == [[NSSet setWithArray:dictionary.allValues] count]);
+	NSParameterAssert(dictionary.count < INT32_MAX);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSUInteger count = dictionary.count;
+
+	_defaultValue = defaultValue;
+	_defaultBox = @(defaultValue);
+	_reverseDefaultValue = [reverseDefaultValue copy];
+
+	NSMutableArray *strings = [NSMutableArray arrayWithCapacity:count];
+	NSMutableArray *boxes = [NSMutableArray arrayWithCapacity:count];
+	NSMutableData *caseBytes = [NSMutableData data];
+
+	_integers = calloc(MAX(count, 1), sizeof(*_integers));
+	_caseOffsets = calloc(MAX(count, 1), sizeof(*_caseOffsets));
+	_caseLengths = calloc(MAX(count, 1), sizeof(*_caseLengths));
+
+	for (NSString *string in dictionary) {
+		NSNumber *value = dictionary[string];
+		NSAssert([string isKindOfClass:NSString.class], @"Enum mapping keys must be strings, got: %@", string);
+		NSAssert([value isKindOfClass:NSNumber.class], @"Enum mapping values must be numbers, got: %@", value);
+
+		NSUInteger index = strings.count;
+		NSData *bytes = [string dataUsingEncoding:NSUTF8StringEncoding];
+
+		_integers[index] = value.integerValue;
+		_caseOffsets[index] = caseBytes.length;
+		_caseLengths[index] = bytes.length;
+		_maximumCaseLength = MAX(_maximumCaseLength, bytes.length);
+
+		[caseBytes appendData:bytes];
+		[strings addObject:[string copy]];
+		[boxes addObject:@(value.integerValue)];
+	}
+
+	_strings = [strings copy];
+	_boxes = [boxes copy];
+
+	_caseBytes = malloc(MAX(caseBytes.length, 1));
+	memcpy(_caseBytes, caseBytes.bytes, caseBytes.length);
+
+	if (![self buildPerfectHash]) {
+		NSMutableDictionary *indexes = [NSMutableDictionary dictionaryWithCapacity:count];
+		[_strings enumerateObjectsUsingBlock:^(NSString *string, NSUInteger index, BOOL *stop) {
+			indexes[string] = @(index);
+		}];
+
+		_fallbackIndexesByString = [indexes copy];
+	}
+
+	_integerSlotMask = MTLEnumMappingPowerOfTwo(MAX(count * 2, 2)) - 1;
+	_integerSlots = malloc((_integerSlotMask + 1) * sizeof(*_integerSlots));
+	memset(_integerSlots, 0xFF, (_integerSlotMask + 1) * sizeof(*_integerSlots));
+
+	for (NSUInteger index = 0; index < count; index++) {
+		uint32_t slot = MTLEnumMappingIntegerSlot(_integers[index], _integerSlotMask);
+		while (_integerSlots[slot] >= 0) slot = (slot + 1) & _integerSlotMask;
+
+		_integerSlots[slot] = (int32_t)index;
+	}
+
+	return self;
+}
+
+// Builds the perfect hash using hash-and-displace: cases are split into
+// buckets by their hash, and buckets are placed largest first by searching for
+// a displacement that moves all of their cases into free slots.
+//
+// Returns whether a perfect hash could be found.
+- (BOOL)buildPerfectHash {
+	NSUInteger count = _strings.count;
+
+	_bucketCount = (uint32_t)MAX((count + 1) / 2, 1);
+	_slotMask = MTLEnumMappingPowerOfTwo(MAX(count * 2, 2)) - 1;
+	_displacements = calloc(_bucketCount, sizeof(*_displacements));
+	_slots = malloc((_slotMask + 1) * sizeof(*_slots));
+	memset(_slots, 0xFF, (_slotMask + 1) * sizeof(*_slots));
+
+	if (count == 0) return YES;
+
+	uint64_t *hashes = malloc(count * sizeof(*hashes));
+	uint32_t *bucketSizes = calloc(_bucketCount, sizeof(*bucketSizes));
+	uint32_t *bucketOrder = malloc(_bucketCount * sizeof(*bucketOrder));
+	uint32_t *members = malloc(count * sizeof(*members));
+	uint32_t *candidateSlots = malloc(count * sizeof(*candidateSlots));
+
+	for (NSUInteger index = 0; index < count; index++) {
+		hashes[index] = MTLEnumMappingHash(_caseBytes + _caseOffsets[index], _caseLengths[index]);
+		bucketSizes[(hashes[index] >> 32) % _bucketCount]++;
+	}
+
+	for (uint32_t bucket = 0; bucket < _bucketCount; bucket++) {
+		bucketOrder[bucket] = bucket;
+	}
+
+	// Insertion sort is plenty for the number of cases in an enum.
+	for (uint32_t i = 1; i < _bucketCount; i++) {
+		uint32_t bucket = bucketOrder[i];
+		uint32_t j = i;
+
+		for (; j > 0 && bucketSizes[bucketOrder[j - 1]] < bucketSizes[bucket]; j--) {
+			bucketOrder[j] = bucketOrder[j - 1];
+		}
+
+		bucketOrder[j] = bucket;
+	}
+
+	BOOL success = YES;
+
+	for (uint32_t i = 0; i < _bucketCount && success; i++) {
+		uint32_t bucket = bucketOrder[i];
+		if (bucketSizes[bucket] == 0) break;
+
+		uint32_t memberCount = 0;
+		for (NSUInteger index = 0; index < count; index++) {
+			if ((hashes[index] >> 32) % _bucketCount == bucket) members[memberCount++] = (uint32_t)index;
+		}
+
+		success = NO;
+
+		for (uint32_t displacement = 0; displacement < MTLEnumMappingMaximumDisplacement && !success; displacement++) {
+			success = YES;
+
+			for (uint32_t m = 0; m < memberCount && success; m++) {
+				uint32_t slot = (uint32_t)MTLEnumMappingMix(hashes[members[m]], displacement) & _slotMask;
+				if (_slots[slot] >= 0) success = NO;
+
+				for (uint32_t previous = 0; previous < m && success; previous++) {
+					if (candidateSlots[previous] == slot) success = NO;
+				}
+
+				candidateSlots[m] = slot;
+			}
+
+			if (success) {
+				_displacements[bucket] = displacement;
+
+				for (uint32_t m = 0; m < memberCount; m++) {
+					_slots[candidateSlots[m]] = (int32_t)members[m];
+				}
+			}
+		}
+	}
+
+	free(hashes);
+	free(bucketSizes);
+	free(bucketOrder);
+	free(members);
+	free(candidateSlots);
+
+	return success;
+}
+
+- (void)dealloc {
+	free(_integers);
+	free(_caseBytes);
+	free(_caseOffsets);
+	free(_caseLengths);
+	free(_displacements);
+	free(_slots);
+	free(_integerSlots);
+}
+
+#pragma mark Lookup
+
+// Returns the index of the case matching `string`, or -1.
+- (NSInteger)indexOfString:(NSString *)string {
+	if (![string isKindOfClass:NSString.class]) return -1;
+
+	// A string can't have fewer UTF-8 bytes than UTF-16 code units.
+	NSUInteger length = string.length;
+	if (length > _maximumCaseLength) return -1;
+
+	if (_fallbackIndexesByString != nil) {
+		NSNumber *index = _fallbackIndexesByString[string];
+		return (index != nil ? index.integerValue : -1);
+	}
+
+	const uint8_t *bytes = (const uint8_t *)CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingASCII);
+	size_t byteLength = length;
+
+	uint8_t buffer[_maximumCaseLength + 1];
+	if (bytes == NULL || strlen((const char *)bytes) != length) {
+		NSUInteger usedLength = 0;
+		NSRange remainingRange = NSMakeRange(0, 0);
+
+		BOOL success = [string getBytes:buffer maxLength:_maximumCaseLength usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, length) remainingRange:&remainingRange];
+		if (!success || remainingRange.length > 0) return -1;
+
+		bytes = buffer;
+		byteLength = usedLength;
+	}
+
+	uint64_t hash = MTLEnumMappingHash(bytes, byteLength);
+	uint32_t displacement = _displacements[(hash >> 32) % _bucketCount];
+	int32_t index = _slots[(uint32_t)MTLEnumMappingMix(hash, displacement) & _slotMask];
+
+	if (index < 0) return -1;
+	if (_caseLengths[index] != byteLength) return -1;
+	if (memcmp(_caseBytes + _caseOffsets[index], bytes, byteLength) != 0) return -1;
+
+	return index;
+}
+
+// Returns the index of the case with the given enum value, or -1.
+- (NSInteger)indexOfIntegerValue:(NSInteger)value {
+	uint32_t slot = MTLEnumMappingIntegerSlot(value, _integerSlotMask);
+
+	for (int32_t index = _integerSlots[slot]; index >= 0; index = _integerSlots[slot]) {
+		if (_integers[index] == value) return index;
+
+		slot = (slot + 1) & _integerSlotMask;
+	}
+
+	return -1;
+}
+
+- (NSInteger)integerValueForString:(NSString *)string found:(BOOL *)found {
+	NSInteger index = [self indexOfString:string];
+	if (found != NULL) *found = (index >= 0);
+
+	return (index >= 0 ? _integers[index] : _defaultValue);
+}
+
+- (NSString *)stringForIntegerValue:(NSInteger)value {
+	NSInteger index = [self indexOfIntegerValue:value];
+
+	return (index >= 0 ? _strings[index] : _reverseDefaultValue);
+}
+
+#pragma mark NSValueTransformer
+
++ (BOOL)allowsReverseTransformation {
+	return YES;
+}
+
++ (Class)transformedValueClass {
+	return NSNumber.class;
+}
+
+- (id)transformedValue:(id)value {
+	NSInteger index = [self indexOfString:value];
+
+	return (index >= 0 ? _boxes[index] : _defaultBox);
+}
+
+- (id)reverseTransformedValue:(id)value {
+	if (![value isKindOfClass:NSNumber.class]) return _reverseDefaultValue;
+
+	NSInteger index = [self indexOfIntegerValue:[value integerValue]];
+	if (index < 0) return _reverseDefaultValue;
+
+	// Guard against non-integral numbers that truncate onto a case.
+	NSNumber *box = _boxes[index];
+	if (box != value && ![box isEqualToNumber:value]) return _reverseDefaultValue;
+
+	return _strings[index];
+}
+
+#pragma mark MTLTransformerErrorHandling
+
+- (id)transformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	if (success != NULL) *success = YES;
+
+	return [self transformedValue:value];
+}
+
+- (id)reverseTransformedValue:(id)value success:(BOOL *)success error:(NSError **)error {
+	if (success != NULL) *success = YES;
+
+	return [self reverseTransformedValue:value];
+}
+
+@end
@@ -0,0 +1,65 @@
+//
+//  MTLJSONAdapter+Metrics.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLJSONAdapter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Records how much time and output each model class and property transformer
+/// accounts for while decoding and encoding JSON.
+///
+/// Recording is process-wide and disabled by default. While disabled, every
+/// recording site costs a single check of a global flag.
+///
+/// Models are recorded by -modelFromJSONDictionary:error: and
+/// -JSONDictionaryFromModel:error:, under the class actually decoded or
+/// encoded, and so are the models nested in them. The time spent on a model
+/// includes the time spent on its nested models. Transformers are recorded for
+/// every property transformed by any decoding or encoding method.
+@interface MTLJSONAdapter (Metrics)
+
+/// Whether metrics are being recorded. Defaults to NO.
++ (BOOL)recordsMetrics;
+
+/// Enables or disables recording metrics.
+///
+/// Disabling recording keeps the counters recorded so far.
++ (void)setRecordsMetrics:(BOOL)recordsMetrics;
+
+/// Returns the counters recorded so far, keyed by the name of the model class.
+///
+/// Every class maps to a dictionary with optional "decode", "encode" and
+/// "properties" keys. "properties" maps the key of every transformed property
+/// to a dictionary with optional "decode" and "encode" keys.
+///
+/// Every "decode" and "encode" dictionary holds:
+///
+///  - "count": The number of calls.
+///  - "failures": The number of calls which failed.
+///  - "totalNanoseconds": The total time spent in the calls.
+///  - "objects": The number of non-nil values produced.
+///  - "bytes": The total length of the strings and data among those values,
+///    an estimate of the size of the payload produced.
+///  - "histogram": An array of dictionaries with "maxNanoseconds" and "count"
+///    keys, counting the calls whose latency was between the previous entry's
+///    "maxNanoseconds" and this one's. Buckets are powers of two, and empty
+///    buckets are omitted.
+///
+/// The snapshot only contains numbers, strings, arrays and dictionaries, so it
+/// can be serialized into JSON as is.
++ (NSDictionary<NSString *, NSDictionary *> *)metricsSnapshot;
+
+/// Returns the result of +metricsSnapshot serialized into JSON.
++ (NSData *)metricsSnapshotJSONData;
+
+/// Discards all counters recorded so far.
++ (void)resetMetrics;
+
+@end
+
+NS_ASSUME_NONNULL_END
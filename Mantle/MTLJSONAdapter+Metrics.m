@@ -0,0 +1,272 @@
+//
+//  MTLJSONAdapter+Metrics.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLJSONAdapter+Metrics.h"
+#import "MTLJSONAdapterMetrics.h"
+
+#ifdef __APPLE__
+#import <mach/mach_time.h>
+#else
+#import <time.h>
+#endif
+
+BOOL MTLJSONAdapterRecordsMetrics = NO;
+
+// The number of latency buckets. Bucket i counts latencies below 2^(i + 1)
+// nanoseconds, and the last bucket every longer latency too.
+#define MTL_METRICS_BUCKET_COUNT 40
+
+// The counters of calls in one direction.
+typedef struct {
+	uint64_t count;
+	uint64_t failures;
+	uint64_t totalNanoseconds;
+	uint64_t objects;
+	uint64_t bytes;
+	uint64_t histogram[MTL_METRICS_BUCKET_COUNT];
+} MTLMetricsCounters;
+
+// Returns the counters as described by +[MTLJSONAdapter metricsSnapshot].
+static NSDictionary *MTLMetricsCountersDictionary(const MTLMetricsCounters *counters) {
+	NSMutableArray *histogram = [NSMutableArray array];
+	for (NSUInteger i = 0; i < MTL_METRICS_BUCKET_COUNT; i++) {
+		if (counters->histogram[i] == 0) continue;
+
+		[histogram addObject:@{
+			@"maxNanoseconds": @((uint64_t)1 << (i + 1)),
+			@"count": @(counters->histogram[i]),
+		}];
+	}
+
+	return @{
+		@"count": @(counters->count),
+		@"failures": @(counters->failures),
+		@"totalNanoseconds": @(counters->totalNanoseconds),
+		@"objects": @(counters->objects),
+		@"bytes": @(counters->bytes),
+		@"histogram": histogram,
+	};
+}
+
+// The counters of a model class or one of its properties.
+@interface MTLMetricsEntry : NSObject
+
+// Returns the counters for `direction`, which may only be read or modified
+// while synchronized on MTLMetricsEntries().
+- (MTLMetricsCounters *)countersForDirection:(MTLMetricsDirection)direction NS_RETURNS_INNER_POINTER;
+
+// The counters as described by +[MTLJSONAdapter metricsSnapshot], with only
+// the directions which have been called.
+- (NSMutableDictionary *)dictionaryValue;
+
+@end
+
+@implementation MTLMetricsEntry {
+	MTLMetricsCounters _counters[2];
+}
+
+- (MTLMetricsCounters *)countersForDirection:(MTLMetricsDirection)direction {
+	return &_counters[direction];
+}
+
+- (NSMutableDictionary *)dictionaryValue {
+	NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+
+	if (_counters[MTLMetricsDirectionDecode].count > 0) {
+		dictionary[@"decode"] = MTLMetricsCountersDictionary(&_counters[MTLMetricsDirectionDecode]);
+	}
+
+	if (_counters[MTLMetricsDirectionEncode].count > 0) {
+		dictionary[@"encode"] = MTLMetricsCountersDictionary(&_counters[MTLMetricsDirectionEncode]);
+	}
+
+	return dictionary;
+}
+
+@end
+
+// The counters of a model class, and of its properties.
+@interface MTLModelMetricsEntry : MTLMetricsEntry
+
+// Maps property keys to their MTLMetricsEntry.
+@property (nonatomic, strong, readonly) NSMutableDictionary *propertyEntries;
+
+@end
+
+@implementation MTLModelMetricsEntry
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_propertyEntries = [NSMutableDictionary dictionary];
+
+	return self;
+}
+
+@end
+
+// Maps model classes to their MTLModelMetricsEntry. Synchronize on this table
+// to read or modify any entry.
+static NSMapTable *MTLMetricsEntries(void) {
+	static NSMapTable *entries;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		entries = [NSMapTable strongToStrongObjectsMapTable];
+	});
+
+	return entries;
+}
+
+// Must be called while synchronized on MTLMetricsEntries().
+static MTLModelMetricsEntry *MTLMetricsEntryForClass(Class modelClass) {
+	NSMapTable *entries = MTLMetricsEntries();
+
+	MTLModelMetricsEntry *entry = [entries objectForKey:modelClass];
+	if (entry == nil) {
+		entry = [[MTLModelMetricsEntry alloc] init];
+		[entries setObject:entry forKey:modelClass];
+	}
+
+	return entry;
+}
+
+uint64_t MTLMetricsTimestamp(void) {
+#ifdef __APPLE__
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * 1000000000 + (uint64_t)time.tv_nsec;
+#endif
+}
+
+// Returns the length of `value` if it's a string or data, and 0 otherwise.
+static uint64_t MTLMetricsPayloadLength(id value) {
+	if ([value isKindOfClass:NSString.class] || [value isKindOfClass:NSData.class]) {
+		return [value length];
+	}
+
+	return 0;
+}
+
+static void MTLMetricsAddCall(MTLMetricsCounters *counters, uint64_t elapsed, BOOL success, uint64_t objects, uint64_t bytes) {
+	NSUInteger bucket = 0;
+	while (bucket < MTL_METRICS_BUCKET_COUNT - 1 && (elapsed >> (bucket + 1)) != 0) {
+		bucket++;
+	}
+
+	counters->count++;
+	counters->totalNanoseconds += elapsed;
+	counters->histogram[bucket]++;
+
+	if (success) {
+		counters->objects += objects;
+		counters->bytes += bytes;
+	} else {
+		counters->failures++;
+	}
+}
+
+void MTLMetricsRecordModel(Class modelClass, MTLMetricsDirection direction, uint64_t startTime, NSDictionary *values) {
+	uint64_t elapsed = MTLMetricsTimestamp() - startTime;
+
+	uint64_t objects = 0;
+	uint64_t bytes = 0;
+	for (id value in values.objectEnumerator) {
+		if (value == NSNull.null) continue;
+
+		objects++;
+		bytes += MTLMetricsPayloadLength(value);
+	}
+
+	NSMapTable *entries = MTLMetricsEntries();
+	@synchronized (entries) {
+		MTLMetricsEntry *entry = MTLMetricsEntryForClass(modelClass);
+		MTLMetricsAddCall([entry countersForDirection:direction], elapsed, values != nil, objects, bytes);
+	}
+}
+
+void MTLMetricsRecordTransformation(Class modelClass, NSString *propertyKey, MTLMetricsDirection direction, uint64_t startTime, BOOL success, id value) {
+	uint64_t elapsed = MTLMetricsTimestamp() - startTime;
+
+	BOOL producedValue = (value != nil && value != NSNull.null);
+	uint64_t bytes = MTLMetricsPayloadLength(value);
+
+	NSMapTable *entries = MTLMetricsEntries();
+	@synchronized (entries) {
+		MTLModelMetricsEntry *modelEntry = MTLMetricsEntryForClass(modelClass);
+
+		MTLMetricsEntry *entry = modelEntry.propertyEntries[propertyKey];
+		if (entry == nil) {
+			entry = [[MTLMetricsEntry alloc] init];
+			modelEntry.propertyEntries[propertyKey] = entry;
+		}
+
+		MTLMetricsAddCall([entry countersForDirection:direction], elapsed, success, (producedValue ? 1 : 0), bytes);
+	}
+}
+
+@implementation MTLJSONAdapter (Metrics)
+
++ (BOOL)recordsMetrics {
+	return MTLJSONAdapterRecordsMetrics;
+}
+
++ (void)setRecordsMetrics:(BOOL)recordsMetrics {
+	MTLJSONAdapterRecordsMetrics = recordsMetrics;
+}
+
++ (NSDictionary *)metricsSnapshot {
+	NSMutableDictionary *snapshot = [NSMutableDictionary dictionary];
+
+	NSMapTable *entries = MTLMetricsEntries();
+	@synchronized (entries) {
+		for (Class modelClass in entries) {
+			MTLModelMetricsEntry *modelEntry = [entries objectForKey:modelClass];
+			NSMutableDictionary *modelDictionary = modelEntry.dictionaryValue;
+
+			if (modelEntry.propertyEntries.count > 0) {
+				NSMutableDictionary *propertyDictionaries = [NSMutableDictionary dictionaryWithCapacity:modelEntry.propertyEntries.count];
+				[modelEntry.propertyEntries enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, MTLMetricsEntry *entry, BOOL *stop) {
+					propertyDictionaries[propertyKey] = entry.dictionaryValue;
+				}];
+
+				modelDictionary[@"properties"] = propertyDictionaries;
+			}
+
+			snapshot[NSStringFromClass(modelClass)] = modelDictionary;
+		}
+	}
+
+	return snapshot;
+}
+
++ (NSData *)metricsSnapshotJSONData {
+	NSError *error = nil;
+	NSData *data = [NSJSONSerialization dataWithJSONObject:self.metricsSnapshot options:0 error:&error];
+	NSAssert(data != nil, @"Could not serialize metrics into JSON: %@", error);
+
+	return data;
+}
+
++ (void)resetMetrics {
+	NSMapTable *entries = MTLMetricsEntries();
+	@synchronized (entries) {
+		[entries removeAllObjects];
+	}
+}
+
+@end
@@ -78,12 +78,78 @@ NS_ASSUME_NONNULL_BEGIN
 /// to abort parsing (e.g., if the data is invalid).
 + (nullable Class)classForParsingJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary;
 
+/// Specifies the JSON key path whose value determines which class to parse a
+/// JSON dictionary as.
+///
+/// This is a declarative alternative to +classForParsingJSONDictionary: for
+/// class clusters that are discriminated by a single JSON value. It must be
+/// implemented together with +classesByDiscriminatorValue. MTLJSONAdapter
+/// compiles both into a lookup table when it is created, so dispatching a
+/// dictionary costs a single hash lookup, and the adapters for every subclass
+/// are created up front.
+///
+/// A subclass in the table may declare a discriminator of its own, in which
+/// case dictionaries dispatched to it are dispatched again through its table.
+///
+/// Returns a JSON key path, like those returned from +JSONKeyPathsByPropertyKey.
++ (NSString *)classDiscriminatorJSONKeyPath;
+
+/// Maps the values found at +classDiscriminatorJSONKeyPath to the classes that
+/// should be parsed for them.
+///
+/// Every class must be the receiver or one of its subclasses, and conform to
+/// <MTLJSONSerializing>.
+///
+/// If the discriminator value of a dictionary is missing or not found in this
+/// dictionary, MTLJSONAdapter falls back to +classForParsingJSONDictionary:
+/// if the receiver implements it, or fails with
+/// MTLJSONAdapterErrorNoClassFound otherwise.
+///
+/// Examples
+///
+///     + (NSString *)classDiscriminatorJSONKeyPath {
+///         return @"type";
+///     }
+///
+///     + (NSDictionary *)classesByDiscriminatorValue {
+///         return @{
+///             @"text": MTLTextMessage.class,
+///             @"image": MTLImageMessage.class
+///         };
+///     }
+///
+/// Returns a dictionary mapping JSON values to model classes.
++ (NSDictionary<id, Class> *)classesByDiscriminatorValue;
+
+/// Whether instances of the receiver cache the JSON dictionary they're
+/// serialized into.
+///
+/// This is meant for models which are serialized repeatedly without changing.
+/// After the first time, MTLJSONAdapter returns the cached dictionary from
+/// -JSONDictionaryFromModel:error:, including when the model is nested within
+/// another one through +dictionaryTransformerWithModelClass:. The cached
+/// dictionary is shared, and must not be mutated.
+///
+/// The cache is discarded whenever a property of the model is set through its
+/// setter or key-value coding. Copies of the model share it. It is not
+/// discarded when a nested model or collection is mutated in place, or when an
+/// instance variable is assigned directly, so the properties of models opting
+/// in should be immutable or replaced through their setters.
+///
+/// Only MTLModel subclasses can cache their JSON. Each model caches the
+/// dictionary of one adapter class at a time, so adapters whose output depends
+/// on anything other than the model shouldn't be used with such models.
+///
+/// Returns whether to cache the JSON dictionary. The default is NO.
++ (BOOL)cachesJSONDictionary;
+
 @end
 
 /// The domain for errors originating from MTLJSONAdapter.
 extern NSString * const MTLJSONAdapterErrorDomain;
 
-/// +classForParsingJSONDictionary: returned nil for the given dictionary.
+/// +classForParsingJSONDictionary: returned nil for the given dictionary, or no
+/// class was found for its discriminator value.
 extern const NSInteger MTLJSONAdapterErrorNoClassFound;
 
 /// The provided JSONDictionary is not valid.
@@ -155,6 +221,9 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 /// model.
 + (nullable NSArray<NSDictionary<NSString *, id> *> *)JSONArrayFromModels:(NSArray<Model> *)models error:(NSError **)error;
 
+/// The MTLModel subclass the receiver was initialized with.
+@property (nonatomic, strong, readonly) Class modelClass;
+
 /// Initializes the receiver with a given model class.
 ///
 /// modelClass - The MTLModel subclass to attempt to parse from the JSON and
@@ -267,8 +336,244 @@ extern NSString * const MTLJSONAdapterThrownExceptionErrorKey;
 
 @end
 
+/// A subset of a model's properties to deserialize from JSON.
+///
+/// Projections are immutable, and can be shared between adapters and threads.
+/// Each adapter a projection is used with works out the mapped keys of the
+/// projection once, and reuses them for every dictionary afterwards.
+@interface MTLJSONProjection : NSObject
+
+/// Creates a projection.
+///
+/// propertyKeys - The property keys to deserialize. Keys which aren't mapped by
+///                the model class being deserialized are ignored. This
+///                argument must not be nil.
++ (instancetype)projectionWithPropertyKeys:(NSSet<NSString *> *)propertyKeys;
+
+/// The property keys to deserialize.
+@property (nonatomic, copy, readonly) NSSet<NSString *> *propertyKeys;
+
+@end
+
+@interface MTLJSONAdapter<Model> (Projection)
+
+/// Deserializes a subset of a model's properties from a JSON dictionary.
+///
+/// Only the JSON values of the projected properties are looked up and
+/// transformed, so transformers of other properties, including those for
+/// nested models, don't run. The other properties are left at their default
+/// values.
+///
+/// Since the model is incomplete, only the projected properties are validated,
+/// and -validate: is not called.
+///
+/// JSONDictionary - A dictionary representing JSON data. This should match the
+///                  format returned by NSJSONSerialization. This argument must
+///                  not be nil.
+/// projection     - The properties to deserialize. This argument must not be
+///                  nil.
+/// error          - If not NULL, this may be set to an error that occurs during
+///                  deserializing or validation.
+///
+/// Returns a model object, or nil if a deserialization error occurred.
+- (nullable __kindof Model)modelFromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary projection:(MTLJSONProjection *)projection error:(NSError **)error;
+
+/// Deserializes a subset of a model's properties from a JSON dictionary.
+///
+/// This is a convenience for -modelFromJSONDictionary:projection:error:. When
+/// deserializing several dictionaries, create the projection once instead.
+- (nullable __kindof Model)modelFromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary propertyKeys:(NSSet<NSString *> *)propertyKeys error:(NSError **)error;
+
+@end
+
+@interface MTLJSONAdapter<Model> (Scanning)
+
+/// Deserializes every dictionary of a JSON array into a reused model object.
+///
+/// This is meant for passes over large arrays which read each model once, for
+/// instance to aggregate some of its values. Instead of creating a model for
+/// every dictionary, one model is created per model class, and its properties
+/// are overwritten for every dictionary. Properties missing from a dictionary
+/// are reset to the values they had after -init. Properties which aren't mapped
+/// by +JSONKeyPathsByPropertyKey are never changed.
+///
+/// The model passed to `block` is only valid until `block` returns. It must not
+/// be modified, and must be copied if it's needed afterwards.
+///
+/// JSONArray  - An array of dictionaries representing JSON data. This should
+///              match the format returned by NSJSONSerialization. This argument
+///              must not be nil.
+/// projection - If not nil, only the properties of this projection are
+///              deserialized, as with -modelFromJSONDictionary:projection:error:.
+/// error      - If not NULL, this may be set to an error that occurs during
+///              deserializing or validation.
+/// block      - Invoked with the model for each dictionary, along with its
+///              index. Setting `stop` to YES ends the enumeration. This
+///              argument must not be nil.
+///
+/// Returns whether every dictionary that was reached was deserialized
+/// successfully.
+- (BOOL)enumerateModelsFromJSONArray:(NSArray<NSDictionary<NSString *, id> *> *)JSONArray projection:(nullable MTLJSONProjection *)projection error:(NSError **)error usingBlock:(void (^)(Model model, NSUInteger index, BOOL *stop))block;
+
+@end
+
 @class MTLModel;
 
+/// Lazily deserialized models, for cases where only a few properties of each
+/// model will ever be read.
+///
+/// A lazy model holds on to its JSON dictionary, and transforms each of its
+/// object properties the first time the property's getter is called. This
+/// includes properties using +dictionaryTransformerWithModelClass: or
+/// +arrayTransformerWithModelClass:, so nested models are only created when
+/// they're read. Properties of primitive types are transformed immediately.
+///
+/// Lazy models are instances of a private subclass of the model class, which
+/// reports the model class from -class. Each property is transformed at most
+/// once, even if it's read from several threads at the same time. Setting a
+/// property before it has been read discards its JSON value. Since the model
+/// isn't completely deserialized when it is returned, -validate: is not called
+/// until the model is materialized.
+///
+/// Methods implemented by the model class which read instance variables
+/// directly should materialize the model first.
+@interface MTLJSONAdapter<Model> (LazyModels)
+
+/// Attempts to parse a JSON dictionary into a lazy model object.
+///
+/// modelClass     - The MTLModel subclass to attempt to parse from the JSON.
+///                  This class must conform to <MTLJSONSerializing>. This
+///                  argument must not be nil.
+/// JSONDictionary - A dictionary representing JSON data. This should match the
+///                  format returned by NSJSONSerialization. This argument must
+///                  not be nil.
+/// error          - If not NULL, this may be set to an error that occurs while
+///                  choosing the class of the model or transforming its
+///                  primitive properties.
+///
+/// Returns a lazy instance of `modelClass`, or nil if an error occurred.
++ (nullable __kindof Model)lazyModelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary error:(NSError **)error;
+
+/// Attempts to parse a JSON dictionary into a lazy model object, using the
+/// receiver's model class.
+///
+/// This behaves like +lazyModelOfClass:fromJSONDictionary:error:.
+- (nullable __kindof Model)lazyModelFromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary error:(NSError **)error;
+
+/// Transforms every property of a lazy model which hasn't been read yet, and
+/// validates the model.
+///
+/// Errors that occur when transforming a property from its getter can't be
+/// reported, so the getter returns nil instead. This method reports the first
+/// such error.
+///
+/// model - The model to materialize. If this isn't a lazy model, it is only
+///         validated. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         transforming or validation.
+///
+/// Returns whether every property was transformed successfully and the model
+/// passed validation.
++ (BOOL)materializeLazyModel:(MTLModel *)model error:(NSError **)error;
+
+/// Whether the given model is a lazy model with properties which haven't been
+/// transformed yet.
++ (BOOL)isLazyModelFault:(MTLModel *)model;
+
+@end
+
+/// Delta serialization, for uploading only the properties which changed, like
+/// in a PATCH request.
+///
+/// See MTLModel+DirtyTracking.h.
+@interface MTLJSONAdapter<Model> (DirtyTracking)
+
+/// Serializes the dirty properties of a model into JSON.
+///
+/// Only the properties in the model's -dirtyPropertyKeys which are mapped by
+/// +JSONKeyPathsByPropertyKey and kept by -serializablePropertyKeys:forModel:
+/// are read and transformed, so the cost scales with the number of changed
+/// properties. A property mapped to a nested key path, like "meta.title", is
+/// serialized into nested dictionaries which only contain the dirty
+/// properties. Properties set to nil are serialized as NSNull.
+///
+/// The model is not marked clean. Call -snapshotDirtyPropertyKeys once the
+/// changes have been saved.
+///
+/// model - The model to serialize. Its class must return YES from
+///         +tracksDirtyPropertyKeys. This argument must not be nil.
+/// error - If not NULL, this may be set to an error that occurs during
+///         serializing.
+///
+/// Returns a JSON dictionary, which is empty if no mapped properties are
+/// dirty, or nil if a serialization error occurred.
+- (nullable NSDictionary<NSString *, id> *)JSONDictionaryFromDirtyPropertiesOfModel:(Model)model error:(NSError **)error;
+
+/// Serializes the dirty properties of a model into JSON, using an adapter for
+/// the model's class.
+///
+/// This behaves like -JSONDictionaryFromDirtyPropertiesOfModel:error:.
++ (nullable NSDictionary<NSString *, id> *)JSONDictionaryFromDirtyPropertiesOfModel:(Model)model error:(NSError **)error;
+
+@end
+
+/// Options for applying partial JSON dictionaries to models.
+typedef NS_OPTIONS(NSUInteger, MTLJSONPatchOptions) {
+	MTLJSONPatchOptionsNone = 0,
+
+	/// Treats the dictionary as an RFC 7386 JSON merge patch.
+	///
+	/// A null value removes a member, restoring the properties mapped to it,
+	/// or to key paths within it, to their values on a newly initialized
+	/// model. A dictionary for a property holding a model conforming to
+	/// <MTLJSONSerializing> is merged into a copy of that model recursively,
+	/// instead of replacing it.
+	///
+	/// Without this option, a null value is transformed like any other.
+	MTLJSONPatchOptionsMergePatch = 1 << 0,
+};
+
+/// Applying partial updates, like the body of a PATCH response or a pushed
+/// change, to models which have already been deserialized.
+@interface MTLJSONAdapter<Model> (Patching)
+
+/// Updates a model with the values in a partial JSON dictionary.
+///
+/// Only the properties whose JSON key paths are present in the dictionary are
+/// transformed, validated and set, so the cost scales with the size of the
+/// patch rather than the model. A property mapped to several key paths is
+/// updated if any of them is present, and should be patched with all of them.
+/// Class discriminators in the dictionary are ignored, since the class of
+/// `model` can't change.
+///
+/// If the model class overrides -validate:, it is called after setting the
+/// properties. If transforming or validation fails, the model is left
+/// unchanged.
+///
+/// Patched properties are marked clean, if the model tracks dirty properties.
+///
+/// model          - The model to update. This must be an instance of the
+///                  receiver's model class or one of its subclasses, and must
+///                  not be nil.
+/// JSONDictionary - The properties to update, in the format returned by
+///                  NSJSONSerialization. This argument must not be nil.
+/// options        - How to interpret the dictionary.
+/// error          - If not NULL, this may be set to an error that occurs
+///                  during transforming or validation.
+///
+/// Returns whether the model was updated.
+- (BOOL)updateModel:(Model)model fromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary options:(MTLJSONPatchOptions)options error:(NSError **)error;
+
+/// Returns a copy of a model updated with the values in a partial JSON
+/// dictionary, leaving the model itself untouched.
+///
+/// This behaves like -updateModel:fromJSONDictionary:options:error:.
+///
+/// Returns the updated copy, or nil if transforming or validation failed.
+- (nullable __kindof Model)modelByUpdatingModel:(Model)model fromJSONDictionary:(NSDictionary<NSString *, id> *)JSONDictionary options:(MTLJSONPatchOptions)options error:(NSError **)error;
+
+@end
+
 @interface MTLJSONAdapter (Deprecated)
 
 @property (nonatomic, strong, readonly) id<MTLJSONSerializing> model MANTLE_UNAVAILABLE("Replaced by -modelFromJSONDictionary:error:");
@@ -13,11 +13,16 @@
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/EXTScope.h>
 #import "MTLJSONAdapter.h"
+#import "MTLJSONAdapterMetrics.h"
 #import "MTLModel.h"
+#import "MTLModel+DirtyTracking.h"
+#import "MTLModelDirtyTracking.h"
 #import "MTLTransformerErrorHandling.h"
 #import "MTLReflection.h"
+#import "MTLTracing.h"
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
 #import "MTLValueTransformer.h"
+#import "NSKeyValueCoding+MTLValidationAdditions.h"
 
 NSString * const MTLJSONAdapterErrorDomain = @"MTLJSONAdapterErrorDomain";
 const NSInteger MTLJSONAdapterErrorNoClassFound = 2;
@@ -42,9 +47,74 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 // A cached copy of the return value of -valueTransformersForModelClass:
 @property (nonatomic, copy, readonly) NSDictionary *valueTransformersByPropertyKey;
 
+// Whether the model class caches the JSON dictionaries of its instances.
+@property (nonatomic, assign, readonly) BOOL cachesJSONDictionary;
+
 // Used to cache the JSON adapters returned by -JSONAdapterForModelClass:error:.
 @property (nonatomic, strong, readonly) NSMapTable *JSONAdaptersByModelClass;
 
+// The components of +classDiscriminatorJSONKeyPath, or nil if the model class
+// does not declare a class discriminator.
+@property (nonatomic, copy, readonly) NSArray *classDiscriminatorKeyPathComponents;
+
+// Maps the values of +classesByDiscriminatorValue to the adapters for their
+// classes. Values mapping to the receiver's own model class map to NSNull.
+@property (nonatomic, copy, readonly) NSDictionary *JSONAdaptersByDiscriminatorValue;
+
+// Maps the subclasses listed in +classesByDiscriminatorValue to their
+// adapters.
+@property (nonatomic, copy, readonly) NSDictionary *JSONAdaptersByDiscriminatedClass;
+
+// Maps the first component of every JSON key path in
+// +JSONKeyPathsByPropertyKey to the property keys mapped to it. Created on
+// first use.
+@property (nonatomic, copy, readonly) NSDictionary *propertyKeysByJSONKey;
+
+// Maps the first component of every JSON key path with more than one
+// component to the same mapping for the rest of the key path, without its
+// last component. These are the nested dictionaries created by
+// -JSONDictionaryFromDictionaryValue:error:. Created on first use.
+@property (nonatomic, copy, readonly) NSDictionary *JSONContainerKeys;
+
+// Builds the model for a dictionary which has already been dispatched to the
+// receiver's model class.
+- (id)modelFromDispatchedJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
+// Like -modelFromDispatchedJSONDictionary:error:, but also returns the
+// property values the model was built from, if `dictionaryValuePtr` is not
+// NULL.
+- (id)modelFromDispatchedJSONDictionary:(NSDictionary *)JSONDictionary dictionaryValue:(NSDictionary **)dictionaryValuePtr error:(NSError **)error;
+
+// Serializes the given property values of a model of the receiver's model
+// class into JSON.
+//
+// dictionaryValue - The values of the properties to serialize, with nil values
+//                   represented by NSNull.
+// error           - If not NULL, this may be set to an error that occurs
+//                   during transforming.
+//
+// Returns a JSON dictionary, or nil if an error occurred.
+- (NSDictionary *)JSONDictionaryFromDictionaryValue:(NSDictionary *)dictionaryValue error:(NSError **)error;
+
+// Returns the adapter which should deserialize the given JSON dictionary,
+// according to the class discriminator and +classForParsingJSONDictionary:.
+//
+// Returns the receiver, another adapter, or nil if an error occurred.
+- (MTLJSONAdapter *)dispatchedJSONAdapterForJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
+// Extracts and transforms the value of a property from a JSON dictionary.
+//
+// valuePtr       - Set to the transformed value, NSNull if the transformer
+//                  returned nil, or nil if the property isn't mapped or is
+//                  missing from the dictionary.
+// propertyKey    - The property to extract.
+// JSONDictionary - The JSON dictionary to extract from.
+// error          - If not NULL, this may be set to an error that occurs during
+//                  extracting or transforming.
+//
+// Returns whether the value was extracted and transformed successfully.
+- (BOOL)getValue:(id *)valuePtr forPropertyKey:(NSString *)propertyKey fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
 // If +classForParsingJSONDictionary: returns a model class different from the
 // one this adapter was initialized with, use this method to obtain a cached
 // instance of a suitable adapter instead.
@@ -69,8 +139,76 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 @end
 
+// Returns an error for a JSON dictionary no model class could be found for.
+static NSError *MTLNoClassFoundError(void) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: NSLocalizedString(@"Could not parse JSON", @""),
+		NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"")
+	};
+
+	return [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound userInfo:userInfo];
+}
+
+// Returns the value at the key path made up of `components` within
+// `JSONDictionary`, or nil if any part of the key path is missing.
+static id MTLClassDiscriminatorValue(NSDictionary *JSONDictionary, NSArray *components) {
+	id value = JSONDictionary;
+
+	for (NSString *component in components) {
+		if (![value isKindOfClass:NSDictionary.class]) return nil;
+
+		value = value[component];
+	}
+
+	return value;
+}
+
+// Returns an immutable copy of a JSON dictionary serialized by an adapter,
+// copying the nested dictionaries it created for key paths too, so that it
+// can be shared between callers.
+//
+// containerKeys - Maps the keys of the nested dictionaries to their own
+//                 containerKeys, as returned by -JSONContainerKeys. Values
+//                 returned by transformers are left alone.
+static NSDictionary *MTLImmutableJSONDictionary(NSDictionary *JSONDictionary, NSDictionary *containerKeys) {
+	if (containerKeys.count == 0) return [JSONDictionary copy];
+
+	NSMutableDictionary *dictionary = [JSONDictionary mutableCopy];
+	[containerKeys enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSDictionary *nestedContainerKeys, BOOL *stop) {
+		NSDictionary *container = JSONDictionary[key];
+		if (![container isKindOfClass:NSDictionary.class]) return;
+
+		dictionary[key] = MTLImmutableJSONDictionary(container, nestedContainerKeys);
+	}];
+
+	return [dictionary copy];
+}
+
+// Returns whether `modelClass` declares a class discriminator itself, rather
+// than inheriting the one of a superclass, whose table lists the superclass
+// and the siblings of `modelClass`.
+static BOOL MTLDeclaresClassDiscriminator(Class modelClass) {
+	if (![modelClass respondsToSelector:@selector(classDiscriminatorJSONKeyPath)]) return NO;
+
+	Class superclass = class_getSuperclass(modelClass);
+	if (![superclass respondsToSelector:@selector(classDiscriminatorJSONKeyPath)]) return YES;
+
+	Class metaclass = object_getClass(modelClass);
+	Class superMetaclass = object_getClass(superclass);
+
+	SEL selectors[] = { @selector(classDiscriminatorJSONKeyPath), @selector(classesByDiscriminatorValue) };
+	for (size_t i = 0; i < sizeof(selectors) / sizeof(*selectors); i++) {
+		if (class_getMethodImplementation(metaclass, selectors[i]) != class_getMethodImplementation(superMetaclass, selectors[i])) return YES;
+	}
+
+	return NO;
+}
+
 @implementation MTLJSONAdapter
 
+@synthesize propertyKeysByJSONKey = _propertyKeysByJSONKey;
+@synthesize JSONContainerKeys = _JSONContainerKeys;
+
 #pragma mark Convenience methods
 
 + (id)modelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
@@ -91,9 +229,11 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 		return nil;
 	}
 
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:modelClass];
+
 	NSMutableArray *models = [NSMutableArray arrayWithCapacity:JSONArray.count];
 	for (NSDictionary *JSONDictionary in JSONArray){
-		MTLModel *model = [self modelOfClass:modelClass fromJSONDictionary:JSONDictionary error:error];
+		MTLModel *model = [adapter modelFromJSONDictionary:JSONDictionary error:error];
 
 		if (model == nil) return nil;
 
@@ -166,9 +306,46 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	}
 
 	_valueTransformersByPropertyKey = [self.class valueTransformersForModelClass:modelClass];
+	_cachesJSONDictionary = [modelClass isSubclassOfClass:MTLModel.class] && [modelClass respondsToSelector:@selector(cachesJSONDictionary)] && [modelClass cachesJSONDictionary];
 
 	_JSONAdaptersByModelClass = [NSMapTable strongToStrongObjectsMapTable];
 
+	if (MTLDeclaresClassDiscriminator(modelClass)) {
+		NSAssert([modelClass respondsToSelector:@selector(classesByDiscriminatorValue)], @"%@ implements +classDiscriminatorJSONKeyPath but not +classesByDiscriminatorValue.", modelClass);
+
+		NSDictionary *classesByDiscriminatorValue = [modelClass classesByDiscriminatorValue];
+		NSMutableDictionary *adaptersByValue = [[NSMutableDictionary alloc] initWithCapacity:classesByDiscriminatorValue.count];
+		NSMutableDictionary *adaptersByClass = [[NSMutableDictionary alloc] initWithCapacity:classesByDiscriminatorValue.count];
+
+		for (id discriminatorValue in classesByDiscriminatorValue) {
+			Class class = classesByDiscriminatorValue[discriminatorValue];
+
+			if (class == modelClass) {
+				adaptersByValue[discriminatorValue] = NSNull.null;
+				continue;
+			}
+
+			if (![class isSubclassOfClass:modelClass] || ![class conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+				NSAssert(NO, @"%@ returned from +classesByDiscriminatorValue for %@ must be a subclass of %@ conforming to <MTLJSONSerializing>.", class, discriminatorValue, modelClass);
+				return nil;
+			}
+
+			MTLJSONAdapter *adapter = adaptersByClass[class];
+			if (adapter == nil) {
+				adapter = [[self.class alloc] initWithModelClass:class];
+				if (adapter == nil) return nil;
+
+				adaptersByClass[(id<NSCopying>)class] = adapter;
+			}
+
+			adaptersByValue[discriminatorValue] = adapter;
+		}
+
+		_classDiscriminatorKeyPathComponents = [[modelClass classDiscriminatorJSONKeyPath] componentsSeparatedByString:@"."];
+		_JSONAdaptersByDiscriminatorValue = [adaptersByValue copy];
+		_JSONAdaptersByDiscriminatedClass = [adaptersByClass copy];
+	}
+
 	return self;
 }
 
@@ -179,14 +356,45 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	NSParameterAssert([model isKindOfClass:self.modelClass]);
 
 	if (self.modelClass != model.class) {
-		MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:model.class error:error];
+		MTLJSONAdapter *otherAdapter = self.JSONAdaptersByDiscriminatedClass[model.class] ?: [self JSONAdapterForModelClass:model.class error:error];
 
 		return [otherAdapter JSONDictionaryFromModel:model error:error];
 	}
 
+	MTL_PROBE1(encode__start, class_getName(self.modelClass));
+
+	BOOL recordsMetrics = MTLJSONAdapterRecordsMetrics;
+	uint64_t startTime = (recordsMetrics ? MTLMetricsTimestamp() : 0);
+
+	if (self.cachesJSONDictionary) {
+		NSDictionary *cachedDictionary = MTLModelCachedJSONDictionary(model, self.class);
+		if (cachedDictionary != nil) {
+			if (recordsMetrics) MTLMetricsRecordModel(self.modelClass, MTLMetricsDirectionEncode, startTime, cachedDictionary);
+			MTL_PROBE2(encode__done, class_getName(self.modelClass), 1);
+
+			return cachedDictionary;
+		}
+	}
+
 	NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:[NSSet setWithArray:self.JSONKeyPathsByPropertyKey.allKeys] forModel:model];
 
 	NSDictionary *dictionaryValue = [model.dictionaryValue dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
+	NSDictionary *JSONDictionary = [self JSONDictionaryFromDictionaryValue:dictionaryValue error:error];
+
+	if (self.cachesJSONDictionary && JSONDictionary != nil) {
+		// The nested dictionaries built for key paths are mutable, and the
+		// cached dictionary is shared by every caller.
+		JSONDictionary = MTLImmutableJSONDictionary(JSONDictionary, self.JSONContainerKeys);
+		MTLModelCacheJSONDictionary(model, self.class, JSONDictionary);
+	}
+
+	if (recordsMetrics) MTLMetricsRecordModel(self.modelClass, MTLMetricsDirectionEncode, startTime, JSONDictionary);
+	MTL_PROBE2(encode__done, class_getName(self.modelClass), JSONDictionary != nil);
+
+	return JSONDictionary;
+}
+
+- (NSDictionary *)JSONDictionaryFromDictionaryValue:(NSDictionary *)dictionaryValue error:(NSError **)error {
 	NSMutableDictionary *JSONDictionary = [[NSMutableDictionary alloc] initWithCapacity:dictionaryValue.count];
 
 	__block BOOL success = YES;
@@ -199,6 +407,11 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 		NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
 		if ([transformer.class allowsReverseTransformation]) {
+			MTL_PROBE3(transform__start, class_getName(self.modelClass), propertyKey.UTF8String, 1);
+
+			BOOL recordsMetrics = MTLJSONAdapterRecordsMetrics;
+			uint64_t startTime = (recordsMetrics ? MTLMetricsTimestamp() : 0);
+
 			// Map NSNull -> nil for the transformer, and then back for the
 			// dictionaryValue we're going to insert into.
 			if ([value isEqual:NSNull.null]) value = nil;
@@ -209,12 +422,18 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 				value = [errorHandlingTransformer reverseTransformedValue:value success:&success error:&tmpError];
 
 				if (!success) {
+					if (recordsMetrics) MTLMetricsRecordTransformation(self.modelClass, propertyKey, MTLMetricsDirectionEncode, startTime, NO, nil);
+					MTL_PROBE4(transform__done, class_getName(self.modelClass), propertyKey.UTF8String, 1, 0);
+
 					*stop = YES;
 					return;
 				}
 			} else {
 				value = [transformer reverseTransformedValue:value] ?: NSNull.null;
 			}
+
+			if (recordsMetrics) MTLMetricsRecordTransformation(self.modelClass, propertyKey, MTLMetricsDirectionEncode, startTime, YES, value);
+			MTL_PROBE4(transform__done, class_getName(self.modelClass), propertyKey.UTF8String, 1, 1);
 		}
 
 		void (^createComponents)(id, NSString *) = ^(id obj, NSString *keyPath) {
@@ -257,17 +476,40 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 }
 
 - (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
-	if ([self.modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) {
+	MTL_PROBE1(decode__start, class_getName(self.modelClass));
+
+	MTLJSONAdapter *adapter = [self dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:error];
+	id model = [adapter modelFromDispatchedJSONDictionary:JSONDictionary error:error];
+
+	MTL_PROBE2(decode__done, class_getName(self.modelClass), model != nil);
+	return model;
+}
+
+- (MTLJSONAdapter *)dispatchedJSONAdapterForJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	BOOL parsesClassCluster = [self.modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)];
+
+	if (self.classDiscriminatorKeyPathComponents != nil) {
+		id discriminatorValue = MTLClassDiscriminatorValue(JSONDictionary, self.classDiscriminatorKeyPathComponents);
+		MTLJSONAdapter *adapter = (discriminatorValue != nil ? self.JSONAdaptersByDiscriminatorValue[discriminatorValue] : nil);
+
+		if (adapter == (id)NSNull.null) {
+			return self;
+		} else if (adapter != nil) {
+			// The subclass may declare a discriminator of its own.
+			if (adapter.classDiscriminatorKeyPathComponents == nil) return adapter;
+
+			return [adapter dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:error];
+		} else if (!parsesClassCluster) {
+			if (error != NULL) *error = MTLNoClassFoundError();
+
+			return nil;
+		}
+	}
+
+	if (parsesClassCluster) {
 		Class class = [self.modelClass classForParsingJSONDictionary:JSONDictionary];
 		if (class == nil) {
-			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not parse JSON", @""),
-					NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"No model class could be found to parse the JSON dictionary.", @"")
-				};
-
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorNoClassFound userInfo:userInfo];
-			}
+			if (error != NULL) *error = MTLNoClassFoundError();
 
 			return nil;
 		}
@@ -277,87 +519,134 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 			MTLJSONAdapter *otherAdapter = [self JSONAdapterForModelClass:class error:error];
 
-			return [otherAdapter modelFromJSONDictionary:JSONDictionary error:error];
+			return [otherAdapter dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:error];
 		}
 	}
 
+	return self;
+}
+
+- (id)modelFromDispatchedJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	if (!MTLJSONAdapterRecordsMetrics) return [self modelFromDispatchedJSONDictionary:JSONDictionary dictionaryValue:NULL error:error];
+
+	uint64_t startTime = MTLMetricsTimestamp();
+
+	NSDictionary *dictionaryValue = nil;
+	id model = [self modelFromDispatchedJSONDictionary:JSONDictionary dictionaryValue:&dictionaryValue error:error];
+
+	MTLMetricsRecordModel(self.modelClass, MTLMetricsDirectionDecode, startTime, (model != nil ? dictionaryValue : nil));
+	return model;
+}
+
+- (id)modelFromDispatchedJSONDictionary:(NSDictionary *)JSONDictionary dictionaryValue:(NSDictionary **)dictionaryValuePtr error:(NSError **)error {
 	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
 
 	for (NSString *propertyKey in [self.modelClass propertyKeys]) {
-		id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+		id value = nil;
+		if (![self getValue:&value forPropertyKey:propertyKey fromJSONDictionary:JSONDictionary error:error]) return nil;
 
-		if (JSONKeyPaths == nil) continue;
+		if (value == nil) continue;
 
-		id value;
+		dictionaryValue[propertyKey] = value;
+	}
 
-		if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
-			NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+	if (![model validate:error]) return nil;
 
-			for (NSString *keyPath in JSONKeyPaths) {
-				BOOL success = NO;
-				id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:&success error:error];
+	MTLModelDiscardDirtyPropertyKeys(model);
 
-				if (!success) return nil;
+	if (dictionaryValuePtr != NULL) *dictionaryValuePtr = dictionaryValue;
+	return model;
+}
 
-				if (value != nil) dictionary[keyPath] = value;
-			}
+- (BOOL)getValue:(id *)valuePtr forPropertyKey:(NSString *)propertyKey fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	*valuePtr = nil;
 
-			value = dictionary;
-		} else {
+	id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+
+	if (JSONKeyPaths == nil) return YES;
+
+	id value;
+
+	if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
+		NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+
+		for (NSString *keyPath in JSONKeyPaths) {
 			BOOL success = NO;
-			value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
+			id value = [JSONDictionary mtl_valueForJSONKeyPath:keyPath success:&success error:error];
 
-			if (!success) return nil;
+			if (!success) return NO;
+
+			if (value != nil) dictionary[keyPath] = value;
 		}
 
-		if (value == nil) continue;
+		value = dictionary;
+	} else {
+		BOOL success = NO;
+		value = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
 
-		@try {
-			NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
-			if (transformer != nil) {
-				// Map NSNull -> nil for the transformer, and then back for the
-				// dictionary we're going to insert into.
-				if ([value isEqual:NSNull.null]) value = nil;
+		if (!success) return NO;
+	}
 
-				if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
-					id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
+	if (value == nil) return YES;
 
-					BOOL success = YES;
-					value = [errorHandlingTransformer transformedValue:value success:&success error:error];
+	@try {
+		NSValueTransformer *transformer = self.valueTransformersByPropertyKey[propertyKey];
+		if (transformer != nil) {
+			MTL_PROBE3(transform__start, class_getName(self.modelClass), propertyKey.UTF8String, 0);
 
-					if (!success) return nil;
-				} else {
-					value = [transformer transformedValue:value];
-				}
+			BOOL recordsMetrics = MTLJSONAdapterRecordsMetrics;
+			uint64_t startTime = (recordsMetrics ? MTLMetricsTimestamp() : 0);
 
-				if (value == nil) value = NSNull.null;
-			}
+			// Map NSNull -> nil for the transformer, and then back for the
+			// dictionary we're going to insert into.
+			if ([value isEqual:NSNull.null]) value = nil;
+
+			if ([transformer respondsToSelector:@selector(transformedValue:success:error:)]) {
+				id<MTLTransformerErrorHandling> errorHandlingTransformer = (id)transformer;
 
-			dictionaryValue[propertyKey] = value;
-		} @catch (NSException *ex) {
-			NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", ex, JSONKeyPaths, JSONDictionary);
+				BOOL success = YES;
+				value = [errorHandlingTransformer transformedValue:value success:&success error:error];
 
-			// Fail fast in Debug builds.
-			if (MTLIsDebugging()) {
-				@throw ex;
-			} else if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Caught exception parsing JSON key path \"%@\" for model class: %@", JSONKeyPaths, self.modelClass],
-					NSLocalizedRecoverySuggestionErrorKey: ex.description,
-					NSLocalizedFailureReasonErrorKey: ex.reason,
-					MTLJSONAdapterThrownExceptionErrorKey: ex
-				};
+				if (!success) {
+					if (recordsMetrics) MTLMetricsRecordTransformation(self.modelClass, propertyKey, MTLMetricsDirectionDecode, startTime, NO, nil);
+					MTL_PROBE4(transform__done, class_getName(self.modelClass), propertyKey.UTF8String, 0, 0);
 
-				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorExceptionThrown userInfo:userInfo];
+					return NO;
+				}
+			} else {
+				value = [transformer transformedValue:value];
 			}
 
-			return nil;
+			if (recordsMetrics) MTLMetricsRecordTransformation(self.modelClass, propertyKey, MTLMetricsDirectionDecode, startTime, YES, value);
+			MTL_PROBE4(transform__done, class_getName(self.modelClass), propertyKey.UTF8String, 0, 1);
+
+			if (value == nil) value = NSNull.null;
 		}
-	}
 
-	id model = [self.modelClass modelWithDictionary:dictionaryValue error:error];
+		*valuePtr = value;
+		return YES;
+	} @catch (NSException *ex) {
+		MTL_PROBE4(transform__done, class_getName(self.modelClass), propertyKey.UTF8String, 0, 0);
+
+		NSLog(@"*** Caught exception %@ parsing JSON key path \"%@\" from: %@", ex, JSONKeyPaths, JSONDictionary);
 
-	return [model validate:error] ? model : nil;
+		// Fail fast in Debug builds.
+		if (MTLIsDebugging()) {
+			@throw ex;
+		} else if (error != NULL) {
+			NSDictionary *userInfo = @{
+				NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Caught exception parsing JSON key path \"%@\" for model class: %@", JSONKeyPaths, self.modelClass],
+				NSLocalizedRecoverySuggestionErrorKey: ex.description,
+				NSLocalizedFailureReasonErrorKey: ex.reason,
+				MTLJSONAdapterThrownExceptionErrorKey: ex
+			};
+
+			*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorExceptionThrown userInfo:userInfo];
+		}
+
+		return NO;
+	}
 }
 
 + (NSDictionary *)valueTransformersForModelClass:(Class)modelClass {
@@ -431,6 +720,8 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 		if (result != nil) return result;
 
+		MTL_PROBE2(cache__miss, class_getName(modelClass), "JSONAdapter");
+
 		result = [[self.class alloc] initWithModelClass:modelClass];
 
 		if (result != nil) {
@@ -441,6 +732,63 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 	}
 }
 
+- (NSDictionary *)propertyKeysByJSONKey {
+	@synchronized (self) {
+		if (_propertyKeysByJSONKey != nil) return _propertyKeysByJSONKey;
+
+		NSMutableDictionary *propertyKeysByJSONKey = [NSMutableDictionary dictionary];
+
+		[self.JSONKeyPathsByPropertyKey enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, id JSONKeyPaths, BOOL *stop) {
+			NSArray *keyPaths = ([JSONKeyPaths isKindOfClass:NSArray.class] ? JSONKeyPaths : @[ JSONKeyPaths ]);
+
+			for (NSString *keyPath in keyPaths) {
+				NSString *JSONKey = [keyPath componentsSeparatedByString:@"."].firstObject;
+
+				NSMutableArray *propertyKeys = propertyKeysByJSONKey[JSONKey];
+				if (propertyKeys == nil) {
+					propertyKeys = [NSMutableArray array];
+					propertyKeysByJSONKey[JSONKey] = propertyKeys;
+				}
+
+				if (![propertyKeys containsObject:propertyKey]) [propertyKeys addObject:propertyKey];
+			}
+		}];
+
+		_propertyKeysByJSONKey = [propertyKeysByJSONKey copy];
+		return _propertyKeysByJSONKey;
+	}
+}
+
+- (NSDictionary *)JSONContainerKeys {
+	@synchronized (self) {
+		if (_JSONContainerKeys != nil) return _JSONContainerKeys;
+
+		NSMutableDictionary *JSONContainerKeys = [NSMutableDictionary dictionary];
+
+		[self.JSONKeyPathsByPropertyKey enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, id JSONKeyPaths, BOOL *stop) {
+			NSArray *keyPaths = ([JSONKeyPaths isKindOfClass:NSArray.class] ? JSONKeyPaths : @[ JSONKeyPaths ]);
+
+			for (NSString *keyPath in keyPaths) {
+				NSArray *components = [keyPath componentsSeparatedByString:@"."];
+				NSMutableDictionary *containerKeys = JSONContainerKeys;
+
+				for (NSUInteger i = 0; i + 1 < components.count; i++) {
+					NSMutableDictionary *nestedContainerKeys = containerKeys[components[i]];
+					if (nestedContainerKeys == nil) {
+						nestedContainerKeys = [NSMutableDictionary dictionary];
+						containerKeys[components[i]] = nestedContainerKeys;
+					}
+
+					containerKeys = nestedContainerKeys;
+				}
+			}
+		}];
+
+		_JSONContainerKeys = [JSONContainerKeys copy];
+		return _JSONContainerKeys;
+	}
+}
+
 - (NSSet *)serializablePropertyKeys:(NSSet *)propertyKeys forModel:(id<MTLJSONSerializing>)model {
 	return propertyKeys;
 }
@@ -644,6 +992,698 @@ NSString * const MTLJSONAdapterThrownExceptionErrorKey = @"MTLJSONAdapterThrownE
 
 @end
 
+@interface MTLJSONProjection ()
+
+// Returns the projected property keys which `adapter` maps, in the order of
+// the adapter's model class' +propertyKeys, computing them if necessary.
+- (NSArray *)mappedPropertyKeysForJSONAdapter:(MTLJSONAdapter *)adapter;
+
+@end
+
+@implementation MTLJSONProjection {
+	// Maps adapters to the result of -mappedPropertyKeysForJSONAdapter:.
+	NSMapTable *_mappedPropertyKeysByJSONAdapter;
+}
+
++ (instancetype)projectionWithPropertyKeys:(NSSet *)propertyKeys {
+	NSParameterAssert(propertyKeys != nil);
+
+	MTLJSONProjection *projection = [[self alloc] init];
+	projection->_propertyKeys = [propertyKeys copy];
+	projection->_mappedPropertyKeysByJSONAdapter = [NSMapTable weakToStrongObjectsMapTable];
+
+	return projection;
+}
+
+- (NSArray *)mappedPropertyKeysForJSONAdapter:(MTLJSONAdapter *)adapter {
+	@synchronized (self) {
+		NSArray *mappedPropertyKeys = [_mappedPropertyKeysByJSONAdapter objectForKey:adapter];
+		if (mappedPropertyKeys != nil) return mappedPropertyKeys;
+
+		NSMutableArray *keys = [NSMutableArray arrayWithCapacity:self.propertyKeys.count];
+		for (NSString *propertyKey in [adapter.modelClass propertyKeys]) {
+			if (![self.propertyKeys containsObject:propertyKey]) continue;
+			if (adapter.JSONKeyPathsByPropertyKey[propertyKey] == nil) continue;
+
+			[keys addObject:propertyKey];
+		}
+
+		mappedPropertyKeys = [keys copy];
+		[_mappedPropertyKeysByJSONAdapter setObject:mappedPropertyKeys forKey:adapter];
+
+		return mappedPropertyKeys;
+	}
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@", self.class, self, self.propertyKeys.allObjects];
+}
+
+@end
+
+@implementation MTLJSONAdapter (Projection)
+
+- (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary projection:(MTLJSONProjection *)projection error:(NSError **)error {
+	NSParameterAssert(projection != nil);
+
+	MTLJSONAdapter *adapter = [self dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:error];
+	if (adapter == nil) return nil;
+
+	NSArray *propertyKeys = [projection mappedPropertyKeysForJSONAdapter:adapter];
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+	for (NSString *propertyKey in propertyKeys) {
+		id value = nil;
+		if (![adapter getValue:&value forPropertyKey:propertyKey fromJSONDictionary:JSONDictionary error:error]) return nil;
+
+		if (value == nil) continue;
+
+		dictionaryValue[propertyKey] = value;
+	}
+
+	id model = [adapter.modelClass modelWithDictionary:dictionaryValue error:error];
+	MTLModelDiscardDirtyPropertyKeys(model);
+
+	return model;
+}
+
+- (id)modelFromJSONDictionary:(NSDictionary *)JSONDictionary propertyKeys:(NSSet *)propertyKeys error:(NSError **)error {
+	return [self modelFromJSONDictionary:JSONDictionary projection:[MTLJSONProjection projectionWithPropertyKeys:propertyKeys] error:error];
+}
+
+@end
+
+// The reused model of one model class while enumerating a JSON array.
+@interface MTLJSONScanState : NSObject
+
+- (instancetype)initWithJSONAdapter:(MTLJSONAdapter *)adapter projection:(MTLJSONProjection *)projection;
+
+// Overwrites the properties of `model` with the values from a dictionary.
+//
+// Returns whether deserializing and validation succeeded. On failure, the
+// properties are reset to their default values, rather than left partially
+// overwritten.
+- (BOOL)fillModelWithJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error;
+
+@property (nonatomic, strong, readonly) MTLModel *model;
+
+@end
+
+@implementation MTLJSONScanState {
+	MTLJSONAdapter *_adapter;
+
+	// The property keys to overwrite, and the values to restore them to when
+	// they're missing from a dictionary.
+	NSArray *_propertyKeys;
+	NSArray *_defaultValues;
+
+	// Whether the model class overrides -validate:. Otherwise
+	// MTLValidateAndSetValue() already validated every property that changed.
+	BOOL _validatesModel;
+}
+
+- (instancetype)initWithJSONAdapter:(MTLJSONAdapter *)adapter projection:(MTLJSONProjection *)projection {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_adapter = adapter;
+	_model = [[adapter.modelClass alloc] init];
+
+	if (projection != nil) {
+		_propertyKeys = [projection mappedPropertyKeysForJSONAdapter:adapter];
+	} else {
+		NSMutableArray *propertyKeys = [NSMutableArray array];
+		for (NSString *propertyKey in [adapter.modelClass propertyKeys]) {
+			if (adapter.JSONKeyPathsByPropertyKey[propertyKey] != nil) [propertyKeys addObject:propertyKey];
+		}
+
+		_propertyKeys = [propertyKeys copy];
+	}
+
+	NSMutableArray *defaultValues = [NSMutableArray arrayWithCapacity:_propertyKeys.count];
+	for (NSString *propertyKey in _propertyKeys) {
+		[defaultValues addObject:[_model valueForKey:propertyKey] ?: NSNull.null];
+	}
+
+	_defaultValues = [defaultValues copy];
+	_validatesModel = [adapter.modelClass instanceMethodForSelector:@selector(validate:)] != [MTLModel instanceMethodForSelector:@selector(validate:)];
+
+	return self;
+}
+
+- (BOOL)fillModelWithJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	if (![self overwriteModelWithJSONDictionary:JSONDictionary error:error]) {
+		[self resetModel];
+		return NO;
+	}
+
+	MTLModelDiscardDirtyPropertyKeys(_model);
+	return YES;
+}
+
+- (BOOL)overwriteModelWithJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	NSUInteger count = _propertyKeys.count;
+	for (NSUInteger i = 0; i < count; i++) {
+		NSString *propertyKey = _propertyKeys[i];
+
+		__autoreleasing id value = nil;
+		if (![_adapter getValue:&value forPropertyKey:propertyKey fromJSONDictionary:JSONDictionary error:error]) return NO;
+
+		if (value == nil) value = _defaultValues[i];
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (!MTLValidateAndSetValue(_model, propertyKey, value, YES, error)) return NO;
+	}
+
+	return !_validatesModel || [_model validate:error];
+}
+
+// Restores the default value of every overwritten property.
+- (void)resetModel {
+	NSUInteger count = _propertyKeys.count;
+	for (NSUInteger i = 0; i < count; i++) {
+		id value = _defaultValues[i];
+		[_model setValue:(value == NSNull.null ? nil : value) forKey:_propertyKeys[i]];
+	}
+
+	MTLModelDiscardDirtyPropertyKeys(_model);
+}
+
+@end
+
+@implementation MTLJSONAdapter (Scanning)
+
+- (BOOL)enumerateModelsFromJSONArray:(NSArray *)JSONArray projection:(MTLJSONProjection *)projection error:(NSError **)error usingBlock:(void (^)(id model, NSUInteger index, BOOL *stop))block {
+	NSParameterAssert(JSONArray != nil);
+	NSParameterAssert(block != nil);
+
+	// Maps the adapters chosen for the dictionaries to their state.
+	NSMapTable *scanStatesByJSONAdapter = [NSMapTable strongToStrongObjectsMapTable];
+
+	NSUInteger index = 0;
+	for (NSDictionary *JSONDictionary in JSONArray) {
+		if (![JSONDictionary isKindOfClass:NSDictionary.class]) {
+			if (error != NULL) {
+				NSDictionary *userInfo = @{
+					NSLocalizedDescriptionKey: NSLocalizedString(@"Invalid JSON dictionary", @""),
+					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"%@ could not be created because the element at index %lu of the JSON array is not a dictionary: %@", @""), NSStringFromClass(self.modelClass), (unsigned long)index, JSONDictionary.class],
+				};
+
+				*error = [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:userInfo];
+			}
+
+			return NO;
+		}
+
+		// Errors have to outlive the autorelease pool.
+		NSError *fillError = nil;
+		BOOL success = NO;
+		BOOL stop = NO;
+
+		@autoreleasepool {
+			MTLJSONAdapter *adapter = [self dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:&fillError];
+			MTLJSONScanState *state = nil;
+
+			if (adapter != nil) {
+				state = [scanStatesByJSONAdapter objectForKey:adapter];
+				if (state == nil) {
+					state = [[MTLJSONScanState alloc] initWithJSONAdapter:adapter projection:projection];
+					[scanStatesByJSONAdapter setObject:state forKey:adapter];
+				}
+
+				success = [state fillModelWithJSONDictionary:JSONDictionary error:&fillError];
+			}
+
+			if (success) block(state.model, index, &stop);
+		}
+
+		if (!success) {
+			if (error != NULL) *error = fillError;
+			return NO;
+		}
+
+		if (stop) break;
+
+		index++;
+	}
+
+	return YES;
+}
+
+@end
+
+// Used to associate the MTLLazyModelState of a lazy model with it.
+static void *MTLLazyModelStateKey = &MTLLazyModelStateKey;
+
+// Used to cache the lazy subclass of a model class.
+static void *MTLLazyModelClassKey = &MTLLazyModelClassKey;
+
+// Used to cache the property keys a lazy subclass can transform on first
+// access.
+static void *MTLLazyModelPropertyKeysKey = &MTLLazyModelPropertyKeysKey;
+
+// Tracks the properties of a lazy model which haven't been transformed yet.
+@interface MTLLazyModelState : NSObject
+
+// The first error that occurred while transforming a property.
+@property (atomic, strong, readonly) NSError *error;
+
+// Whether any properties haven't been transformed yet.
+@property (atomic, assign, readonly) BOOL hasPendingPropertyKeys;
+
+- (instancetype)initWithJSONAdapter:(MTLJSONAdapter *)adapter JSONDictionary:(NSDictionary *)JSONDictionary pendingPropertyKeys:(NSSet *)pendingPropertyKeys;
+
+// Transforms the given property of `model` from the JSON dictionary and sets
+// it, unless that has already happened.
+- (void)materializePropertyKey:(NSString *)propertyKey ofModel:(MTLModel *)model;
+
+// Transforms all properties which haven't been transformed yet.
+- (void)materializeModel:(MTLModel *)model;
+
+// Forgets about the JSON value of the given property, because it's being set.
+- (void)discardPropertyKey:(NSString *)propertyKey;
+
+@end
+
+@implementation MTLLazyModelState {
+	MTLJSONAdapter *_adapter;
+	NSDictionary *_JSONDictionary;
+
+	// Guards `_pendingPropertyKeys`. Setting a property from within
+	// -materializePropertyKey:ofModel: calls -discardPropertyKey:, so this has
+	// to be recursive.
+	NSRecursiveLock *_lock;
+	NSMutableSet *_pendingPropertyKeys;
+}
+
+- (instancetype)initWithJSONAdapter:(MTLJSONAdapter *)adapter JSONDictionary:(NSDictionary *)JSONDictionary pendingPropertyKeys:(NSSet *)pendingPropertyKeys {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_adapter = adapter;
+	_JSONDictionary = [JSONDictionary copy];
+	_lock = [[NSRecursiveLock alloc] init];
+	_pendingPropertyKeys = [pendingPropertyKeys mutableCopy];
+
+	return self;
+}
+
+- (BOOL)hasPendingPropertyKeys {
+	[_lock lock];
+	@onExit {
+		[_lock unlock];
+	};
+
+	return _pendingPropertyKeys.count > 0;
+}
+
+- (void)materializePropertyKey:(NSString *)propertyKey ofModel:(MTLModel *)model {
+	[_lock lock];
+	@onExit {
+		[_lock unlock];
+	};
+
+	if (![_pendingPropertyKeys containsObject:propertyKey]) return;
+
+	[_pendingPropertyKeys removeObject:propertyKey];
+
+	NSError *error = nil;
+	id value = nil;
+	BOOL success = [_adapter getValue:&value forPropertyKey:propertyKey fromJSONDictionary:_JSONDictionary error:&error];
+
+	if (success && value != nil) {
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		success = MTLValidateAndSetValue(model, propertyKey, value, YES, &error);
+
+		// The property couldn't have been dirty while it was pending.
+		if (success) MTLModelDiscardDirtyPropertyKey(model, propertyKey);
+	}
+
+	// The getter returns nil, and +materializeLazyModel:error: reports the
+	// error.
+	if (!success) {
+		if (_error == nil) {
+			_error = error ?: [NSError errorWithDomain:MTLJSONAdapterErrorDomain code:MTLJSONAdapterErrorInvalidJSONDictionary userInfo:nil];
+		}
+	}
+
+	// Lazy models without pending properties behave like any other model.
+	if (_pendingPropertyKeys.count == 0 && _error == nil) {
+		objc_setAssociatedObject(model, MTLLazyModelStateKey, nil, OBJC_ASSOCIATION_RETAIN);
+	}
+}
+
+- (void)materializeModel:(MTLModel *)model {
+	[_lock lock];
+	@onExit {
+		[_lock unlock];
+	};
+
+	for (NSString *propertyKey in [_pendingPropertyKeys copy]) {
+		[self materializePropertyKey:propertyKey ofModel:model];
+	}
+}
+
+- (void)discardPropertyKey:(NSString *)propertyKey {
+	[_lock lock];
+	@onExit {
+		[_lock unlock];
+	};
+
+	[_pendingPropertyKeys removeObject:propertyKey];
+}
+
+@end
+
+// Returns a subclass of `modelClass` whose object property getters transform
+// the property first, creating it if necessary.
+static Class MTLLazyModelClassForModelClass(Class modelClass) {
+	@synchronized (modelClass) {
+		Class lazyClass = objc_getAssociatedObject(modelClass, MTLLazyModelClassKey);
+		if (lazyClass != nil) return lazyClass;
+
+		NSString *name = [NSString stringWithFormat:@"MTLLazy_%@", NSStringFromClass(modelClass)];
+		lazyClass = objc_allocateClassPair(modelClass, name.UTF8String, 0);
+		NSCAssert(lazyClass != nil, @"Could not create lazy subclass of %@", modelClass);
+
+		// Pretend to be the model class, like KVO does, so that equality,
+		// archiving and copying behave as usual.
+		Class (^classBlock)(id) = ^(id self) {
+			return modelClass;
+		};
+
+		Method classMethod = class_getInstanceMethod(modelClass, @selector(class));
+		class_addMethod(lazyClass, @selector(class), imp_implementationWithBlock(classBlock), method_getTypeEncoding(classMethod));
+
+		// KVC may set properties without calling their setters.
+		IMP setValueForKey = class_getMethodImplementation(modelClass, @selector(setValue:forKey:));
+		void (^setValueForKeyBlock)(id, id, NSString *) = ^(id self, id value, NSString *key) {
+			MTLLazyModelState *state = objc_getAssociatedObject(self, MTLLazyModelStateKey);
+			[state discardPropertyKey:key];
+
+			((void (*)(id, SEL, id, NSString *))setValueForKey)(self, @selector(setValue:forKey:), value, key);
+		};
+
+		Method setValueForKeyMethod = class_getInstanceMethod(modelClass, @selector(setValue:forKey:));
+		class_addMethod(lazyClass, @selector(setValue:forKey:), imp_implementationWithBlock(setValueForKeyBlock), method_getTypeEncoding(setValueForKeyMethod));
+
+		NSMutableSet *lazyPropertyKeys = [NSMutableSet set];
+
+		for (NSString *key in [modelClass propertyKeys]) {
+			objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+			if (property == NULL) continue;
+
+			mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+			@onExit {
+				free(attributes);
+			};
+
+			// Primitive properties are cheap to transform, and would need a
+			// getter for every return type.
+			if (attributes->type[0] != '@') continue;
+
+			SEL getter = attributes->getter;
+			IMP originalGetter = class_getMethodImplementation(modelClass, getter);
+
+			id (^getterBlock)(id) = ^ id (id self) {
+				MTLLazyModelState *state = objc_getAssociatedObject(self, MTLLazyModelStateKey);
+				[state materializePropertyKey:key ofModel:self];
+
+				return ((id (*)(id, SEL))originalGetter)(self, getter);
+			};
+
+			class_addMethod(lazyClass, getter, imp_implementationWithBlock(getterBlock), "@@:");
+
+			if (!attributes->readonly) {
+				SEL setter = attributes->setter;
+				IMP originalSetter = class_getMethodImplementation(modelClass, setter);
+
+				void (^setterBlock)(id, id) = ^(id self, id value) {
+					MTLLazyModelState *state = objc_getAssociatedObject(self, MTLLazyModelStateKey);
+					[state discardPropertyKey:key];
+
+					((void (*)(id, SEL, id))originalSetter)(self, setter, value);
+				};
+
+				class_addMethod(lazyClass, setter, imp_implementationWithBlock(setterBlock), "v@:@");
+			}
+
+			[lazyPropertyKeys addObject:key];
+		}
+
+		objc_registerClassPair(lazyClass);
+
+		objc_setAssociatedObject(lazyClass, MTLLazyModelPropertyKeysKey, lazyPropertyKeys, OBJC_ASSOCIATION_COPY);
+		objc_setAssociatedObject(modelClass, MTLLazyModelClassKey, lazyClass, OBJC_ASSOCIATION_ASSIGN);
+
+		return lazyClass;
+	}
+}
+
+@implementation MTLJSONAdapter (LazyModels)
+
++ (id)lazyModelOfClass:(Class)modelClass fromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:modelClass];
+
+	return [adapter lazyModelFromJSONDictionary:JSONDictionary error:error];
+}
+
+- (id)lazyModelFromJSONDictionary:(NSDictionary *)JSONDictionary error:(NSError **)error {
+	NSParameterAssert(JSONDictionary != nil);
+
+	MTLJSONAdapter *adapter = [self dispatchedJSONAdapterForJSONDictionary:JSONDictionary error:error];
+	if (adapter == nil) return nil;
+
+	Class modelClass = adapter.modelClass;
+	NSAssert([modelClass isSubclassOfClass:MTLModel.class], @"Lazy models must be MTLModel subclasses, got %@", modelClass);
+
+	Class lazyClass = MTLLazyModelClassForModelClass(modelClass);
+	NSSet *lazyPropertyKeys = objc_getAssociatedObject(lazyClass, MTLLazyModelPropertyKeysKey);
+
+	MTLModel *model = [[lazyClass alloc] init];
+	if (model == nil) return nil;
+
+	NSMutableSet *pendingPropertyKeys = [NSMutableSet set];
+
+	for (NSString *propertyKey in [modelClass propertyKeys]) {
+		if (adapter.JSONKeyPathsByPropertyKey[propertyKey] == nil) continue;
+
+		if ([lazyPropertyKeys containsObject:propertyKey]) {
+			[pendingPropertyKeys addObject:propertyKey];
+			continue;
+		}
+
+		__autoreleasing id value = nil;
+		if (![adapter getValue:&value forPropertyKey:propertyKey fromJSONDictionary:JSONDictionary error:error]) return nil;
+
+		if (value == nil) continue;
+
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (!MTLValidateAndSetValue(model, propertyKey, value, YES, error)) return nil;
+	}
+
+	if (pendingPropertyKeys.count > 0) {
+		MTLLazyModelState *state = [[MTLLazyModelState alloc] initWithJSONAdapter:adapter JSONDictionary:JSONDictionary pendingPropertyKeys:pendingPropertyKeys];
+		objc_setAssociatedObject(model, MTLLazyModelStateKey, state, OBJC_ASSOCIATION_RETAIN);
+	}
+
+	MTLModelDiscardDirtyPropertyKeys(model);
+	return model;
+}
+
++ (BOOL)materializeLazyModel:(MTLModel *)model error:(NSError **)error {
+	NSParameterAssert(model != nil);
+
+	MTLLazyModelState *state = objc_getAssociatedObject(model, MTLLazyModelStateKey);
+	if (state != nil) {
+		[state materializeModel:model];
+
+		if (state.error != nil) {
+			if (error != NULL) *error = state.error;
+			return NO;
+		}
+	}
+
+	return [model validate:error];
+}
+
++ (BOOL)isLazyModelFault:(MTLModel *)model {
+	MTLLazyModelState *state = objc_getAssociatedObject(model, MTLLazyModelStateKey);
+
+	return state.hasPendingPropertyKeys;
+}
+
+@end
+
+@implementation MTLJSONAdapter (DirtyTracking)
+
++ (NSDictionary *)JSONDictionaryFromDirtyPropertiesOfModel:(id<MTLJSONSerializing>)model error:(NSError **)error {
+	MTLJSONAdapter *adapter = [[self alloc] initWithModelClass:model.class];
+
+	return [adapter JSONDictionaryFromDirtyPropertiesOfModel:model error:error];
+}
+
+- (NSDictionary *)JSONDictionaryFromDirtyPropertiesOfModel:(MTLModel<MTLJSONSerializing> *)model error:(NSError **)error {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isKindOfClass:self.modelClass]);
+	NSAssert([model isKindOfClass:MTLModel.class] && [model.class tracksDirtyPropertyKeys], @"%@ does not track dirty properties", model.class);
+
+	if (self.modelClass != model.class) {
+		MTLJSONAdapter *otherAdapter = self.JSONAdaptersByDiscriminatedClass[model.class] ?: [self JSONAdapterForModelClass:model.class error:error];
+
+		return [otherAdapter JSONDictionaryFromDirtyPropertiesOfModel:model error:error];
+	}
+
+	NSSet *dirtyPropertyKeys = model.dirtyPropertyKeys;
+	NSMutableSet *propertyKeys = [NSMutableSet setWithCapacity:dirtyPropertyKeys.count];
+
+	for (NSString *propertyKey in dirtyPropertyKeys) {
+		if (self.JSONKeyPathsByPropertyKey[propertyKey] != nil) [propertyKeys addObject:propertyKey];
+	}
+
+	NSSet *propertyKeysToSerialize = [self serializablePropertyKeys:propertyKeys forModel:model];
+
+	// Avoid -dictionaryValue, which reads every property.
+	NSDictionary *dictionaryValue = [model dictionaryWithValuesForKeys:propertyKeysToSerialize.allObjects];
+
+	return [self JSONDictionaryFromDictionaryValue:dictionaryValue error:error];
+}
+
+@end
+
+// Sets the values of the given properties of `model`, ignoring validation.
+static void MTLRestoreValues(id model, NSDictionary *values) {
+	[values enumerateKeysAndObjectsUsingBlock:^(NSString *propertyKey, id value, BOOL *stop) {
+		[model setValue:([value isEqual:NSNull.null] ? nil : value) forKey:propertyKey];
+	}];
+}
+
+@implementation MTLJSONAdapter (Patching)
+
+// Transforms the values of the properties present in a patch, without setting
+// them.
+//
+// values - Filled with the new value of every property to update, with nil
+//          values represented by NSNull.
+//
+// Returns whether transforming succeeded.
+- (BOOL)getValues:(NSMutableDictionary *)values forUpdatingModel:(id)model fromJSONDictionary:(NSDictionary *)JSONDictionary options:(MTLJSONPatchOptions)options error:(NSError **)error {
+	BOOL mergePatch = (options & MTLJSONPatchOptionsMergePatch) != 0;
+	NSDictionary *propertyKeysByJSONKey = self.propertyKeysByJSONKey;
+
+	// A newly initialized model, holding the values to restore removed
+	// properties to.
+	id defaultModel = nil;
+
+	for (NSString *JSONKey in JSONDictionary) {
+		for (NSString *propertyKey in propertyKeysByJSONKey[JSONKey]) {
+			if (values[propertyKey] != nil) continue;
+
+			id JSONKeyPaths = self.JSONKeyPathsByPropertyKey[propertyKey];
+
+			if ([JSONKeyPaths isKindOfClass:NSArray.class]) {
+				BOOL present = NO;
+				for (NSString *keyPath in JSONKeyPaths) {
+					if ([JSONDictionary mtl_valueForJSONKeyPath:keyPath success:NULL error:NULL] != nil) {
+						present = YES;
+						break;
+					}
+				}
+
+				if (!present) continue;
+			} else {
+				BOOL success = NO;
+				id JSONValue = [JSONDictionary mtl_valueForJSONKeyPath:JSONKeyPaths success:&success error:error];
+
+				if (!success) return NO;
+				if (JSONValue == nil) continue;
+
+				if (mergePatch && JSONValue == NSNull.null) {
+					if (defaultModel == nil) defaultModel = [[self.modelClass alloc] init];
+
+					values[propertyKey] = [defaultModel valueForKey:propertyKey] ?: NSNull.null;
+					continue;
+				}
+
+				if (mergePatch && [JSONValue isKindOfClass:NSDictionary.class]) {
+					id nestedModel = [model valueForKey:propertyKey];
+
+					if ([nestedModel conformsToProtocol:@protocol(MTLJSONSerializing)]) {
+						MTLJSONAdapter *nestedAdapter = [self JSONAdapterForModelClass:[nestedModel class] error:error];
+
+						nestedModel = [nestedAdapter modelByUpdatingModel:nestedModel fromJSONDictionary:JSONValue options:options error:error];
+						if (nestedModel == nil) return NO;
+
+						values[propertyKey] = nestedModel;
+						continue;
+					}
+				}
+			}
+
+			id value = nil;
+			if (![self getValue:&value forPropertyKey:propertyKey fromJSONDictionary:JSONDictionary error:error]) return NO;
+
+			values[propertyKey] = value ?: NSNull.null;
+		}
+	}
+
+	return YES;
+}
+
+- (BOOL)updateModel:(id<MTLJSONSerializing>)model fromJSONDictionary:(NSDictionary *)JSONDictionary options:(MTLJSONPatchOptions)options error:(NSError **)error {
+	NSParameterAssert(model != nil);
+	NSParameterAssert([model isKindOfClass:self.modelClass]);
+	NSParameterAssert(JSONDictionary != nil);
+
+	if (self.modelClass != model.class) {
+		MTLJSONAdapter *otherAdapter = self.JSONAdaptersByDiscriminatedClass[model.class] ?: [self JSONAdapterForModelClass:model.class error:error];
+
+		return [otherAdapter updateModel:model fromJSONDictionary:JSONDictionary options:options error:error];
+	}
+
+	NSMutableDictionary *values = [[NSMutableDictionary alloc] initWithCapacity:JSONDictionary.count];
+	if (![self getValues:values forUpdatingModel:model fromJSONDictionary:JSONDictionary options:options error:error]) return NO;
+
+	// The values of the properties set so far, to restore if validation fails.
+	NSMutableDictionary *previousValues = [[NSMutableDictionary alloc] initWithCapacity:values.count];
+
+	for (NSString *propertyKey in values) {
+		previousValues[propertyKey] = [(id)model valueForKey:propertyKey] ?: NSNull.null;
+
+		id value = values[propertyKey];
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (!MTLValidateAndSetValue(model, propertyKey, value, YES, error)) {
+			MTLRestoreValues(model, previousValues);
+			return NO;
+		}
+	}
+
+	BOOL validatesModel = [self.modelClass instanceMethodForSelector:@selector(validate:)] != [MTLModel instanceMethodForSelector:@selector(validate:)];
+	if (validatesModel && ![model validate:error]) {
+		MTLRestoreValues(model, previousValues);
+		return NO;
+	}
+
+	for (NSString *propertyKey in values) {
+		MTLModelDiscardDirtyPropertyKey(model, propertyKey);
+	}
+
+	return YES;
+}
+
+- (id)modelByUpdatingModel:(id<MTLJSONSerializing>)model fromJSONDictionary:(NSDictionary *)JSONDictionary options:(MTLJSONPatchOptions)options error:(NSError **)error {
+	NSParameterAssert(model != nil);
+
+	id<MTLJSONSerializing> copy = [model copy];
+
+	return [self updateModel:copy fromJSONDictionary:JSONDictionary options:options error:error] ? copy : nil;
+}
+
+@end
+
 @implementation MTLJSONAdapter (Deprecated)
 
 #pragma clang diagnostic push
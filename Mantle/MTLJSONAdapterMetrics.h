@@ -0,0 +1,35 @@
+//
+//  MTLJSONAdapterMetrics.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Whether MTLJSONAdapter records metrics. Recording sites read this once and
+// skip everything else when it's NO.
+extern BOOL MTLJSONAdapterRecordsMetrics;
+
+typedef NS_ENUM(NSUInteger, MTLMetricsDirection) {
+	MTLMetricsDirectionDecode,
+	MTLMetricsDirectionEncode,
+};
+
+// Returns the current time of a monotonic clock, in nanoseconds.
+uint64_t MTLMetricsTimestamp(void);
+
+// Records a model of `modelClass` decoded or encoded since `startTime`.
+//
+// values - The property values or JSON dictionary produced, or nil if the call
+//          failed.
+void MTLMetricsRecordModel(Class modelClass, MTLMetricsDirection direction, uint64_t startTime, NSDictionary * _Nullable values);
+
+// Records a transformation of the property `propertyKey` of `modelClass` since
+// `startTime`, which produced `value` if it succeeded.
+void MTLMetricsRecordTransformation(Class modelClass, NSString *propertyKey, MTLMetricsDirection direction, uint64_t startTime, BOOL success, id _Nullable value);
+
+NS_ASSUME_NONNULL_END
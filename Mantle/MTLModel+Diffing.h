@@ -0,0 +1,82 @@
+//
+//  MTLModel+Diffing.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The differences between two arrays of models, matched by identity.
+///
+/// Indexes of deleted models refer to the old array, and indexes of inserted
+/// and updated models to the new array, as expected by table and collection
+/// views' batch updates.
+@interface MTLModelArrayDiff : NSObject
+
+/// The indexes of the models in the old array without a match in the new one.
+@property (nonatomic, copy, readonly) NSIndexSet *deletedIndexes;
+
+/// The indexes of the models in the new array without a match in the old one.
+@property (nonatomic, copy, readonly) NSIndexSet *insertedIndexes;
+
+/// The indexes in the new array of the models which are not equal to their
+/// match in the old array.
+@property (nonatomic, copy, readonly) NSIndexSet *updatedIndexes;
+
+/// The number of models which moved relative to the others.
+///
+/// Only the smallest set of moves is reported. Models which are only shifted
+/// by inserts and deletes are not considered moved.
+@property (nonatomic, assign, readonly) NSUInteger moveCount;
+
+/// Whether the arrays differ at all.
+@property (nonatomic, assign, readonly) BOOL hasChanges;
+
+/// Invokes `block` with the index in the old array and the index in the new
+/// array of every moved model, in the order of the new array.
+- (void)enumerateMovesUsingBlock:(void (^)(NSUInteger fromIndex, NSUInteger toIndex))block;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// Compares models without building their -dictionaryValue.
+@interface MTLModel (Diffing)
+
+/// Returns the key paths of the permanent properties whose values differ
+/// between the receiver and `model`.
+///
+/// Properties are read directly through their getters. When both values of a
+/// property are models of the same MTLModel subclass, they are compared
+/// recursively and the differing properties are reported as
+/// "property.nestedProperty" key paths. Any other values are compared with
+/// -isEqual:.
+///
+/// model - A model of the same class as the receiver. This argument must not
+///         be nil.
+///
+/// Returns an empty set if the models are equal.
+- (NSSet<NSString *> *)changedKeyPathsComparedToModel:(MTLModel *)model;
+
+/// Computes the differences between two arrays of models of the receiver.
+///
+/// Models are matched by the value of an identity property, which must be
+/// unique within each array. A matched model which isn't equal to its match,
+/// as determined by -changedKeyPathsComparedToModel:, is considered updated.
+///
+/// This takes time linear in the number of models, plus O(m log m) for m
+/// matched models to find the moves.
+///
+/// oldModels   - The previous models. This argument must not be nil.
+/// newModels   - The current models. This argument must not be nil.
+/// identityKey - A property of the receiver identifying each model. This
+///               argument must not be nil.
++ (MTLModelArrayDiff *)diffFromModels:(NSArray *)oldModels toModels:(NSArray *)newModels identityKey:(NSString *)identityKey;
+
+@end
+
+NS_ASSUME_NONNULL_END
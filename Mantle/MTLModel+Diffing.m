@@ -0,0 +1,304 @@
+//
+//  MTLModel+Diffing.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import "MTLModel+Diffing.h"
+#import "MTLPropertyAccessor.h"
+#import "MTLTracing.h"
+#import "NSObject+MTLComparisonAdditions.h"
+
+// Used to cache the properties compared by MTLCompareModels().
+static void *MTLModelCachedDiffingKeysKey = &MTLModelCachedDiffingKeysKey;
+
+// The permanent properties of a class, as compared by MTLCompareModels().
+@interface MTLModelDiffingKeys : NSObject
+
+// The accessors for the properties which have them.
+@property (nonatomic, copy) NSArray<MTLPropertyAccessor *> *accessors;
+
+// The remaining properties, such as structs, which are read through KVC.
+@property (nonatomic, copy) NSArray<NSString *> *otherKeys;
+
+@end
+
+@implementation MTLModelDiffingKeys
+@end
+
+static MTLModelDiffingKeys *MTLDiffingKeysForClass(Class modelClass) {
+	MTLModelDiffingKeys *cachedKeys = objc_getAssociatedObject(modelClass, MTLModelCachedDiffingKeysKey);
+	if (cachedKeys != nil) return cachedKeys;
+
+	MTL_PROBE2(cache__miss, class_getName(modelClass), "diffingKeys");
+
+	NSMutableArray *accessors = [NSMutableArray array];
+	NSMutableArray *otherKeys = [NSMutableArray array];
+
+	for (NSString *key in [modelClass propertyKeys]) {
+		if ([modelClass storageBehaviorForPropertyWithKey:key] != MTLPropertyStoragePermanent) continue;
+
+		MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:modelClass];
+		if (accessor != nil) {
+			[accessors addObject:accessor];
+		} else {
+			[otherKeys addObject:key];
+		}
+	}
+
+	MTLModelDiffingKeys *keys = [[MTLModelDiffingKeys alloc] init];
+	keys.accessors = accessors;
+	keys.otherKeys = otherKeys;
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLModelCachedDiffingKeysKey, keys, OBJC_ASSOCIATION_RETAIN);
+
+	return keys;
+}
+
+static NSString *MTLKeyPathByAppendingKey(NSString *prefix, NSString *key) {
+	if (prefix == nil) return key;
+
+	return [NSString stringWithFormat:@"%@.%@", prefix, key];
+}
+
+static BOOL MTLCompareModels(MTLModel *oldModel, MTLModel *newModel, NSString *prefix, NSMutableSet *keyPaths);
+
+// Compares two values of a property, recursing into models of the same class.
+//
+// If `keyPaths` is not nil, the key path of the property is added to it if the
+// values differ, or the key paths of the differing nested properties.
+//
+// Returns whether the values differ.
+static BOOL MTLCompareValues(id oldValue, id newValue, NSString *prefix, NSString *key, NSMutableSet *keyPaths) {
+	if (oldValue == newValue) return NO;
+
+	if ([oldValue isKindOfClass:MTLModel.class] && [newValue isMemberOfClass:[oldValue class]]) {
+		return MTLCompareModels(oldValue, newValue, (keyPaths != nil ? MTLKeyPathByAppendingKey(prefix, key) : nil), keyPaths);
+	}
+
+	if (MTLEqualObjects(oldValue, newValue)) return NO;
+
+	[keyPaths addObject:MTLKeyPathByAppendingKey(prefix, key)];
+	return YES;
+}
+
+// Compares the permanent properties of two models of the same class.
+//
+// If `keyPaths` is not nil, the key paths of the differing properties are
+// added to it, prefixed with `prefix`. Otherwise, this stops at the first
+// difference.
+//
+// Returns whether any property differs.
+static BOOL MTLCompareModels(MTLModel *oldModel, MTLModel *newModel, NSString *prefix, NSMutableSet *keyPaths) {
+	MTLModelDiffingKeys *keys = MTLDiffingKeysForClass(oldModel.class);
+	BOOL changed = NO;
+
+	for (MTLPropertyAccessor *accessor in keys.accessors) {
+		BOOL differs = NO;
+
+		switch (accessor.kind) {
+			case MTLPropertyAccessorKindInt64:
+				differs = [accessor int64ValueOfModel:oldModel] != [accessor int64ValueOfModel:newModel];
+				if (differs) [keyPaths addObject:MTLKeyPathByAppendingKey(prefix, accessor.propertyKey)];
+				break;
+
+			case MTLPropertyAccessorKindDouble:
+				differs = [accessor doubleValueOfModel:oldModel] != [accessor doubleValueOfModel:newModel];
+				if (differs) [keyPaths addObject:MTLKeyPathByAppendingKey(prefix, accessor.propertyKey)];
+				break;
+
+			case MTLPropertyAccessorKindObject:
+				differs = MTLCompareValues([accessor objectValueOfModel:oldModel], [accessor objectValueOfModel:newModel], prefix, accessor.propertyKey, keyPaths);
+				break;
+		}
+
+		if (differs) {
+			if (keyPaths == nil) return YES;
+			changed = YES;
+		}
+	}
+
+	for (NSString *key in keys.otherKeys) {
+		if (!MTLEqualObjects([oldModel valueForKey:key], [newModel valueForKey:key])) {
+			if (keyPaths == nil) return YES;
+
+			[keyPaths addObject:MTLKeyPathByAppendingKey(prefix, key)];
+			changed = YES;
+		}
+	}
+
+	return changed;
+}
+
+@interface MTLModelArrayDiff ()
+
+- (instancetype)initWithDeletedIndexes:(NSIndexSet *)deletedIndexes insertedIndexes:(NSIndexSet *)insertedIndexes updatedIndexes:(NSIndexSet *)updatedIndexes moves:(NSData *)moves;
+
+@end
+
+@implementation MTLModelArrayDiff {
+	// Pairs of old and new indexes, stored as NSUIntegers.
+	NSData *_moves;
+}
+
+- (instancetype)initWithDeletedIndexes:(NSIndexSet *)deletedIndexes insertedIndexes:(NSIndexSet *)insertedIndexes updatedIndexes:(NSIndexSet *)updatedIndexes moves:(NSData *)moves {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_deletedIndexes = [deletedIndexes copy];
+	_insertedIndexes = [insertedIndexes copy];
+	_updatedIndexes = [updatedIndexes copy];
+	_moves = [moves copy];
+
+	return self;
+}
+
+- (NSUInteger)moveCount {
+	return _moves.length / (2 * sizeof(NSUInteger));
+}
+
+- (BOOL)hasChanges {
+	return self.deletedIndexes.count > 0 || self.insertedIndexes.count > 0 || self.updatedIndexes.count > 0 || self.moveCount > 0;
+}
+
+- (void)enumerateMovesUsingBlock:(void (^)(NSUInteger fromIndex, NSUInteger toIndex))block {
+	NSParameterAssert(block != nil);
+
+	const NSUInteger *moves = _moves.bytes;
+	for (NSUInteger i = 0; i < self.moveCount; i++) {
+		block(moves[2 * i], moves[2 * i + 1]);
+	}
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> deleted %@, inserted %@, updated %@, %lu moves", self.class, self, self.deletedIndexes, self.insertedIndexes, self.updatedIndexes, (unsigned long)self.moveCount];
+}
+
+@end
+
+@implementation MTLModel (Diffing)
+
+- (NSSet *)changedKeyPathsComparedToModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+	NSAssert([model isMemberOfClass:self.class], @"%@ is not of the same class as %@", model, self);
+
+	NSMutableSet *keyPaths = [NSMutableSet set];
+	MTLCompareModels(self, model, nil, keyPaths);
+
+	return keyPaths;
+}
+
++ (MTLModelArrayDiff *)diffFromModels:(NSArray *)oldModels toModels:(NSArray *)newModels identityKey:(NSString *)identityKey {
+	NSParameterAssert(oldModels != nil);
+	NSParameterAssert(newModels != nil);
+	NSParameterAssert(identityKey != nil);
+
+	MTLPropertyAccessor *identityAccessor = [MTLPropertyAccessor accessorForPropertyKey:identityKey ofClass:self];
+	id (^identityOfModel)(id) = ^(id model) {
+		return (identityAccessor != nil ? [identityAccessor objectValueOfModel:model] : [model valueForKey:identityKey]);
+	};
+
+	NSUInteger oldCount = oldModels.count;
+	NSUInteger newCount = newModels.count;
+
+	NSMutableDictionary *oldIndexesByIdentity = [NSMutableDictionary dictionaryWithCapacity:oldCount];
+	for (NSUInteger i = 0; i < oldCount; i++) {
+		id identity = identityOfModel(oldModels[i]);
+		if (identity == nil || oldIndexesByIdentity[identity] != nil) continue;
+
+		oldIndexesByIdentity[identity] = @(i);
+	}
+
+	// For every matched model, in the order of the new array, its index in the
+	// old array and in the new array.
+	NSUInteger *matchedOldIndexes = malloc(MAX(newCount, 1) * sizeof(*matchedOldIndexes));
+	NSUInteger *matchedNewIndexes = malloc(MAX(newCount, 1) * sizeof(*matchedNewIndexes));
+	NSUInteger matchCount = 0;
+
+	NSMutableIndexSet *deletedIndexes = [NSMutableIndexSet indexSetWithIndexesInRange:NSMakeRange(0, oldCount)];
+	NSMutableIndexSet *insertedIndexes = [NSMutableIndexSet indexSet];
+	NSMutableIndexSet *updatedIndexes = [NSMutableIndexSet indexSet];
+
+	for (NSUInteger j = 0; j < newCount; j++) {
+		MTLModel *newModel = newModels[j];
+
+		id identity = identityOfModel(newModel);
+		NSNumber *oldIndex = (identity != nil ? oldIndexesByIdentity[identity] : nil);
+
+		if (oldIndex == nil) {
+			[insertedIndexes addIndex:j];
+			continue;
+		}
+
+		// Only match the first model with a duplicate identity.
+		[oldIndexesByIdentity removeObjectForKey:identity];
+
+		NSUInteger i = oldIndex.unsignedIntegerValue;
+		[deletedIndexes removeIndex:i];
+
+		matchedOldIndexes[matchCount] = i;
+		matchedNewIndexes[matchCount] = j;
+		matchCount++;
+
+		MTLModel *oldModel = oldModels[i];
+		if (oldModel != newModel && (![newModel isMemberOfClass:oldModel.class] || MTLCompareModels(oldModel, newModel, nil, nil))) {
+			[updatedIndexes addIndex:j];
+		}
+	}
+
+	// The models which didn't move form the longest increasing subsequence of
+	// the matched old indexes. Find it by patience sorting, where `tails[k]` is
+	// the match ending the smallest increasing subsequence of length k + 1.
+	NSUInteger *tails = malloc(MAX(matchCount, 1) * sizeof(*tails));
+	NSUInteger *predecessors = malloc(MAX(matchCount, 1) * sizeof(*predecessors));
+	NSUInteger length = 0;
+
+	for (NSUInteger m = 0; m < matchCount; m++) {
+		NSUInteger low = 0;
+		NSUInteger high = length;
+
+		while (low < high) {
+			NSUInteger middle = low + (high - low) / 2;
+			if (matchedOldIndexes[tails[middle]] < matchedOldIndexes[m]) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		predecessors[m] = (low > 0 ? tails[low - 1] : NSNotFound);
+		tails[low] = m;
+		if (low == length) length++;
+	}
+
+	uint8_t *unmoved = calloc(MAX(matchCount, 1), sizeof(*unmoved));
+	for (NSUInteger m = (length > 0 ? tails[length - 1] : NSNotFound); m != NSNotFound; m = predecessors[m]) {
+		unmoved[m] = 1;
+	}
+
+	NSMutableData *moves = [NSMutableData data];
+	for (NSUInteger m = 0; m < matchCount; m++) {
+		if (unmoved[m]) continue;
+
+		NSUInteger move[2] = { matchedOldIndexes[m], matchedNewIndexes[m] };
+		[moves appendBytes:move length:sizeof(move)];
+	}
+
+	free(unmoved);
+	free(predecessors);
+	free(tails);
+	free(matchedNewIndexes);
+	free(matchedOldIndexes);
+
+	return [[MTLModelArrayDiff alloc] initWithDeletedIndexes:deletedIndexes insertedIndexes:insertedIndexes updatedIndexes:updatedIndexes moves:moves];
+}
+
+@end
@@ -0,0 +1,55 @@
+//
+//  MTLModel+DirtyTracking.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Records which properties of a model have been set since it was last saved,
+/// so that only those need to be uploaded.
+///
+/// Tracking is opt-in per class. When +tracksDirtyPropertyKeys returns YES, the
+/// setters of the class's +propertyKeys, -setValue:forKey: and -copyWithZone:
+/// are wrapped once, when the class is initialized. Other classes are left
+/// untouched, and don't pay for tracking.
+///
+/// A property becomes dirty whenever it's set through its setter or key-value
+/// coding, including by -mergeValueForKey:fromModel: and when initializing the
+/// model with a dictionary. Use -mergeChangedValuesForKeysFromModel: to only
+/// dirty the properties whose values change, apart from those merged by a
+/// `-merge<Key>FromModel:` method which sets them. Mutating a nested model or
+/// collection in place doesn't dirty the property holding it.
+///
+/// Models deserialized by MTLJSONAdapter start out clean. Copies have the same
+/// dirty properties as the original.
+///
+/// Subclasses which override +initialize must call the super implementation,
+/// or their setters won't be tracked.
+@interface MTLModel (DirtyTracking)
+
+/// Whether instances of the receiver track their dirty properties.
+///
+/// The default implementation returns NO. Subclasses override this to opt in,
+/// which also opts in their own subclasses.
++ (BOOL)tracksDirtyPropertyKeys;
+
+/// The keys of the properties which have been set since the receiver was
+/// created or last snapshotted.
+///
+/// This is always empty if the class doesn't track dirty properties.
+@property (nonatomic, copy, readonly) NSSet<NSString *> *dirtyPropertyKeys;
+
+/// Marks all properties of the receiver clean, for instance after the
+/// receiver's changes have been saved.
+///
+/// Returns the keys of the properties which were dirty.
+- (NSSet<NSString *> *)snapshotDirtyPropertyKeys;
+
+@end
+
+NS_ASSUME_NONNULL_END
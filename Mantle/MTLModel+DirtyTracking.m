@@ -0,0 +1,255 @@
+//
+//  MTLModel+DirtyTracking.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import <Mantle/EXTRuntimeExtensions.h>
+#import <Mantle/EXTScope.h>
+#import "MTLJSONAdapter.h"
+#import "MTLModel+DirtyTracking.h"
+#import "MTLModelDirtyTracking.h"
+
+// Associated with a model, holding the NSMutableSet of its dirty property
+// keys. Not set until a property becomes dirty.
+static void *MTLModelDirtyPropertyKeysKey = &MTLModelDirtyPropertyKeysKey;
+
+// Associated with a model, holding the MTLModelJSONCache of its serialized JSON.
+static void *MTLModelJSONCacheKey = &MTLModelJSONCacheKey;
+
+// Associated with a model class once MTLModelInstallChangeTracking() has been
+// called for it.
+static void *MTLModelChangeTrackingInstalledKey = &MTLModelChangeTrackingInstalledKey;
+
+// A JSON dictionary serialized from a model, and the class of the adapter that
+// serialized it.
+@interface MTLModelJSONCache : NSObject
+
+- (instancetype)initWithAdapterClass:(Class)adapterClass JSONDictionary:(NSDictionary *)JSONDictionary;
+
+@property (nonatomic, strong, readonly) Class adapterClass;
+@property (nonatomic, copy, readonly) NSDictionary *JSONDictionary;
+
+@end
+
+@implementation MTLModelJSONCache
+
+- (instancetype)initWithAdapterClass:(Class)adapterClass JSONDictionary:(NSDictionary *)JSONDictionary {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_adapterClass = adapterClass;
+	_JSONDictionary = [JSONDictionary copy];
+
+	return self;
+}
+
+@end
+
+// The implementations installed by MTLModelInstallChangeTracking(), wrapped in
+// NSValues, so that subclasses inheriting them don't wrap them again.
+static NSMutableSet *MTLDirtyTrackingImplementations(void) {
+	static NSMutableSet *implementations;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		implementations = [[NSMutableSet alloc] init];
+	});
+
+	return implementations;
+}
+
+// Whether MTLModelInstallChangeTracking() should wrap the setters of a class.
+static BOOL MTLModelTracksChanges(Class modelClass) {
+	if ([modelClass tracksDirtyPropertyKeys]) return YES;
+
+	return [modelClass respondsToSelector:@selector(cachesJSONDictionary)] && [modelClass cachesJSONDictionary];
+}
+
+static void MTLModelDidSetValueForKey(id model, NSString *key) {
+	if ([[model class] tracksDirtyPropertyKeys]) {
+		NSMutableSet *dirtyKeys = objc_getAssociatedObject(model, MTLModelDirtyPropertyKeysKey);
+		if (dirtyKeys == nil) {
+			dirtyKeys = [NSMutableSet set];
+			objc_setAssociatedObject(model, MTLModelDirtyPropertyKeysKey, dirtyKeys, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+		}
+
+		[dirtyKeys addObject:key];
+	}
+
+	if (objc_getAssociatedObject(model, MTLModelJSONCacheKey) != nil) {
+		objc_setAssociatedObject(model, MTLModelJSONCacheKey, nil, OBJC_ASSOCIATION_RETAIN);
+	}
+}
+
+// Returns an implementation of `setter` which calls `originalSetter` and then
+// marks `key` dirty, or NULL if the type of the property isn't supported.
+static IMP MTLDirtyTrackingSetter(SEL setter, IMP originalSetter, NSString *key, const char *type) {
+	#define MTL_DIRTY_TRACKING_SETTER(TYPE) \
+		imp_implementationWithBlock(^(id self, TYPE value) { \
+			((void (*)(id, SEL, TYPE))originalSetter)(self, setter, value); \
+			MTLModelDidSetValueForKey(self, key); \
+		})
+
+	switch (type[0]) {
+		case '@':
+		case '#':
+			return MTL_DIRTY_TRACKING_SETTER(id);
+
+		case 'c': return MTL_DIRTY_TRACKING_SETTER(char);
+		case 'i': return MTL_DIRTY_TRACKING_SETTER(int);
+		case 's': return MTL_DIRTY_TRACKING_SETTER(short);
+		case 'l': return MTL_DIRTY_TRACKING_SETTER(long);
+		case 'q': return MTL_DIRTY_TRACKING_SETTER(long long);
+		case 'C': return MTL_DIRTY_TRACKING_SETTER(unsigned char);
+		case 'I': return MTL_DIRTY_TRACKING_SETTER(unsigned int);
+		case 'S': return MTL_DIRTY_TRACKING_SETTER(unsigned short);
+		case 'L': return MTL_DIRTY_TRACKING_SETTER(unsigned long);
+		case 'Q': return MTL_DIRTY_TRACKING_SETTER(unsigned long long);
+		case 'f': return MTL_DIRTY_TRACKING_SETTER(float);
+		case 'd': return MTL_DIRTY_TRACKING_SETTER(double);
+		case 'B': return MTL_DIRTY_TRACKING_SETTER(bool);
+
+		case '*':
+		case ':':
+		case '^':
+			return MTL_DIRTY_TRACKING_SETTER(void *);
+
+		default:
+			// Structs and unions are still tracked when set through KVC.
+			return NULL;
+	}
+
+	#undef MTL_DIRTY_TRACKING_SETTER
+}
+
+// Replaces the implementation of `selector` on `modelClass` with the one
+// returned by `block`, unless the current one was installed by us.
+static void MTLReplaceMethod(Class modelClass, SEL selector, IMP (^block)(IMP originalImplementation)) {
+	Method method = class_getInstanceMethod(modelClass, selector);
+	if (method == NULL) return;
+
+	IMP originalImplementation = method_getImplementation(method);
+
+	NSMutableSet *implementations = MTLDirtyTrackingImplementations();
+	if ([implementations containsObject:[NSValue valueWithPointer:(void *)originalImplementation]]) return;
+
+	IMP implementation = block(originalImplementation);
+	if (implementation == NULL) return;
+
+	[implementations addObject:[NSValue valueWithPointer:(void *)implementation]];
+	class_replaceMethod(modelClass, selector, implementation, method_getTypeEncoding(method));
+}
+
+void MTLModelInstallChangeTracking(Class modelClass) {
+	NSCParameterAssert(modelClass != nil);
+
+	if (objc_getAssociatedObject(modelClass, MTLModelChangeTrackingInstalledKey) != nil) return;
+
+	if (!MTLModelTracksChanges(modelClass)) {
+		objc_setAssociatedObject(modelClass, MTLModelChangeTrackingInstalledKey, @YES, OBJC_ASSOCIATION_RETAIN);
+		return;
+	}
+
+	NSSet *propertyKeys = [modelClass propertyKeys];
+
+	@synchronized (MTLDirtyTrackingImplementations()) {
+		if (objc_getAssociatedObject(modelClass, MTLModelChangeTrackingInstalledKey) != nil) return;
+		for (NSString *key in propertyKeys) {
+			objc_property_t property = class_getProperty(modelClass, key.UTF8String);
+			if (property == NULL) continue;
+
+			mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+			if (attributes == NULL) continue;
+
+			@onExit {
+				free(attributes);
+			};
+
+			// Readonly properties can only be set through KVC.
+			if (attributes->readonly) continue;
+
+			SEL setter = attributes->setter;
+			const char *type = attributes->type;
+
+			MTLReplaceMethod(modelClass, setter, ^(IMP originalImplementation) {
+				return MTLDirtyTrackingSetter(setter, originalImplementation, key, type);
+			});
+		}
+
+		// KVC may set properties without calling their setters.
+		MTLReplaceMethod(modelClass, @selector(setValue:forKey:), ^(IMP originalImplementation) {
+			return imp_implementationWithBlock(^(id self, id value, NSString *key) {
+				((void (*)(id, SEL, id, NSString *))originalImplementation)(self, @selector(setValue:forKey:), value, key);
+
+				if ([propertyKeys containsObject:key]) MTLModelDidSetValueForKey(self, key);
+			});
+		});
+
+		// -copyWithZone: sets every property of the copy.
+		MTLReplaceMethod(modelClass, @selector(copyWithZone:), ^(IMP originalImplementation) {
+			return imp_implementationWithBlock(^ id (id self, NSZone *zone) {
+				id copy = ((id (*)(id, SEL, NSZone *))originalImplementation)(self, @selector(copyWithZone:), zone);
+				if (copy == nil || copy == self) return copy;
+
+				NSMutableSet *dirtyKeys = [objc_getAssociatedObject(self, MTLModelDirtyPropertyKeysKey) mutableCopy];
+				objc_setAssociatedObject(copy, MTLModelDirtyPropertyKeysKey, dirtyKeys, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+				// The copy is equal, so it serializes to the same JSON.
+				objc_setAssociatedObject(copy, MTLModelJSONCacheKey, objc_getAssociatedObject(self, MTLModelJSONCacheKey), OBJC_ASSOCIATION_RETAIN);
+
+				return copy;
+			});
+		});
+
+		objc_setAssociatedObject(modelClass, MTLModelChangeTrackingInstalledKey, @YES, OBJC_ASSOCIATION_RETAIN);
+	}
+}
+
+void MTLModelDiscardDirtyPropertyKeys(id model) {
+	if (![model isKindOfClass:MTLModel.class] || ![[model class] tracksDirtyPropertyKeys]) return;
+
+	objc_setAssociatedObject(model, MTLModelDirtyPropertyKeysKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
+
+void MTLModelDiscardDirtyPropertyKey(id model, NSString *propertyKey) {
+	if (![model isKindOfClass:MTLModel.class] || ![[model class] tracksDirtyPropertyKeys]) return;
+
+	NSMutableSet *dirtyKeys = objc_getAssociatedObject(model, MTLModelDirtyPropertyKeysKey);
+	[dirtyKeys removeObject:propertyKey];
+}
+
+NSDictionary *MTLModelCachedJSONDictionary(id model, Class adapterClass) {
+	MTLModelJSONCache *cache = objc_getAssociatedObject(model, MTLModelJSONCacheKey);
+
+	return (cache.adapterClass == adapterClass ? cache.JSONDictionary : nil);
+}
+
+void MTLModelCacheJSONDictionary(id model, Class adapterClass, NSDictionary *JSONDictionary) {
+	MTLModelJSONCache *cache = [[MTLModelJSONCache alloc] initWithAdapterClass:adapterClass JSONDictionary:JSONDictionary];
+	objc_setAssociatedObject(model, MTLModelJSONCacheKey, cache, OBJC_ASSOCIATION_RETAIN);
+}
+
+@implementation MTLModel (DirtyTracking)
+
++ (BOOL)tracksDirtyPropertyKeys {
+	return NO;
+}
+
+- (NSSet *)dirtyPropertyKeys {
+	NSSet *dirtyKeys = objc_getAssociatedObject(self, MTLModelDirtyPropertyKeysKey);
+
+	return [dirtyKeys copy] ?: [NSSet set];
+}
+
+- (NSSet *)snapshotDirtyPropertyKeys {
+	NSSet *dirtyKeys = self.dirtyPropertyKeys;
+	objc_setAssociatedObject(self, MTLModelDirtyPropertyKeysKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+
+	return dirtyKeys;
+}
+
+@end
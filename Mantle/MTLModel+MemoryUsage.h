@@ -0,0 +1,88 @@
+//
+//  MTLModel+MemoryUsage.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The estimated memory used by the instances of one model class within a
+/// graph of models.
+@interface MTLModelClassMemoryUsage : NSObject
+
+/// The class of the models.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// The number of distinct instances of the class in the graph.
+@property (nonatomic, assign, readonly) NSUInteger instanceCount;
+
+/// The bytes used by the instances themselves.
+@property (nonatomic, assign, readonly) NSUInteger shallowBytes;
+
+/// The shallow bytes of the instances, plus the bytes of the strings, data,
+/// numbers and collections they own.
+///
+/// This is not the full retained size of the instances: nested models are
+/// reported under their own class instead, so that the retained bytes of every
+/// class add up to the size of the graph. An object reachable from several
+/// models is counted once, towards the model which reaches it first.
+@property (nonatomic, assign, readonly) NSUInteger retainedBytes;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// The estimated memory retained by a graph of models.
+///
+/// Sizes are estimates: objects are sized by their allocation where the
+/// platform exposes it, plus the contents of strings, data and collections.
+/// Objects which don't live on the heap, like tagged pointers, take no bytes.
+@interface MTLModelMemoryUsage : NSObject
+
+/// Measures the models, collections and other objects in `objects`, and
+/// everything reachable from them.
+///
+/// The graph is walked through the permanent properties of models, as
+/// determined by +storageBehaviorForPropertyWithKey:, and through the contents
+/// of arrays, sets, ordered sets and dictionaries. Each object is visited once,
+/// so shared and cyclic references are handled, and the walk takes time linear
+/// in the size of the graph.
+///
+/// The graph must not be mutated while it is being measured.
+///
+/// objects - The roots of the graph, like the values of a cache. This argument
+///           must not be nil.
++ (instancetype)memoryUsageOfObjects:(id<NSFastEnumeration>)objects;
+
+/// The number of distinct objects in the graph.
+@property (nonatomic, assign, readonly) NSUInteger objectCount;
+
+/// The bytes used by all the objects in the graph.
+///
+/// This is the sum of the retained bytes of every model class, plus the bytes
+/// of any collections or other objects given as roots.
+@property (nonatomic, assign, readonly) NSUInteger totalBytes;
+
+/// The usage of every model class in the graph, keyed by class name.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, MTLModelClassMemoryUsage *> *usageByClassName;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+@interface MTLModel (MemoryUsage)
+
+/// Estimates the memory retained by the receiver and the models, collections
+/// and other objects reachable from it.
+///
+/// This is equivalent to passing the receiver to
+/// +[MTLModelMemoryUsage memoryUsageOfObjects:].
+- (MTLModelMemoryUsage *)memoryUsage;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,259 @@
+//
+//  MTLModel+MemoryUsage.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#if __has_include(<malloc/malloc.h>)
+#import <malloc/malloc.h>
+#define MTL_HAS_MALLOC_SIZE 1
+#endif
+
+#import "MTLModel+MemoryUsage.h"
+#import "MTLPropertyAccessor.h"
+#import "MTLTracing.h"
+
+// Used to cache the accessors of the properties walked by
+// +[MTLModelMemoryUsage memoryUsageOfObjects:].
+static void *MTLModelCachedMemoryUsageAccessorsKey = &MTLModelCachedMemoryUsageAccessorsKey;
+
+// Returns the accessors of the permanent object properties of a model class.
+//
+// Primitive and struct properties are stored within the model, and transitory
+// properties aren't owned by it, so neither are walked.
+static NSArray<MTLPropertyAccessor *> *MTLMemoryUsageAccessorsForClass(Class modelClass) {
+	NSArray *cachedAccessors = objc_getAssociatedObject(modelClass, MTLModelCachedMemoryUsageAccessorsKey);
+	if (cachedAccessors != nil) return cachedAccessors;
+
+	MTL_PROBE2(cache__miss, class_getName(modelClass), "memoryUsage");
+
+	NSMutableArray *accessors = [NSMutableArray array];
+
+	for (NSString *key in [modelClass propertyKeys]) {
+		if ([modelClass storageBehaviorForPropertyWithKey:key] != MTLPropertyStoragePermanent) continue;
+
+		MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:modelClass];
+		if (accessor.kind != MTLPropertyAccessorKindObject) continue;
+
+		[accessors addObject:accessor];
+	}
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLModelCachedMemoryUsageAccessorsKey, accessors, OBJC_ASSOCIATION_COPY);
+
+	return accessors;
+}
+
+// Estimates the bytes used by an object, excluding the objects it references.
+static NSUInteger MTLShallowSizeOfObject(id object) {
+	NSUInteger size = class_getInstanceSize(object_getClass(object));
+
+	if ([object isKindOfClass:NSString.class]) {
+		NSString *string = object;
+		size += string.length * (string.fastestEncoding == NSUnicodeStringEncoding ? sizeof(unichar) : 1);
+	} else if ([object isKindOfClass:NSData.class]) {
+		size += [object length];
+	} else if ([object isKindOfClass:NSDictionary.class]) {
+		size += 2 * [object count] * sizeof(id);
+	} else if ([object isKindOfClass:NSArray.class] || [object isKindOfClass:NSSet.class] || [object isKindOfClass:NSOrderedSet.class]) {
+		size += [object count] * sizeof(id);
+	}
+
+	#if MTL_HAS_MALLOC_SIZE
+	NSUInteger allocatedSize = malloc_size((__bridge const void *)object);
+
+	// Tagged pointers and constant objects don't live on the heap.
+	if (allocatedSize == 0) return 0;
+
+	// Immutable strings, data and collections usually store their contents
+	// within their own allocation.
+	size = MAX(size, allocatedSize);
+	#endif
+
+	return size;
+}
+
+// An object waiting to be measured, and the usage of the model class it is
+// attributed to, if any.
+typedef struct {
+	__unsafe_unretained id object;
+	__unsafe_unretained MTLModelClassMemoryUsage *owner;
+} MTLMemoryUsageEntry;
+
+// The objects waiting to be measured, in a growable buffer.
+typedef struct {
+	MTLMemoryUsageEntry *entries;
+	NSUInteger count;
+	NSUInteger capacity;
+
+	// Every object ever pushed, since getters may return objects which aren't
+	// owned by their model, and which would otherwise be deallocated before
+	// being measured, or while their address is still in the visited set.
+	__unsafe_unretained NSMutableArray *pushedObjects;
+} MTLMemoryUsageStack;
+
+static void MTLMemoryUsageStackPush(MTLMemoryUsageStack *stack, id object, MTLModelClassMemoryUsage *owner) {
+	[stack->pushedObjects addObject:object];
+
+	if (stack->count == stack->capacity) {
+		stack->capacity = MAX(2 * stack->capacity, 64);
+		stack->entries = realloc(stack->entries, stack->capacity * sizeof(*stack->entries));
+	}
+
+	stack->entries[stack->count++] = (MTLMemoryUsageEntry){ object, owner };
+}
+
+@interface MTLModelClassMemoryUsage ()
+
+- (instancetype)initWithModelClass:(Class)modelClass;
+
+@property (nonatomic, assign, readwrite) NSUInteger instanceCount;
+@property (nonatomic, assign, readwrite) NSUInteger shallowBytes;
+@property (nonatomic, assign, readwrite) NSUInteger retainedBytes;
+
+@end
+
+@implementation MTLModelClassMemoryUsage
+
+- (instancetype)initWithModelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+
+	return self;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@: %lu instances, %lu shallow bytes, %lu retained bytes", self.class, self, self.modelClass, (unsigned long)self.instanceCount, (unsigned long)self.shallowBytes, (unsigned long)self.retainedBytes];
+}
+
+@end
+
+@interface MTLModelMemoryUsage ()
+
+- (instancetype)initWithObjectCount:(NSUInteger)objectCount totalBytes:(NSUInteger)totalBytes usageByClassName:(NSDictionary *)usageByClassName;
+
+@end
+
+@implementation MTLModelMemoryUsage
+
++ (instancetype)memoryUsageOfObjects:(id<NSFastEnumeration>)objects {
+	NSParameterAssert(objects != nil);
+
+	// Walk depth first without recursing, so that deep graphs can't overflow
+	// the call stack.
+	NSMutableArray *pushedObjects = [NSMutableArray array];
+	MTLMemoryUsageStack stack = { NULL, 0, 0, pushedObjects };
+	MTLMemoryUsageStack *stackPointer = &stack;
+
+	for (id object in objects) {
+		MTLMemoryUsageStackPush(stackPointer, object, nil);
+	}
+
+	NSHashTable *visitedObjects = [NSHashTable hashTableWithOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality];
+	NSMapTable *usageByClass = [NSMapTable strongToStrongObjectsMapTable];
+
+	NSUInteger objectCount = 0;
+	NSUInteger totalBytes = 0;
+
+	// Models of the same class tend to be adjacent, so skip the lookup for them.
+	__unsafe_unretained Class lastClass = Nil;
+	__unsafe_unretained MTLModelClassMemoryUsage *lastUsage = nil;
+	__unsafe_unretained NSArray *lastAccessors = nil;
+
+	while (stack.count > 0) {
+		MTLMemoryUsageEntry entry = stack.entries[--stack.count];
+		id object = entry.object;
+
+		if ([visitedObjects containsObject:object]) continue;
+		[visitedObjects addObject:object];
+
+		NSUInteger size = MTLShallowSizeOfObject(object);
+		objectCount++;
+		totalBytes += size;
+
+		if ([object isKindOfClass:MTLModel.class]) {
+			Class modelClass = [object class];
+			if (modelClass != lastClass) {
+				MTLModelClassMemoryUsage *usage = [usageByClass objectForKey:modelClass];
+				if (usage == nil) {
+					usage = [[MTLModelClassMemoryUsage alloc] initWithModelClass:modelClass];
+					[usageByClass setObject:usage forKey:modelClass];
+				}
+
+				lastClass = modelClass;
+				lastUsage = usage;
+				lastAccessors = MTLMemoryUsageAccessorsForClass(modelClass);
+			}
+
+			lastUsage.instanceCount++;
+			lastUsage.shallowBytes += size;
+			lastUsage.retainedBytes += size;
+
+			for (MTLPropertyAccessor *accessor in lastAccessors) {
+				id value = [accessor objectValueOfModel:object];
+				if (value != nil) MTLMemoryUsageStackPush(stackPointer, value, lastUsage);
+			}
+
+			continue;
+		}
+
+		MTLModelClassMemoryUsage *owner = entry.owner;
+		owner.retainedBytes += size;
+
+		if ([object isKindOfClass:NSDictionary.class]) {
+			[object enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+				MTLMemoryUsageStackPush(stackPointer, key, owner);
+				MTLMemoryUsageStackPush(stackPointer, value, owner);
+			}];
+		} else if ([object isKindOfClass:NSArray.class] || [object isKindOfClass:NSSet.class] || [object isKindOfClass:NSOrderedSet.class]) {
+			for (id element in object) {
+				MTLMemoryUsageStackPush(stackPointer, element, owner);
+			}
+		}
+	}
+
+	free(stack.entries);
+
+	NSMutableDictionary *usageByClassName = [NSMutableDictionary dictionaryWithCapacity:usageByClass.count];
+	for (Class modelClass in usageByClass) {
+		usageByClassName[NSStringFromClass(modelClass)] = [usageByClass objectForKey:modelClass];
+	}
+
+	return [[self alloc] initWithObjectCount:objectCount totalBytes:totalBytes usageByClassName:usageByClassName];
+}
+
+- (instancetype)initWithObjectCount:(NSUInteger)objectCount totalBytes:(NSUInteger)totalBytes usageByClassName:(NSDictionary *)usageByClassName {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_objectCount = objectCount;
+	_totalBytes = totalBytes;
+	_usageByClassName = [usageByClassName copy];
+
+	return self;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %lu objects, %lu bytes, %@", self.class, self, (unsigned long)self.objectCount, (unsigned long)self.totalBytes, self.usageByClassName];
+}
+
+@end
+
+@implementation MTLModel (MemoryUsage)
+
+- (MTLModelMemoryUsage *)memoryUsage {
+	return [MTLModelMemoryUsage memoryUsageOfObjects:@[ self ]];
+}
+
+@end
@@ -10,6 +10,8 @@
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/EXTScope.h>
 #import "MTLReflection.h"
+#import "MTLTracing.h"
+#import "NSKeyValueCoding+MTLValidationAdditions.h"
 
 // Used in archives to store the modelVersion of the archived instance.
 static NSString * const MTLModelVersionKey = @"MTLModelVersion";
@@ -17,27 +19,122 @@ static NSString * const MTLModelVersionKey = @"MTLModelVersion";
 // Used to cache the reflection performed in +allowedSecureCodingClassesByPropertyKey.
 static void *MTLModelCachedAllowedClassesKey = &MTLModelCachedAllowedClassesKey;
 
-// Returns all of the given class' encodable property keys (those that will not
-// be excluded from archives).
-static NSSet *encodablePropertyKeysForClass(Class modelClass) {
-	return [[modelClass encodingBehaviorsByPropertyKey] keysOfEntriesPassingTest:^ BOOL (NSString *propertyKey, NSNumber *behavior, BOOL *stop) {
+// Used to cache the MTLModelCodingCache of a class.
+static void *MTLModelCachedCodingCacheKey = &MTLModelCachedCodingCacheKey;
+
+// Caches everything archiving and unarchiving needs to know about a model
+// class, so that it is computed once per class instead of once per instance.
+//
+// The secure coding information is computed the first time it's needed, since
+// +allowedSecureCodingClassesByPropertyKey may not be valid for classes which
+// are never securely coded.
+@interface MTLModelCodingCache : NSObject
+
+// The result of +encodingBehaviorsByPropertyKey, without excluded keys.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSNumber *> *encodingBehaviorsByPropertyKey;
+
+// Maps the property keys to their `-decode<Key>WithCoder:modelVersion:`
+// selectors, boxed in NSValues, or to NSNull if the class doesn't implement
+// one.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, id> *decodingSelectorsByPropertyKey;
+
+// Whether the class overrides -initWithDictionary:error:, in which case
+// unarchived values have to be passed through it.
+@property (nonatomic, assign, readonly) BOOL overridesInitWithDictionary;
+
+// The values of +allowedSecureCodingClassesByPropertyKey, as sets.
+@property (nonatomic, copy, readonly) NSDictionary<NSString *, NSSet *> *allowedClassSetsByPropertyKey;
+
+- (instancetype)initWithModelClass:(Class)modelClass;
+
+// Throws an exception if the model class cannot be coded securely.
+- (void)verifySecureCoding;
+
+@end
+
+@implementation MTLModelCodingCache {
+	__unsafe_unretained Class _modelClass;
+
+	dispatch_once_t _secureCodingOnceToken;
+	NSDictionary<NSString *, NSSet *> *_allowedClassSetsByPropertyKey;
+	NSSet *_keysMissingFromAllowedClasses;
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+
+	_encodingBehaviorsByPropertyKey = [[modelClass encodingBehaviorsByPropertyKey] dictionaryWithValuesForKeys:[[modelClass encodingBehaviorsByPropertyKey] keysOfEntriesPassingTest:^ BOOL (NSString *propertyKey, NSNumber *behavior, BOOL *stop) {
 		return behavior.unsignedIntegerValue != MTLModelEncodingBehaviorExcluded;
-	}];
+	}].allObjects];
+
+	NSSet *propertyKeys = [modelClass propertyKeys];
+	NSMutableDictionary *decodingSelectors = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+	for (NSString *key in propertyKeys) {
+		SEL selector = MTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
+
+		decodingSelectors[key] = [modelClass instancesRespondToSelector:selector] ? [NSValue valueWithPointer:selector] : NSNull.null;
+	}
+
+	_decodingSelectorsByPropertyKey = [decodingSelectors copy];
+
+	_overridesInitWithDictionary = [modelClass instanceMethodForSelector:@selector(initWithDictionary:error:)] != [MTLModel instanceMethodForSelector:@selector(initWithDictionary:error:)];
+
+	return self;
+}
+
+- (void)computeSecureCodingInformation {
+	dispatch_once(&_secureCodingOnceToken, ^{
+		NSDictionary *allowedClasses = [_modelClass allowedSecureCodingClassesByPropertyKey];
+		NSMutableDictionary *allowedClassSets = [[NSMutableDictionary alloc] initWithCapacity:allowedClasses.count];
+
+		[allowedClasses enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSArray *classes, BOOL *stop) {
+			allowedClassSets[key] = [NSSet setWithArray:classes];
+		}];
+
+		NSMutableSet *specifiedPropertyKeys = [[NSMutableSet alloc] initWithArray:allowedClasses.allKeys];
+		[specifiedPropertyKeys minusSet:[NSSet setWithArray:self.encodingBehaviorsByPropertyKey.allKeys]];
+
+		_allowedClassSetsByPropertyKey = [allowedClassSets copy];
+		_keysMissingFromAllowedClasses = [specifiedPropertyKeys copy];
+	});
 }
 
-// Verifies that all of the specified class' encodable property keys are present
-// in +allowedSecureCodingClassesByPropertyKey, and throws an exception if not.
-static void verifyAllowedClassesByPropertyKey(Class modelClass) {
-	NSDictionary *allowedClasses = [modelClass allowedSecureCodingClassesByPropertyKey];
+- (NSDictionary *)allowedClassSetsByPropertyKey {
+	[self computeSecureCodingInformation];
+	return _allowedClassSetsByPropertyKey;
+}
 
-	NSMutableSet *specifiedPropertyKeys = [[NSMutableSet alloc] initWithArray:allowedClasses.allKeys];
-	[specifiedPropertyKeys minusSet:encodablePropertyKeysForClass(modelClass)];
+- (void)verifySecureCoding {
+	[self computeSecureCodingInformation];
 
-	if (specifiedPropertyKeys.count > 0) {
-		[NSException raise:NSInvalidArgumentException format:@"Cannot encode %@ securely, because keys are missing from +allowedSecureCodingClassesByPropertyKey: %@", modelClass, specifiedPropertyKeys];
+	if (_keysMissingFromAllowedClasses.count > 0) {
+		[NSException raise:NSInvalidArgumentException format:@"Cannot encode %@ securely, because keys are missing from +allowedSecureCodingClassesByPropertyKey: %@", _modelClass, _keysMissingFromAllowedClasses];
 	}
 }
 
+@end
+
+// Returns the MTLModelCodingCache of the given class, creating it if
+// necessary.
+static MTLModelCodingCache *codingCacheForClass(Class modelClass) {
+	MTLModelCodingCache *cache = objc_getAssociatedObject(modelClass, MTLModelCachedCodingCacheKey);
+	if (cache != nil) return cache;
+
+	MTL_PROBE2(cache__miss, class_getName(modelClass), "coding");
+
+	cache = [[MTLModelCodingCache alloc] initWithModelClass:modelClass];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, MTLModelCachedCodingCacheKey, cache, OBJC_ASSOCIATION_RETAIN);
+
+	return cache;
+}
+
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wobjc-protocol-method-implementation"
 @implementation MTLModel (NSCoding)
@@ -74,6 +171,8 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	NSDictionary *cachedClasses = objc_getAssociatedObject(self, MTLModelCachedAllowedClassesKey);
 	if (cachedClasses != nil) return cachedClasses;
 
+	MTL_PROBE2(cache__miss, class_getName(self), "allowedSecureCodingClasses");
+
 	// Get all property keys that could potentially be encoded.
 	NSSet *propertyKeys = [self.encodingBehaviorsByPropertyKey keysOfEntriesPassingTest:^ BOOL (NSString *propertyKey, NSNumber *behavior, BOOL *stop) {
 		return behavior.unsignedIntegerValue != MTLModelEncodingBehaviorExcluded;
@@ -114,8 +213,18 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	NSParameterAssert(key != nil);
 	NSParameterAssert(coder != nil);
 
-	SEL selector = MTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
-	if ([self respondsToSelector:selector]) {
+	MTLModelCodingCache *cache = codingCacheForClass(self.class);
+
+	SEL selector = NULL;
+	id cachedSelector = cache.decodingSelectorsByPropertyKey[key];
+	if (cachedSelector == nil) {
+		selector = MTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
+		if (![self respondsToSelector:selector]) selector = NULL;
+	} else if (cachedSelector != NSNull.null) {
+		selector = [cachedSelector pointerValue];
+	}
+
+	if (selector != NULL) {
 		IMP imp = [self methodForSelector:selector];
 		id (*function)(id, SEL, NSCoder *, NSUInteger) = (__typeof__(function))imp;
 		id result = function(self, selector, coder, modelVersion);
@@ -125,10 +234,15 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 
 	@try {
 		if (coder.requiresSecureCoding) {
-			NSArray *allowedClasses = self.class.allowedSecureCodingClassesByPropertyKey[key];
+			NSSet *allowedClasses = cache.allowedClassSetsByPropertyKey[key];
+
+			// Keys which are never encoded have no allowed classes, but there's
+			// nothing to decode for them either.
+			if (allowedClasses == nil && ![coder containsValueForKey:key]) return nil;
+
 			NSAssert(allowedClasses != nil, @"No allowed classes specified for securely decoding key \"%@\" on %@", key, self.class);
 			
-			return [coder decodeObjectOfClasses:[NSSet setWithArray:allowedClasses] forKey:key];
+			return [coder decodeObjectOfClasses:allowedClasses forKey:key];
 		} else {
 			return [coder decodeObjectForKey:key];
 		}
@@ -141,6 +255,18 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 #pragma mark NSCoding
 
 - (instancetype)initWithCoder:(NSCoder *)coder {
+	// Kept for the tracepoints, since `self` may be nil by the end.
+	__unused Class modelClass = self.class;
+	MTL_PROBE1(coder__decode__start, class_getName(modelClass));
+
+	self = [self initWithVersionedCoder:coder];
+
+	MTL_PROBE2(coder__decode__done, class_getName(modelClass), self != nil);
+	return self;
+}
+
+// Implements -initWithCoder:.
+- (instancetype)initWithVersionedCoder:(NSCoder *)coder {
 	NSNumber *version = [coder decodeObjectOfClass:NSNumber.class forKey:MTLModelVersionKey];
 	if (version == nil) {
 		NSLog(@"Warning: decoding an archive of %@ without a version, assuming 0", self.class);
@@ -149,8 +275,10 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 		return nil;
 	}
 
+	MTLModelCodingCache *cache = codingCacheForClass(self.class);
+
 	if (coder.requiresSecureCoding) {
-		verifyAllowedClassesByPropertyKey(self.class);
+		[cache verifySecureCoding];
 	} else {
 		// Handle the old archive format.
 		NSDictionary *externalRepresentation = [coder decodeObjectForKey:@"externalRepresentation"];
@@ -169,36 +297,69 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	}
 
 	NSSet *propertyKeys = self.class.propertyKeys;
-	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+	NSError *error = nil;
+
+	if (cache.overridesInitWithDictionary) {
+		NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+		for (NSString *key in propertyKeys) {
+			id value = [self decodeValueForKey:key withCoder:coder modelVersion:version.unsignedIntegerValue];
+			if (value == nil) continue;
+
+			dictionaryValue[key] = value;
+		}
+
+		self = [self initWithDictionary:dictionaryValue error:&error];
+		if (self == nil) NSLog(@"*** Could not unarchive %@: %@", self.class, error);
+
+		return self;
+	}
+
+	// Equivalent to MTLModel's -initWithDictionary:error:, without collecting
+	// the values into a dictionary first.
+	self = [self init];
+	if (self == nil) return nil;
 
 	for (NSString *key in propertyKeys) {
-		id value = [self decodeValueForKey:key withCoder:coder modelVersion:version.unsignedIntegerValue];
+		__autoreleasing id value = [self decodeValueForKey:key withCoder:coder modelVersion:version.unsignedIntegerValue];
 		if (value == nil) continue;
 
-		dictionaryValue[key] = value;
-	}
+		if ([value isEqual:NSNull.null]) value = nil;
 
-	NSError *error = nil;
-	self = [self initWithDictionary:dictionaryValue error:&error];
-	if (self == nil) NSLog(@"*** Could not unarchive %@: %@", self.class, error);
+		if (!MTLValidateAndSetValue(self, key, value, YES, &error)) {
+			NSLog(@"*** Could not unarchive %@: %@", self.class, error);
+			return nil;
+		}
+	}
 
 	return self;
 }
 
 - (void)encodeWithCoder:(NSCoder *)coder {
+	MTL_PROBE1(coder__encode__start, object_getClassName(self));
+
+	MTLModelCodingCache *cache = codingCacheForClass(self.class);
+
 	if (coder.requiresSecureCoding) {
-		verifyAllowedClassesByPropertyKey(self.class);
+		[cache verifySecureCoding];
 	}
 
 	[coder encodeObject:@(self.class.modelVersion) forKey:MTLModelVersionKey];
 
-	NSDictionary *encodingBehaviors = self.class.encodingBehaviorsByPropertyKey;
-	[self.dictionaryValue enumerateKeysAndObjectsUsingBlock:^(NSString *key, id value, BOOL *stop) {
+	NSDictionary *encodingBehaviors = cache.encodingBehaviorsByPropertyKey;
+	NSSet *propertyKeys = self.class.propertyKeys;
+
+	[encodingBehaviors enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSNumber *behavior, BOOL *stop) {
+		// Only keys in -dictionaryValue are archived.
+		if (![propertyKeys containsObject:key]) return;
+
 		@try {
+			id value = [self valueForKey:key];
+
 			// Skip nil values.
-			if ([value isEqual:NSNull.null]) return;
+			if (value == nil || [value isEqual:NSNull.null]) return;
 			
-			switch ([encodingBehaviors[key] unsignedIntegerValue]) {
+			switch (behavior.unsignedIntegerValue) {
 					// This will also match a nil behavior.
 				case MTLModelEncodingBehaviorExcluded:
 					break;
@@ -219,6 +380,8 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 			@throw ex;
 		}
 	}];
+
+	MTL_PROBE1(coder__encode__done, object_getClassName(self));
 }
 
 #pragma mark NSSecureCoding
@@ -114,6 +114,37 @@ typedef NS_ENUM(NSInteger, MTLPropertyStorage) {
 /// `model` must be an instance of the receiver's class or a subclass thereof.
 - (void)mergeValuesForKeysFromModel:(id<MTLModel>)model;
 
+/// Merges the values of the given model object into the receiver like
+/// -mergeValuesForKeysFromModel:, but only sets the values which differ from the
+/// receiver's, so unchanged keys don't trigger key-value observing.
+///
+/// Keys merged with a `-merge<Key>FromModel:` method, or by an override of
+/// -mergeValueForKey:fromModel:, are always merged, and are considered changed
+/// if their value before and after merging isn't equal.
+///
+/// `model` must be an instance of the receiver's class or a subclass thereof.
+///
+/// Returns the keys whose values changed.
+- (NSSet<NSString *> *)mergeChangedValuesForKeysFromModel:(id<MTLModel>)model;
+
+/// Returns a copy of the receiver with the given properties changed, leaving
+/// the receiver untouched.
+///
+/// The copy is made with -copy, which by default copies each property by
+/// calling its getter and setter directly, so unchanged values are shared with
+/// the receiver rather than transformed or validated again. Only the given
+/// values are validated and set, and values equal to the receiver's are
+/// skipped. If the receiver's class overrides -validate:, it is called on the
+/// copy afterwards.
+///
+/// values - The property keys and their new values. NSNull values are
+///          converted to nil. This argument must not be nil.
+/// error  - If not NULL, this may be set to any error that occurs during
+///          validation.
+///
+/// Returns the updated copy, or nil if validation failed.
+- (nullable instancetype)modelByUpdatingValues:(NSDictionary<NSString *, id> *)values error:(NSError **)error;
+
 /// The storage behavior of a given key.
 ///
 /// The default implementation returns MTLPropertyStorageNone for properties that
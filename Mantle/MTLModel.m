@@ -8,11 +8,15 @@
 
 #import "NSError+MTLModelException.h"
 #import "MTLModel.h"
+#import "MTLModelDirtyTracking.h"
+#import "MTLPropertyAccessor.h"
 #import <Mantle/EXTRuntimeExtensions.h>
 #import <Mantle/EXTScope.h>
 #import "MTLReflection.h"
+#import "MTLTracing.h"
 #import <objc/runtime.h>
 #import "NSKeyValueCoding+MTLValidationAdditions.h"
+#import "NSObject+MTLComparisonAdditions.h"
 
 // Used to cache the reflection performed in +propertyKeys.
 static void *MTLModelCachedPropertyKeysKey = &MTLModelCachedPropertyKeysKey;
@@ -25,6 +29,39 @@ static void *MTLModelCachedTransitoryPropertyKeysKey = &MTLModelCachedTransitory
 // property keys.
 static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPropertyKeysKey;
 
+// Associated in +mergeStepsFromModelClass: with a map table from each class
+// merged from to the steps for merging its instances.
+static void *MTLModelCachedMergeStepsKey = &MTLModelCachedMergeStepsKey;
+
+// Associated in -cachedCopySlots with the slots for copying instances of the
+// class.
+static void *MTLModelCachedCopySlotsKey = &MTLModelCachedCopySlotsKey;
+
+// Copies the value of one property between models, calling its getter and
+// setter directly.
+@interface MTLModelCopySlot : NSObject
+
+// sourceClass      - The class of the models copied from, which may be a
+//                    subclass created at runtime, like those of KVO.
+// destinationClass - The class of the copies, as returned by -class.
+- (instancetype)initWithKey:(NSString *)key sourceClass:(Class)sourceClass destinationClass:(Class)destinationClass;
+
+- (void)copyValueFromModel:(MTLModel *)source toModel:(MTLModel *)destination;
+
+@end
+
+// Merges one key from models of one class into models of another.
+@interface MTLModelMergeStep : NSObject
+
+- (instancetype)initWithKey:(NSString *)key destinationClass:(Class)destinationClass sourceClass:(Class)sourceClass;
+
+@property (nonatomic, copy, readonly) NSString *key;
+
+// Merges the value of the key, returning whether it changed.
+- (BOOL)mergeValueFromModel:(id<MTLModel>)source intoModel:(MTLModel *)destination;
+
+@end
+
 @interface MTLModel ()
 
 // Inspects all properties of returned by +propertyKeys using
@@ -46,6 +83,15 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 // multiple classes in the hierarchy.
 + (void)enumeratePropertiesUsingBlock:(void (^)(objc_property_t property, BOOL *stop))block;
 
+// Returns the steps for merging the keys shared by the receiver and
+// `modelClass` from instances of `modelClass`, creating and caching them if
+// necessary.
++ (NSArray *)mergeStepsFromModelClass:(Class)modelClass;
+
+// Returns the slots for copying every property in +propertyKeys from the
+// receiver, creating and caching them on its runtime class if necessary.
+- (NSArray *)cachedCopySlots;
+
 @end
 
 #pragma clang diagnostic push
@@ -56,7 +102,13 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 
 #pragma mark Lifecycle
 
++ (void)initialize {
+	MTLModelInstallChangeTracking(self);
+}
+
 + (void)generateAndCacheStorageBehaviors {
+	MTL_PROBE2(cache__miss, class_getName(self), "storageBehaviors");
+
 	NSMutableSet *transitoryKeys = [NSMutableSet set];
 	NSMutableSet *permanentKeys = [NSMutableSet set];
 
@@ -86,7 +138,10 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 }
 
 - (instancetype)init {
-	// Nothing special by default, but we have a declaration in the header.
+	// Subclasses whose +initialize doesn't call super skip the installation in
+	// +[MTLModel initialize].
+	MTLModelInstallChangeTracking(self.class);
+
 	return [super init];
 }
 
@@ -137,6 +192,8 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	NSSet *cachedKeys = objc_getAssociatedObject(self, MTLModelCachedPropertyKeysKey);
 	if (cachedKeys != nil) return cachedKeys;
 
+	MTL_PROBE2(cache__miss, class_getName(self), "propertyKeys");
+
 	NSMutableSet *keys = [NSMutableSet set];
 
 	[self enumeratePropertiesUsingBlock:^(objc_property_t property, BOOL *stop) {
@@ -228,14 +285,53 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 	function(self, selector, model);
 }
 
++ (NSArray *)mergeStepsFromModelClass:(Class)modelClass {
+	@synchronized (self) {
+		NSMapTable *stepsByClass = objc_getAssociatedObject(self, MTLModelCachedMergeStepsKey);
+		if (stepsByClass == nil) {
+			stepsByClass = [NSMapTable strongToStrongObjectsMapTable];
+			objc_setAssociatedObject(self, MTLModelCachedMergeStepsKey, stepsByClass, OBJC_ASSOCIATION_RETAIN);
+		}
+
+		NSArray *steps = [stepsByClass objectForKey:modelClass];
+		if (steps != nil) return steps;
+
+		MTL_PROBE2(cache__miss, class_getName(self), "mergeSteps");
+
+		NSSet *propertyKeys = [modelClass propertyKeys];
+		NSMutableArray *mutableSteps = [NSMutableArray array];
+
+		for (NSString *key in self.propertyKeys) {
+			if (![propertyKeys containsObject:key]) continue;
+
+			[mutableSteps addObject:[[MTLModelMergeStep alloc] initWithKey:key destinationClass:self sourceClass:modelClass]];
+		}
+
+		steps = [mutableSteps copy];
+		[stepsByClass setObject:steps forKey:modelClass];
+
+		return steps;
+	}
+}
+
 - (void)mergeValuesForKeysFromModel:(id<MTLModel>)model {
-	NSSet *propertyKeys = model.class.propertyKeys;
+	if (model == nil) return;
 
-	for (NSString *key in self.class.propertyKeys) {
-		if (![propertyKeys containsObject:key]) continue;
+	for (MTLModelMergeStep *step in [self.class mergeStepsFromModelClass:model.class]) {
+		[self mergeValueForKey:step.key fromModel:model];
+	}
+}
+
+- (NSSet *)mergeChangedValuesForKeysFromModel:(id<MTLModel>)model {
+	NSParameterAssert(model != nil);
 
-		[self mergeValueForKey:key fromModel:model];
+	NSMutableSet *changedKeys = [NSMutableSet set];
+
+	for (MTLModelMergeStep *step in [self.class mergeStepsFromModelClass:model.class]) {
+		if ([step mergeValueFromModel:model intoModel:self]) [changedKeys addObject:step.key];
 	}
+
+	return changedKeys;
 }
 
 #pragma mark Validation
@@ -253,12 +349,61 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 
 #pragma mark NSCopying
 
+- (NSArray *)cachedCopySlots {
+	Class sourceClass = object_getClass(self);
+
+	NSArray *cachedSlots = objc_getAssociatedObject(sourceClass, MTLModelCachedCopySlotsKey);
+	if (cachedSlots != nil) return cachedSlots;
+
+	MTL_PROBE2(cache__miss, class_getName(sourceClass), "copySlots");
+
+	NSMutableArray *slots = [NSMutableArray array];
+	for (NSString *key in self.class.propertyKeys) {
+		[slots addObject:[[MTLModelCopySlot alloc] initWithKey:key sourceClass:sourceClass destinationClass:self.class]];
+	}
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(sourceClass, MTLModelCachedCopySlotsKey, slots, OBJC_ASSOCIATION_COPY);
+
+	return slots;
+}
+
 - (instancetype)copyWithZone:(NSZone *)zone {
 	MTLModel *copy = [[self.class allocWithZone:zone] init];
-	[copy setValuesForKeysWithDictionary:self.dictionaryValue];
+
+	for (MTLModelCopySlot *slot in self.cachedCopySlots) {
+		[slot copyValueFromModel:self toModel:copy];
+	}
+
 	return copy;
 }
 
+- (instancetype)modelByUpdatingValues:(NSDictionary *)values error:(NSError **)error {
+	NSParameterAssert(values != nil);
+
+	MTLModel *model = [self copy];
+
+	for (NSString *key in values) {
+		// Mark this as being autoreleased, because validateValue may return
+		// a new object to be stored in this variable (and we don't want ARC to
+		// double-free or leak the old or new values).
+		__autoreleasing id value = values[key];
+		if ([value isEqual:NSNull.null]) value = nil;
+
+		if (MTLEqualObjects(value, [model valueForKey:key])) continue;
+
+		if (!MTLValidateAndSetValue(model, key, value, YES, error)) return nil;
+	}
+
+	// Validating every property would defeat the point, but subclasses may
+	// check invariants spanning several properties.
+	BOOL validatesModel = [self.class instanceMethodForSelector:@selector(validate:)] != [MTLModel instanceMethodForSelector:@selector(validate:)];
+	if (validatesModel && ![model validate:error]) return nil;
+
+	return model;
+}
+
 #pragma mark NSObject
 
 - (NSString *)description {
@@ -294,3 +439,170 @@ static void *MTLModelCachedPermanentPropertyKeysKey = &MTLModelCachedPermanentPr
 
 @end
 #pragma clang diagnostic pop
+
+@implementation MTLModelMergeStep {
+	// Set if the destination class overrides -mergeValueForKey:fromModel:.
+	BOOL _usesMergeValueForKey;
+
+	// The destination class's -merge<Key>FromModel: method, if it has one.
+	SEL _mergeSelector;
+	IMP _mergeImplementation;
+
+	// The accessors for the key, if it is a property of a supported type.
+	MTLPropertyAccessor *_sourceAccessor;
+	MTLPropertyAccessor *_destinationAccessor;
+}
+
+- (instancetype)initWithKey:(NSString *)key destinationClass:(Class)destinationClass sourceClass:(Class)sourceClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_key = [key copy];
+
+	SEL mergeValueSelector = @selector(mergeValueForKey:fromModel:);
+	_usesMergeValueForKey = [destinationClass instanceMethodForSelector:mergeValueSelector] != [MTLModel instanceMethodForSelector:mergeValueSelector];
+
+	SEL mergeSelector = MTLSelectorWithCapitalizedKeyPattern("merge", key, "FromModel:");
+	if (mergeSelector != NULL && [destinationClass instancesRespondToSelector:mergeSelector]) {
+		_mergeSelector = mergeSelector;
+		_mergeImplementation = [destinationClass instanceMethodForSelector:mergeSelector];
+	}
+
+	_sourceAccessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:sourceClass];
+	_destinationAccessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:destinationClass];
+
+	return self;
+}
+
+- (id)valueOfModel:(id)model accessor:(MTLPropertyAccessor *)accessor {
+	if (accessor != nil) return [accessor objectValueOfModel:model];
+
+	return [model valueForKey:self.key];
+}
+
+- (BOOL)mergeValueFromModel:(id<MTLModel>)source intoModel:(MTLModel *)destination {
+	if (_usesMergeValueForKey || _mergeSelector != NULL) {
+		id oldValue = [self valueOfModel:destination accessor:_destinationAccessor];
+
+		if (_usesMergeValueForKey) {
+			[destination mergeValueForKey:self.key fromModel:source];
+		} else {
+			void (*function)(id, SEL, id<MTLModel>) = (__typeof__(function))_mergeImplementation;
+			function(destination, _mergeSelector, source);
+		}
+
+		return !MTLEqualObjects(oldValue, [self valueOfModel:destination accessor:_destinationAccessor]);
+	}
+
+	// Compare primitive values without boxing them, since most merges don't
+	// change most keys.
+	if (_sourceAccessor != nil && _sourceAccessor.kind == _destinationAccessor.kind) {
+		switch (_sourceAccessor.kind) {
+			case MTLPropertyAccessorKindInt64:
+				if ([_sourceAccessor int64ValueOfModel:source] == [_destinationAccessor int64ValueOfModel:destination]) return NO;
+				break;
+
+			case MTLPropertyAccessorKindDouble:
+				if ([_sourceAccessor doubleValueOfModel:source] == [_destinationAccessor doubleValueOfModel:destination]) return NO;
+				break;
+
+			case MTLPropertyAccessorKindObject:
+				break;
+		}
+	}
+
+	id newValue = [self valueOfModel:source accessor:_sourceAccessor];
+	if (MTLEqualObjects(newValue, [self valueOfModel:destination accessor:_destinationAccessor])) return NO;
+
+	[destination setValue:newValue forKey:self.key];
+	return YES;
+}
+
+@end
+
+@implementation MTLModelCopySlot {
+	NSString *_key;
+
+	SEL _getter;
+	IMP _getterImplementation;
+
+	// The setter of the property, or NULL if the value is copied through KVC.
+	SEL _setter;
+	IMP _setterImplementation;
+
+	// The first character of the property's type encoding.
+	char _encoding;
+}
+
+- (instancetype)initWithKey:(NSString *)key sourceClass:(Class)sourceClass destinationClass:(Class)destinationClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_key = [key copy];
+
+	objc_property_t property = class_getProperty(destinationClass, key.UTF8String);
+	if (property == NULL) return self;
+
+	mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+	if (attributes == NULL) return self;
+
+	@onExit {
+		free(attributes);
+	};
+
+	// Readonly properties are set through their instance variables.
+	if (attributes->readonly) return self;
+
+	if (![sourceClass instancesRespondToSelector:attributes->getter] || ![destinationClass instancesRespondToSelector:attributes->setter]) return self;
+
+	switch (attributes->type[0]) {
+		case '@': case '#':
+		case 'c': case 'i': case 's': case 'l': case 'q':
+		case 'C': case 'I': case 'S': case 'L': case 'Q':
+		case 'f': case 'd': case 'B':
+			break;
+
+		default:
+			// Structs and other types are boxed by KVC.
+			return self;
+	}
+
+	_encoding = attributes->type[0];
+	_getter = attributes->getter;
+	_getterImplementation = [sourceClass instanceMethodForSelector:_getter];
+	_setter = attributes->setter;
+	_setterImplementation = [destinationClass instanceMethodForSelector:_setter];
+
+	return self;
+}
+
+- (void)copyValueFromModel:(MTLModel *)source toModel:(MTLModel *)destination {
+	#define MTL_COPY_VALUE(TYPE) \
+		((void (*)(id, SEL, TYPE))_setterImplementation)(destination, _setter, ((TYPE (*)(id, SEL))_getterImplementation)(source, _getter)); \
+		return
+
+	switch (_encoding) {
+		case '@': case '#': MTL_COPY_VALUE(id);
+		case 'c': MTL_COPY_VALUE(char);
+		case 'i': MTL_COPY_VALUE(int);
+		case 's': MTL_COPY_VALUE(short);
+		case 'l': MTL_COPY_VALUE(long);
+		case 'q': MTL_COPY_VALUE(long long);
+		case 'C': MTL_COPY_VALUE(unsigned char);
+		case 'I': MTL_COPY_VALUE(unsigned int);
+		case 'S': MTL_COPY_VALUE(unsigned short);
+		case 'L': MTL_COPY_VALUE(unsigned long);
+		case 'Q': MTL_COPY_VALUE(unsigned long long);
+		case 'f': MTL_COPY_VALUE(float);
+		case 'd': MTL_COPY_VALUE(double);
+		case 'B': MTL_COPY_VALUE(bool);
+
+		default:
+			[destination setValue:[source valueForKey:_key] forKey:_key];
+			return;
+	}
+
+	#undef MTL_COPY_VALUE
+}
+
+@end
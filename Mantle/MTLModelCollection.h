@@ -0,0 +1,126 @@
+//
+//  MTLModelCollection.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class MTLModel;
+
+/// The domain for errors originating from MTLModelCollection.
+extern NSString * const MTLModelCollectionErrorDomain;
+
+/// A property can't be indexed, either because it doesn't exist or because of
+/// its type.
+extern const NSInteger MTLModelCollectionErrorUnsupportedProperty;
+
+/// A mutable, unordered collection of models of one class, which maintains
+/// indexes on some of their properties to look models up by value without
+/// scanning the whole collection.
+///
+/// A hash index finds the models with a given value in constant time. An
+/// ordered index finds them in logarithmic time, and can also find the models
+/// with values in a range. Adding many models at once with -addModels: sorts
+/// them once for each ordered index, rather than inserting them one by one.
+///
+/// Models are distinguished by identity, not by -isEqual:. The indexed values
+/// of a model are read when it is added, through the properties' getters. If
+/// an indexed property of a model in the collection changes, the model must be
+/// reindexed with -reindexModel:.
+///
+/// Collections are not thread safe.
+@interface MTLModelCollection<Model: MTLModel *> : NSObject <NSFastEnumeration>
+
+/// Creates an empty collection.
+///
+/// modelClass       - The MTLModel subclass declaring the indexed properties.
+///                    This argument must not be nil.
+/// hashIndexKeys    - The properties to maintain hash indexes on. Each must be
+///                    of a primitive type, or an object conforming to
+///                    NSCopying. This argument must not be nil.
+/// orderedIndexKeys - The properties to maintain ordered indexes on. Each must
+///                    be of a primitive type, or an object responding to
+///                    -compare:. This argument must not be nil.
+/// error            - If not NULL, this may be set to an error that occurs
+///                    while creating the collection.
+///
+/// Returns a collection, or nil if any property can't be indexed.
++ (nullable instancetype)collectionWithModelClass:(Class)modelClass hashIndexKeys:(NSArray<NSString *> *)hashIndexKeys orderedIndexKeys:(NSArray<NSString *> *)orderedIndexKeys error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The class of the models in the collection.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// The properties with hash indexes.
+@property (nonatomic, copy, readonly) NSArray<NSString *> *hashIndexKeys;
+
+/// The properties with ordered indexes.
+@property (nonatomic, copy, readonly) NSArray<NSString *> *orderedIndexKeys;
+
+/// The number of models in the collection.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// All models in the collection, in no particular order.
+@property (nonatomic, copy, readonly) NSArray<Model> *allModels;
+
+/// Whether `model` itself is in the collection.
+- (BOOL)containsModel:(Model)model;
+
+/// Adds a model to the collection and its indexes.
+///
+/// model - An instance of the model class or one of its subclasses. If it is
+///         already in the collection, it is reindexed. This argument must not
+///         be nil.
+- (void)addModel:(Model)model;
+
+/// Adds each model in `models`, as for -addModel:.
+- (void)addModels:(NSArray<Model> *)models;
+
+/// Removes a model from the collection and its indexes, if it is in the
+/// collection.
+- (void)removeModel:(Model)model;
+
+/// Removes every model.
+- (void)removeAllModels;
+
+/// Replaces a model with another, such as a newer version of the same record.
+///
+/// oldModel - The model to remove, if it is in the collection. This argument
+///            must not be nil.
+/// newModel - The model to add. This argument must not be nil.
+- (void)replaceModel:(Model)oldModel withModel:(Model)newModel;
+
+/// Updates the indexes of a model after its indexed properties have changed.
+///
+/// Does nothing if the model is not in the collection.
+- (void)reindexModel:(Model)model;
+
+/// Returns the models whose value for an indexed property is equal to `value`,
+/// in no particular order.
+///
+/// value - The value to look up, boxed for primitive properties. Pass nil to
+///         find the models whose value is nil.
+/// key   - A property with a hash or an ordered index. This argument must not
+///         be nil.
+- (NSArray<Model> *)modelsWithValue:(nullable id)value forKey:(NSString *)key;
+
+/// Returns the models whose value for a property with an ordered index is
+/// between `lowerValue` and `upperValue`, inclusive, ordered by that value.
+///
+/// Models whose value is nil are never returned.
+///
+/// lowerValue - The smallest value to return, or nil to not limit the values.
+/// upperValue - The largest value to return, or nil to not limit the values.
+/// key        - A property with an ordered index. This argument must not be
+///              nil.
+- (NSArray<Model> *)modelsWithValuesFrom:(nullable id)lowerValue to:(nullable id)upperValue forKey:(NSString *)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,640 @@
+//
+//  MTLModelCollection.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModelCollection.h"
+#import "MTLModel.h"
+#import "MTLPropertyAccessor.h"
+
+NSString * const MTLModelCollectionErrorDomain = @"MTLModelCollectionErrorDomain";
+const NSInteger MTLModelCollectionErrorUnsupportedProperty = 1;
+
+static NSError *MTLUnsupportedPropertyError(Class modelClass, NSString *propertyKey) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: NSLocalizedString(@"Could not create model collection", @""),
+		NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Property \"%@\" of %@ does not exist or cannot be indexed.", @""), propertyKey, modelClass]
+	};
+
+	return [NSError errorWithDomain:MTLModelCollectionErrorDomain code:MTLModelCollectionErrorUnsupportedProperty userInfo:userInfo];
+}
+
+// An index on one property. Values are boxed, with NSNull standing in for nil.
+@protocol MTLModelIndex <NSObject>
+
+@property (nonatomic, strong, readonly) MTLPropertyAccessor *accessor;
+
+- (void)addModel:(id)model withValue:(id)value;
+- (void)removeModel:(id)model withValue:(id)value;
+- (void)removeAllModels;
+
+// Adds models which aren't in the index yet, with the value at the same
+// position in `values`.
+- (void)addModels:(NSArray *)models withValues:(NSArray *)values;
+
+- (NSArray *)modelsWithValue:(id)value;
+
+@end
+
+@interface MTLModelHashIndex : NSObject <MTLModelIndex>
+
+- (instancetype)initWithAccessor:(MTLPropertyAccessor *)accessor;
+
+@end
+
+@implementation MTLModelHashIndex {
+	// Maps each value to a hash table of the models with that value, by
+	// identity.
+	NSMutableDictionary *_modelsByValue;
+}
+
+@synthesize accessor = _accessor;
+
+- (instancetype)initWithAccessor:(MTLPropertyAccessor *)accessor {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_accessor = accessor;
+	_modelsByValue = [NSMutableDictionary dictionary];
+
+	return self;
+}
+
+- (void)addModel:(id)model withValue:(id)value {
+	NSHashTable *models = _modelsByValue[value];
+	if (models == nil) {
+		models = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+		_modelsByValue[value] = models;
+	}
+
+	[models addObject:model];
+}
+
+- (void)addModels:(NSArray *)models withValues:(NSArray *)values {
+	[models enumerateObjectsUsingBlock:^(id model, NSUInteger i, BOOL *stop) {
+		[self addModel:model withValue:values[i]];
+	}];
+}
+
+- (void)removeModel:(id)model withValue:(id)value {
+	NSHashTable *models = _modelsByValue[value];
+	[models removeObject:model];
+
+	if (models != nil && models.count == 0) [_modelsByValue removeObjectForKey:value];
+}
+
+- (void)removeAllModels {
+	[_modelsByValue removeAllObjects];
+}
+
+- (NSArray *)modelsWithValue:(id)value {
+	return [_modelsByValue[value] allObjects] ?: @[];
+}
+
+@end
+
+// The most entries an MTLModelOrderedIndexBlock holds before it is split in
+// two. Blocks built in bulk are filled halfway, and blocks which shrink to a
+// quarter of this are merged into a neighbor, so every block but the last
+// stays between a quarter and all of it full.
+static const NSUInteger MTLModelOrderedIndexBlockCapacity = 512;
+
+// A run of consecutive entries of an MTLModelOrderedIndex.
+@interface MTLModelOrderedIndexBlock : NSObject
+
+// The values, in ascending order, and the models they belong to.
+@property (nonatomic, strong, readonly) NSMutableArray *values;
+@property (nonatomic, strong, readonly) NSMutableArray *models;
+
+@end
+
+@implementation MTLModelOrderedIndexBlock
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_values = [NSMutableArray array];
+	_models = [NSMutableArray array];
+
+	return self;
+}
+
+@end
+
+// A position within an MTLModelOrderedIndex, which is past the end when
+// `block` is the number of blocks.
+typedef struct {
+	NSUInteger block;
+	NSUInteger index;
+} MTLModelOrderedIndexPosition;
+
+@interface MTLModelOrderedIndex : NSObject <MTLModelIndex>
+
+- (instancetype)initWithAccessor:(MTLPropertyAccessor *)accessor;
+
+- (NSArray *)modelsWithValuesFrom:(id)lowerValue to:(id)upperValue;
+
+@end
+
+// Keeps the non-nil values in ascending order, split into blocks of bounded
+// size, like the leaves of a B+ tree. Finding a value takes a binary search
+// over the blocks and then within one, and inserting or removing one only
+// moves the entries of its block, instead of those of the whole index.
+@implementation MTLModelOrderedIndex {
+	NSMutableArray<MTLModelOrderedIndexBlock *> *_blocks;
+
+	// The number of entries in all blocks.
+	NSUInteger _count;
+
+	// The models whose value is nil, by identity.
+	NSHashTable *_modelsWithNilValue;
+}
+
+@synthesize accessor = _accessor;
+
+- (instancetype)initWithAccessor:(MTLPropertyAccessor *)accessor {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_accessor = accessor;
+	_blocks = [NSMutableArray array];
+	_modelsWithNilValue = [NSHashTable hashTableWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality];
+
+	return self;
+}
+
+// Returns the index of the first value in `values` which is not less than
+// `value`, or, if `afterEqualValues` is YES, the first value which is greater
+// than it.
+static NSUInteger MTLIndexForValue(NSArray *values, id value, BOOL afterEqualValues) {
+	NSUInteger low = 0;
+	NSUInteger high = values.count;
+
+	while (low < high) {
+		NSUInteger middle = low + (high - low) / 2;
+		NSComparisonResult result = [values[middle] compare:value];
+
+		if (result == NSOrderedAscending || (afterEqualValues && result == NSOrderedSame)) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+// Returns the position of the first value which is not less than `value`, or,
+// if `afterEqualValues` is YES, the first value which is greater than it.
+- (MTLModelOrderedIndexPosition)positionForValue:(id)value afterEqualValues:(BOOL)afterEqualValues {
+	// Find the first block whose last value qualifies, since the position is
+	// within it.
+	NSUInteger low = 0;
+	NSUInteger high = _blocks.count;
+
+	while (low < high) {
+		NSUInteger middle = low + (high - low) / 2;
+		NSComparisonResult result = [_blocks[middle].values.lastObject compare:value];
+
+		if (result == NSOrderedAscending || (afterEqualValues && result == NSOrderedSame)) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	if (low == _blocks.count) return (MTLModelOrderedIndexPosition){ low, 0 };
+
+	return (MTLModelOrderedIndexPosition){ low, MTLIndexForValue(_blocks[low].values, value, afterEqualValues) };
+}
+
+// Returns the models from position `start` up to, but not including, `end`.
+- (NSArray *)modelsFromPosition:(MTLModelOrderedIndexPosition)start toPosition:(MTLModelOrderedIndexPosition)end {
+	NSMutableArray *models = [NSMutableArray array];
+
+	for (NSUInteger i = start.block; i < _blocks.count && i <= end.block; i++) {
+		NSArray *blockModels = _blocks[i].models;
+
+		NSUInteger location = (i == start.block ? start.index : 0);
+		NSUInteger endIndex = (i == end.block ? end.index : blockModels.count);
+		if (endIndex <= location) continue;
+
+		[models addObjectsFromArray:[blockModels subarrayWithRange:NSMakeRange(location, endIndex - location)]];
+	}
+
+	return models;
+}
+
+- (void)addModel:(id)model withValue:(id)value {
+	if (value == NSNull.null) {
+		[_modelsWithNilValue addObject:model];
+		return;
+	}
+
+	if (_blocks.count == 0) [_blocks addObject:[[MTLModelOrderedIndexBlock alloc] init]];
+
+	MTLModelOrderedIndexPosition position = [self positionForValue:value afterEqualValues:YES];
+	if (position.block == _blocks.count) {
+		position.block--;
+		position.index = _blocks[position.block].values.count;
+	}
+
+	MTLModelOrderedIndexBlock *block = _blocks[position.block];
+	[block.values insertObject:value atIndex:position.index];
+	[block.models insertObject:model atIndex:position.index];
+	_count++;
+
+	if (block.values.count > MTLModelOrderedIndexBlockCapacity) {
+		NSRange upperHalf = NSMakeRange(block.values.count / 2, block.values.count - block.values.count / 2);
+
+		MTLModelOrderedIndexBlock *newBlock = [[MTLModelOrderedIndexBlock alloc] init];
+		[newBlock.values addObjectsFromArray:[block.values subarrayWithRange:upperHalf]];
+		[newBlock.models addObjectsFromArray:[block.models subarrayWithRange:upperHalf]];
+		[block.values removeObjectsInRange:upperHalf];
+		[block.models removeObjectsInRange:upperHalf];
+
+		[_blocks insertObject:newBlock atIndex:position.block + 1];
+	}
+}
+
+- (void)addModels:(NSArray *)models withValues:(NSArray *)values {
+	NSMutableArray *entries = [NSMutableArray arrayWithCapacity:models.count];
+	[models enumerateObjectsUsingBlock:^(id model, NSUInteger i, BOOL *stop) {
+		if (values[i] == NSNull.null) {
+			[self->_modelsWithNilValue addObject:model];
+		} else {
+			[entries addObject:@(i)];
+		}
+	}];
+
+	// A few models are cheaper to insert one at a time than to merge with the
+	// whole index.
+	if (entries.count < _count / 8) {
+		for (NSNumber *entry in entries) {
+			[self addModel:models[entry.unsignedIntegerValue] withValue:values[entry.unsignedIntegerValue]];
+		}
+
+		return;
+	}
+
+	// Sort the new models once, and merge them with the existing ones, after
+	// any equal values as for -addModel:withValue:.
+	[entries sortWithOptions:NSSortStable usingComparator:^(NSNumber *entry1, NSNumber *entry2) {
+		return [values[entry1.unsignedIntegerValue] compare:values[entry2.unsignedIntegerValue]];
+	}];
+
+	NSMutableArray *oldValues = [NSMutableArray arrayWithCapacity:_count];
+	NSMutableArray *oldModels = [NSMutableArray arrayWithCapacity:_count];
+	for (MTLModelOrderedIndexBlock *block in _blocks) {
+		[oldValues addObjectsFromArray:block.values];
+		[oldModels addObjectsFromArray:block.models];
+	}
+
+	[_blocks removeAllObjects];
+	_count += entries.count;
+
+	NSUInteger oldIndex = 0;
+	NSUInteger newIndex = 0;
+	MTLModelOrderedIndexBlock *block = nil;
+
+	while (oldIndex < oldValues.count || newIndex < entries.count) {
+		id value;
+		id model;
+
+		NSUInteger entry = (newIndex < entries.count ? [entries[newIndex] unsignedIntegerValue] : NSNotFound);
+		if (entry == NSNotFound || (oldIndex < oldValues.count && [oldValues[oldIndex] compare:values[entry]] != NSOrderedDescending)) {
+			value = oldValues[oldIndex];
+			model = oldModels[oldIndex];
+			oldIndex++;
+		} else {
+			value = values[entry];
+			model = models[entry];
+			newIndex++;
+		}
+
+		if (block == nil || block.values.count == MTLModelOrderedIndexBlockCapacity / 2) {
+			block = [[MTLModelOrderedIndexBlock alloc] init];
+			[_blocks addObject:block];
+		}
+
+		[block.values addObject:value];
+		[block.models addObject:model];
+	}
+}
+
+- (void)removeModel:(id)model withValue:(id)value {
+	if (value == NSNull.null) {
+		[_modelsWithNilValue removeObject:model];
+		return;
+	}
+
+	// Models with equal values may span several blocks.
+	MTLModelOrderedIndexPosition position = [self positionForValue:value afterEqualValues:NO];
+
+	for (; position.block < _blocks.count; position.block++, position.index = 0) {
+		MTLModelOrderedIndexBlock *block = _blocks[position.block];
+
+		NSUInteger end = MTLIndexForValue(block.values, value, YES);
+		if (end <= position.index) return;
+
+		NSUInteger index = [block.models indexOfObjectIdenticalTo:model inRange:NSMakeRange(position.index, end - position.index)];
+		if (index != NSNotFound) {
+			[block.values removeObjectAtIndex:index];
+			[block.models removeObjectAtIndex:index];
+			_count--;
+
+			[self rebalanceBlockAtIndex:position.block];
+			return;
+		}
+
+		if (end < block.values.count) return;
+	}
+}
+
+// Removes the block at `blockIndex` if it's empty, or merges it into a
+// neighbor if it has shrunk enough for both to fit in one block.
+- (void)rebalanceBlockAtIndex:(NSUInteger)blockIndex {
+	MTLModelOrderedIndexBlock *block = _blocks[blockIndex];
+
+	if (block.values.count == 0) {
+		[_blocks removeObjectAtIndex:blockIndex];
+		return;
+	}
+
+	if (block.values.count >= MTLModelOrderedIndexBlockCapacity / 4) return;
+
+	NSUInteger neighborIndex = (blockIndex + 1 < _blocks.count ? blockIndex + 1 : blockIndex - 1);
+	if (neighborIndex >= _blocks.count) return;
+
+	MTLModelOrderedIndexBlock *lowerBlock = _blocks[MIN(blockIndex, neighborIndex)];
+	MTLModelOrderedIndexBlock *upperBlock = _blocks[MAX(blockIndex, neighborIndex)];
+	if (lowerBlock.values.count + upperBlock.values.count > MTLModelOrderedIndexBlockCapacity) return;
+
+	[lowerBlock.values addObjectsFromArray:upperBlock.values];
+	[lowerBlock.models addObjectsFromArray:upperBlock.models];
+	[_blocks removeObjectAtIndex:MAX(blockIndex, neighborIndex)];
+}
+
+- (void)removeAllModels {
+	[_blocks removeAllObjects];
+	[_modelsWithNilValue removeAllObjects];
+	_count = 0;
+}
+
+- (NSArray *)modelsWithValue:(id)value {
+	if (value == NSNull.null) return _modelsWithNilValue.allObjects;
+
+	MTLModelOrderedIndexPosition start = [self positionForValue:value afterEqualValues:NO];
+	MTLModelOrderedIndexPosition end = [self positionForValue:value afterEqualValues:YES];
+
+	return [self modelsFromPosition:start toPosition:end];
+}
+
+- (NSArray *)modelsWithValuesFrom:(id)lowerValue to:(id)upperValue {
+	MTLModelOrderedIndexPosition start = (lowerValue != nil ? [self positionForValue:lowerValue afterEqualValues:NO] : (MTLModelOrderedIndexPosition){ 0, 0 });
+	MTLModelOrderedIndexPosition end = (upperValue != nil ? [self positionForValue:upperValue afterEqualValues:YES] : (MTLModelOrderedIndexPosition){ _blocks.count, 0 });
+
+	return [self modelsFromPosition:start toPosition:end];
+}
+
+@end
+
+@implementation MTLModelCollection {
+	// The hash indexes, followed by the ordered indexes.
+	NSArray<id<MTLModelIndex>> *_indexes;
+
+	NSDictionary<NSString *, MTLModelHashIndex *> *_hashIndexesByKey;
+	NSDictionary<NSString *, MTLModelOrderedIndex *> *_orderedIndexesByKey;
+
+	// Maps each model in the collection, by identity, to the values it was
+	// indexed with, in the order of `_indexes`. Keeping these means that models
+	// can be removed from the indexes even after their properties change.
+	NSMapTable *_indexedValuesByModel;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)collectionWithModelClass:(Class)modelClass hashIndexKeys:(NSArray *)hashIndexKeys orderedIndexKeys:(NSArray *)orderedIndexKeys error:(NSError **)error {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(hashIndexKeys != nil);
+	NSParameterAssert(orderedIndexKeys != nil);
+
+	NSMutableDictionary *hashIndexesByKey = [NSMutableDictionary dictionaryWithCapacity:hashIndexKeys.count];
+	for (NSString *key in hashIndexKeys) {
+		MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:modelClass];
+
+		BOOL indexable = (accessor != nil);
+		if (indexable && accessor.kind == MTLPropertyAccessorKindObject && accessor.objectClass != nil) {
+			indexable = [accessor.objectClass conformsToProtocol:@protocol(NSCopying)];
+		}
+
+		if (!indexable) {
+			if (error != NULL) *error = MTLUnsupportedPropertyError(modelClass, key);
+			return nil;
+		}
+
+		hashIndexesByKey[key] = [[MTLModelHashIndex alloc] initWithAccessor:accessor];
+	}
+
+	NSMutableDictionary *orderedIndexesByKey = [NSMutableDictionary dictionaryWithCapacity:orderedIndexKeys.count];
+	for (NSString *key in orderedIndexKeys) {
+		MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:key ofClass:modelClass];
+
+		BOOL indexable = (accessor != nil);
+		if (indexable && accessor.kind == MTLPropertyAccessorKindObject && accessor.objectClass != nil) {
+			indexable = [accessor.objectClass instancesRespondToSelector:@selector(compare:)];
+		}
+
+		if (!indexable) {
+			if (error != NULL) *error = MTLUnsupportedPropertyError(modelClass, key);
+			return nil;
+		}
+
+		orderedIndexesByKey[key] = [[MTLModelOrderedIndex alloc] initWithAccessor:accessor];
+	}
+
+	MTLModelCollection *collection = [[self alloc] initWithModelClass:modelClass];
+	collection->_hashIndexKeys = [hashIndexKeys copy];
+	collection->_orderedIndexKeys = [orderedIndexKeys copy];
+	collection->_hashIndexesByKey = [hashIndexesByKey copy];
+	collection->_orderedIndexesByKey = [orderedIndexesByKey copy];
+	collection->_indexes = [[hashIndexesByKey objectsForKeys:hashIndexKeys notFoundMarker:NSNull.null] arrayByAddingObjectsFromArray:[orderedIndexesByKey objectsForKeys:orderedIndexKeys notFoundMarker:NSNull.null]];
+
+	return collection;
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+	_indexedValuesByModel = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+
+	return self;
+}
+
+#pragma mark Models
+
+- (NSUInteger)count {
+	return _indexedValuesByModel.count;
+}
+
+- (NSArray *)allModels {
+	return _indexedValuesByModel.keyEnumerator.allObjects;
+}
+
+- (BOOL)containsModel:(MTLModel *)model {
+	return [_indexedValuesByModel objectForKey:model] != nil;
+}
+
+// Reads the values of `model` for each index.
+- (NSArray *)indexedValuesOfModel:(MTLModel *)model {
+	NSMutableArray *values = [NSMutableArray arrayWithCapacity:_indexes.count];
+	for (id<MTLModelIndex> index in _indexes) {
+		[values addObject:[index.accessor objectValueOfModel:model] ?: NSNull.null];
+	}
+
+	return values;
+}
+
+- (void)addModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+	NSAssert([model isKindOfClass:self.modelClass], @"%@ is not an instance of %@", model, self.modelClass);
+
+	if ([self containsModel:model]) {
+		[self reindexModel:model];
+		return;
+	}
+
+	NSArray *values = [self indexedValuesOfModel:model];
+	[_indexes enumerateObjectsUsingBlock:^(id<MTLModelIndex> index, NSUInteger i, BOOL *stop) {
+		[index addModel:model withValue:values[i]];
+	}];
+
+	[_indexedValuesByModel setObject:values forKey:model];
+}
+
+- (void)addModels:(NSArray *)models {
+	NSParameterAssert(models != nil);
+
+	// Add the new models to each index all at once, so that ordered indexes
+	// only sort them once.
+	NSMutableArray *newModels = [NSMutableArray arrayWithCapacity:models.count];
+	NSMutableArray *newValues = [NSMutableArray arrayWithCapacity:models.count];
+	NSHashTable *newModelSet = [NSHashTable hashTableWithOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality];
+
+	for (MTLModel *model in models) {
+		NSAssert([model isKindOfClass:self.modelClass], @"%@ is not an instance of %@", model, self.modelClass);
+
+		if ([newModelSet containsObject:model]) continue;
+
+		if ([self containsModel:model]) {
+			[self reindexModel:model];
+			continue;
+		}
+
+		NSArray *values = [self indexedValuesOfModel:model];
+		[newModels addObject:model];
+		[newValues addObject:values];
+		[newModelSet addObject:model];
+
+		[_indexedValuesByModel setObject:values forKey:model];
+	}
+
+	if (newModels.count == 0) return;
+
+	[_indexes enumerateObjectsUsingBlock:^(id<MTLModelIndex> index, NSUInteger i, BOOL *stop) {
+		NSMutableArray *indexValues = [NSMutableArray arrayWithCapacity:newValues.count];
+		for (NSArray *values in newValues) {
+			[indexValues addObject:values[i]];
+		}
+
+		[index addModels:newModels withValues:indexValues];
+	}];
+}
+
+- (void)removeModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+
+	NSArray *values = [_indexedValuesByModel objectForKey:model];
+	if (values == nil) return;
+
+	[_indexes enumerateObjectsUsingBlock:^(id<MTLModelIndex> index, NSUInteger i, BOOL *stop) {
+		[index removeModel:model withValue:values[i]];
+	}];
+
+	[_indexedValuesByModel removeObjectForKey:model];
+}
+
+- (void)removeAllModels {
+	for (id<MTLModelIndex> index in _indexes) {
+		[index removeAllModels];
+	}
+
+	[_indexedValuesByModel removeAllObjects];
+}
+
+- (void)replaceModel:(MTLModel *)oldModel withModel:(MTLModel *)newModel {
+	NSParameterAssert(oldModel != nil);
+	NSParameterAssert(newModel != nil);
+
+	if (oldModel != newModel) [self removeModel:oldModel];
+	[self addModel:newModel];
+}
+
+- (void)reindexModel:(MTLModel *)model {
+	NSParameterAssert(model != nil);
+
+	NSArray *oldValues = [_indexedValuesByModel objectForKey:model];
+	if (oldValues == nil) return;
+
+	NSArray *newValues = [self indexedValuesOfModel:model];
+
+	// Only touch the indexes whose value actually changed.
+	[_indexes enumerateObjectsUsingBlock:^(id<MTLModelIndex> index, NSUInteger i, BOOL *stop) {
+		if ([oldValues[i] isEqual:newValues[i]]) return;
+
+		[index removeModel:model withValue:oldValues[i]];
+		[index addModel:model withValue:newValues[i]];
+	}];
+
+	[_indexedValuesByModel setObject:newValues forKey:model];
+}
+
+#pragma mark Queries
+
+- (NSArray *)modelsWithValue:(id)value forKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+
+	id<MTLModelIndex> index = _hashIndexesByKey[key] ?: _orderedIndexesByKey[key];
+	NSAssert(index != nil, @"%@ is not indexed", key);
+
+	return [index modelsWithValue:value ?: NSNull.null];
+}
+
+- (NSArray *)modelsWithValuesFrom:(id)lowerValue to:(id)upperValue forKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+
+	MTLModelOrderedIndex *index = _orderedIndexesByKey[key];
+	NSAssert(index != nil, @"%@ does not have an ordered index", key);
+
+	return [index modelsWithValuesFrom:lowerValue to:upperValue];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id [])buffer count:(NSUInteger)length {
+	return [_indexedValuesByModel countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ (%lu models)", self.class, self, self.modelClass, (unsigned long)self.count];
+}
+
+@end
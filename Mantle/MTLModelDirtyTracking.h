@@ -0,0 +1,37 @@
+//
+//  MTLModelDirtyTracking.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Wraps the setters of a class that tracks dirty properties or caches its JSON
+// dictionary, unless a superclass already did. Does nothing for other classes,
+// or for classes it has already been called for.
+//
+// Called from +[MTLModel initialize], and again from -[MTLModel init] for
+// subclasses whose +initialize doesn't call super.
+void MTLModelInstallChangeTracking(Class modelClass);
+
+// Marks all properties of `model` clean, if its class tracks dirty properties.
+// `model` need not be an MTLModel.
+void MTLModelDiscardDirtyPropertyKeys(id model);
+
+// Marks a property of `model` clean, if its class tracks dirty properties.
+void MTLModelDiscardDirtyPropertyKey(id model, NSString *propertyKey);
+
+// Returns the JSON dictionary cached on `model` by an adapter of class
+// `adapterClass`, or nil if there is none or a property has been set since.
+NSDictionary * _Nullable MTLModelCachedJSONDictionary(id model, Class adapterClass);
+
+// Caches the JSON dictionary serialized from `model` by an adapter of class
+// `adapterClass`, replacing any other cached dictionary. The cache is discarded
+// when any property of `model` is set.
+void MTLModelCacheJSONDictionary(id model, Class adapterClass, NSDictionary *JSONDictionary);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,125 @@
+//
+//  MTLModelSorter.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The domain for errors originating from MTLModelSorter.
+extern NSString * const MTLModelSorterErrorDomain;
+
+/// A property can't be sorted or grouped by, either because it doesn't exist or
+/// because its values can't be compared.
+extern const NSInteger MTLModelSorterErrorUnsupportedProperty;
+
+/// Options for sorting and grouping models.
+typedef NS_OPTIONS(NSUInteger, MTLModelSortOptions) {
+	MTLModelSortOptionsNone = 0,
+
+	/// Sorts large arrays on multiple threads. The models' getters must be
+	/// safe to call concurrently.
+	MTLModelSortOptionsConcurrent = 1 << 0,
+};
+
+/// A property to sort models by.
+@interface MTLModelSortKey : NSObject <NSCopying>
+
+/// Returns a sort key comparing values with -compare:.
++ (instancetype)sortKeyWithPropertyKey:(NSString *)propertyKey ascending:(BOOL)ascending;
+
+/// Returns a sort key.
+///
+/// propertyKey - The property to sort by. This argument must not be nil.
+/// ascending   - Whether smaller values come first.
+/// options     - For NSString properties, the options to compare the strings
+///               with, as for -[NSString compare:options:]. The case, diacritic
+///               and width insensitive options are applied once per model, by
+///               folding the string, rather than on every comparison.
++ (instancetype)sortKeyWithPropertyKey:(NSString *)propertyKey ascending:(BOOL)ascending options:(NSStringCompareOptions)options;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The property to sort by.
+@property (nonatomic, copy, readonly) NSString *propertyKey;
+
+/// Whether smaller values come first. nil values are smaller than any other
+/// value.
+@property (nonatomic, assign, readonly, getter = isAscending) BOOL ascending;
+
+/// The options to compare strings with.
+@property (nonatomic, assign, readonly) NSStringCompareOptions options;
+
+@end
+
+/// Sorts and groups models of a class by some of their properties.
+///
+/// NSSortDescriptor reads both values through KVC on every comparison, boxing
+/// primitive values each time. A sorter reads every sort key of every model
+/// once, through the properties' getters, into primitive buffers, and then
+/// only compares those buffers.
+///
+/// Sorting is always stable.
+@interface MTLModelSorter : NSObject
+
+/// Creates a sorter.
+///
+/// modelClass - The MTLModel subclass declaring the properties. This argument
+///              must not be nil.
+/// sortKeys   - The properties to sort by, most significant first. This
+///              argument must not be nil, but may be empty to keep models in
+///              their original order.
+/// error      - If not NULL, this may be set to an error that occurs while
+///              creating the sorter.
+///
+/// Returns a sorter, or nil if any property doesn't exist or isn't of a
+/// primitive type or an object responding to -compare:.
++ (nullable instancetype)sorterWithModelClass:(Class)modelClass sortKeys:(NSArray<MTLModelSortKey *> *)sortKeys error:(NSError **)error;
+
+/// Creates a sorter comparing each of `propertyKeys` in ascending order.
++ (nullable instancetype)sorterWithModelClass:(Class)modelClass propertyKeys:(NSArray<NSString *> *)propertyKeys error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The class of the models which will be sorted.
+@property (nonatomic, strong, readonly) Class modelClass;
+
+/// The properties to sort by.
+@property (nonatomic, copy, readonly) NSArray<MTLModelSortKey *> *sortKeys;
+
+/// Compares two models by reading their properties directly, without building
+/// any sort keys.
+///
+/// This is useful with APIs that take a comparator, such as
+/// -[NSArray indexOfObject:inSortedRange:options:usingComparator:].
+@property (nonatomic, copy, readonly) NSComparator comparator;
+
+/// Returns the models in `models`, sorted.
+///
+/// models  - The models to sort. Every model must be an instance of the
+///           model class or one of its subclasses. This argument must not be
+///           nil.
+/// options - Options for sorting.
+- (NSArray *)sortedArrayFromModels:(NSArray *)models options:(MTLModelSortOptions)options;
+
+/// Groups models by the value of one of their properties.
+///
+/// models      - The models to group, as for -sortedArrayFromModels:options:.
+/// propertyKey - The property to group by. nil values are grouped under
+///               NSNull. This argument must not be nil.
+/// options     - Options for sorting.
+/// error       - If not NULL, this may be set to an error that occurs while
+///               grouping.
+///
+/// Returns a dictionary from each distinct value of the property to the models
+/// with that value, sorted, or nil if the property doesn't exist or isn't of a
+/// supported type.
+- (nullable NSDictionary<id, NSArray *> *)groupModels:(NSArray *)models byPropertyKey:(NSString *)propertyKey options:(MTLModelSortOptions)options error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,563 @@
+//
+//  MTLModelSorter.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModelSorter.h"
+#import "MTLPropertyAccessor.h"
+
+NSString * const MTLModelSorterErrorDomain = @"MTLModelSorterErrorDomain";
+const NSInteger MTLModelSorterErrorUnsupportedProperty = 1;
+
+// Arrays with at least this many models are sorted concurrently, in chunks of
+// MTLConcurrentSortChunkLength models, if requested.
+static const NSUInteger MTLConcurrentSortMinimumCount = 2048;
+static const NSUInteger MTLConcurrentSortChunkLength = 1024;
+
+// Runs of this many indexes are insertion sorted before being merged.
+static const NSUInteger MTLSortRunLength = 16;
+
+// The string options which are applied by folding strings once, instead of on
+// every comparison.
+static const NSStringCompareOptions MTLFoldingStringCompareOptions = NSCaseInsensitiveSearch | NSDiacriticInsensitiveSearch | NSWidthInsensitiveSearch;
+
+static NSError *MTLUnsupportedPropertyError(Class modelClass, NSString *propertyKey) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: NSLocalizedString(@"Could not sort models", @""),
+		NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Property \"%@\" of %@ does not exist or cannot be compared.", @""), propertyKey, modelClass]
+	};
+
+	return [NSError errorWithDomain:MTLModelSorterErrorDomain code:MTLModelSorterErrorUnsupportedProperty userInfo:userInfo];
+}
+
+#define MTLCompareScalars(LEFT, RIGHT) \
+	((NSComparisonResult)(((LEFT) > (RIGHT)) - ((LEFT) < (RIGHT))))
+
+// Compares two objects, ordering nil before any other value.
+static NSComparisonResult MTLCompareSortObjects(id left, id right, NSStringCompareOptions options) {
+	if (left == right) return NSOrderedSame;
+	if (left == nil) return NSOrderedAscending;
+	if (right == nil) return NSOrderedDescending;
+
+	if (options != 0 && [left isKindOfClass:NSString.class] && [right isKindOfClass:NSString.class]) {
+		return [left compare:right options:options];
+	}
+
+	return [left compare:right];
+}
+
+// How the sort keys of a property are stored.
+typedef NS_ENUM(NSInteger, MTLSortValueType) {
+	MTLSortValueTypeInt64,
+	MTLSortValueTypeUInt64,
+	MTLSortValueTypeDouble,
+	MTLSortValueTypeObject,
+};
+
+// The sort keys of one property, for every model being sorted.
+typedef struct {
+	MTLSortValueType type;
+	BOOL ascending;
+
+	// The options to compare strings with, after folding.
+	NSStringCompareOptions options;
+
+	// An array of int64_t, uint64_t, double or id, depending on `type`.
+	const void *values;
+} MTLSortColumn;
+
+typedef struct {
+	const MTLSortColumn *columns;
+	NSUInteger columnCount;
+} MTLSortContext;
+
+// Compares the sort keys of the models at `left` and `right`.
+static NSComparisonResult MTLCompareSortEntries(const MTLSortContext *context, NSUInteger left, NSUInteger right) {
+	for (NSUInteger i = 0; i < context->columnCount; i++) {
+		const MTLSortColumn *column = &context->columns[i];
+		NSComparisonResult result = NSOrderedSame;
+
+		switch (column->type) {
+			case MTLSortValueTypeInt64: {
+				const int64_t *values = column->values;
+				result = MTLCompareScalars(values[left], values[right]);
+				break;
+			}
+
+			case MTLSortValueTypeUInt64: {
+				const uint64_t *values = column->values;
+				result = MTLCompareScalars(values[left], values[right]);
+				break;
+			}
+
+			case MTLSortValueTypeDouble: {
+				const double *values = column->values;
+				result = MTLCompareScalars(values[left], values[right]);
+				break;
+			}
+
+			case MTLSortValueTypeObject: {
+				__unsafe_unretained id const *values = (__unsafe_unretained id const *)column->values;
+				result = MTLCompareSortObjects(values[left], values[right], column->options);
+				break;
+			}
+		}
+
+		if (result != NSOrderedSame) return (column->ascending ? result : (NSComparisonResult)-result);
+	}
+
+	return NSOrderedSame;
+}
+
+// Merges the sorted runs source[start..<middle] and source[middle..<end] into
+// destination[start..<end], preferring the left run for equal entries.
+static void MTLMergeSortedRuns(const MTLSortContext *context, const NSUInteger *source, NSUInteger *destination, NSUInteger start, NSUInteger middle, NSUInteger end) {
+	NSUInteger left = start;
+	NSUInteger right = middle;
+	NSUInteger output = start;
+
+	while (left < middle && right < end) {
+		if (MTLCompareSortEntries(context, source[right], source[left]) == NSOrderedAscending) {
+			destination[output++] = source[right++];
+		} else {
+			destination[output++] = source[left++];
+		}
+	}
+
+	while (left < middle) destination[output++] = source[left++];
+	while (right < end) destination[output++] = source[right++];
+}
+
+// Performs a stable merge sort of `count` indexes, using `scratch` as
+// temporary storage for the same number of indexes.
+static void MTLSortIndexes(const MTLSortContext *context, NSUInteger *indexes, NSUInteger *scratch, NSUInteger count) {
+	for (NSUInteger start = 0; start < count; start += MTLSortRunLength) {
+		NSUInteger end = MIN(start + MTLSortRunLength, count);
+
+		for (NSUInteger i = start + 1; i < end; i++) {
+			NSUInteger index = indexes[i];
+
+			NSUInteger j = i;
+			while (j > start && MTLCompareSortEntries(context, index, indexes[j - 1]) == NSOrderedAscending) {
+				indexes[j] = indexes[j - 1];
+				j--;
+			}
+
+			indexes[j] = index;
+		}
+	}
+
+	NSUInteger *source = indexes;
+	NSUInteger *destination = scratch;
+
+	for (NSUInteger width = MTLSortRunLength; width < count; width *= 2) {
+		for (NSUInteger start = 0; start < count; start += 2 * width) {
+			MTLMergeSortedRuns(context, source, destination, start, MIN(start + width, count), MIN(start + 2 * width, count));
+		}
+
+		NSUInteger *merged = destination;
+		destination = source;
+		source = merged;
+	}
+
+	if (source != indexes) memcpy(indexes, source, count * sizeof(*indexes));
+}
+
+// Sorts chunks of `indexes` concurrently, and then merges them, merging pairs
+// of runs concurrently.
+static void MTLSortIndexesConcurrently(const MTLSortContext *context, NSUInteger *indexes, NSUInteger *scratch, NSUInteger count) {
+	dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+
+	NSUInteger chunkCount = (count + MTLConcurrentSortChunkLength - 1) / MTLConcurrentSortChunkLength;
+	dispatch_apply(chunkCount, queue, ^(size_t chunk) {
+		NSUInteger start = chunk * MTLConcurrentSortChunkLength;
+		NSUInteger length = MIN(MTLConcurrentSortChunkLength, count - start);
+
+		MTLSortIndexes(context, indexes + start, scratch + start, length);
+	});
+
+	NSUInteger *source = indexes;
+	NSUInteger *destination = scratch;
+
+	for (NSUInteger width = MTLConcurrentSortChunkLength; width < count; width *= 2) {
+		NSUInteger mergeCount = (count + 2 * width - 1) / (2 * width);
+
+		dispatch_apply(mergeCount, queue, ^(size_t merge) {
+			NSUInteger start = merge * 2 * width;
+			MTLMergeSortedRuns(context, source, destination, start, MIN(start + width, count), MIN(start + 2 * width, count));
+		});
+
+		NSUInteger *merged = destination;
+		destination = source;
+		source = merged;
+	}
+
+	if (source != indexes) memcpy(indexes, source, count * sizeof(*indexes));
+}
+
+// The sort keys of one property, read from the models being sorted.
+@interface MTLModelSortBuffer : NSObject
+
+- (instancetype)initWithSortKey:(MTLModelSortKey *)sortKey accessor:(MTLPropertyAccessor *)accessor count:(NSUInteger)count;
+
+// Reads the sort key of the model at `index`.
+//
+// This may be called from multiple threads for different indexes.
+- (void)readModel:(id)model atIndex:(NSUInteger)index;
+
+// A column pointing into the receiver's storage, valid for the lifetime of the
+// receiver.
+@property (nonatomic, assign, readonly) MTLSortColumn column;
+
+@end
+
+@implementation MTLModelSortBuffer {
+	MTLPropertyAccessor *_accessor;
+	NSUInteger _count;
+
+	// Set if strings are folded before being stored.
+	NSStringCompareOptions _foldingOptions;
+
+	void *_primitiveValues;
+	__strong id *_objectValues;
+}
+
+- (instancetype)initWithSortKey:(MTLModelSortKey *)sortKey accessor:(MTLPropertyAccessor *)accessor count:(NSUInteger)count {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_accessor = accessor;
+	_count = count;
+	_column.ascending = sortKey.ascending;
+
+	switch (accessor.kind) {
+		case MTLPropertyAccessorKindInt64:
+			_column.type = (accessor.isUnsigned ? MTLSortValueTypeUInt64 : MTLSortValueTypeInt64);
+			_primitiveValues = calloc(MAX(count, 1), sizeof(int64_t));
+			_column.values = _primitiveValues;
+			break;
+
+		case MTLPropertyAccessorKindDouble:
+			_column.type = MTLSortValueTypeDouble;
+			_primitiveValues = calloc(MAX(count, 1), sizeof(double));
+			_column.values = _primitiveValues;
+			break;
+
+		case MTLPropertyAccessorKindObject:
+			_column.type = MTLSortValueTypeObject;
+			_foldingOptions = sortKey.options & MTLFoldingStringCompareOptions;
+			_column.options = sortKey.options & ~MTLFoldingStringCompareOptions;
+			_objectValues = (__strong id *)calloc(MAX(count, 1), sizeof(*_objectValues));
+			_column.values = (const void *)_objectValues;
+			break;
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	if (_objectValues != NULL) {
+		for (NSUInteger i = 0; i < _count; i++) {
+			_objectValues[i] = nil;
+		}
+	}
+
+	free(_objectValues);
+	free(_primitiveValues);
+}
+
+- (void)readModel:(id)model atIndex:(NSUInteger)index {
+	switch (_column.type) {
+		case MTLSortValueTypeInt64:
+		case MTLSortValueTypeUInt64:
+			((int64_t *)_primitiveValues)[index] = [_accessor int64ValueOfModel:model];
+			break;
+
+		case MTLSortValueTypeDouble:
+			((double *)_primitiveValues)[index] = [_accessor doubleValueOfModel:model];
+			break;
+
+		case MTLSortValueTypeObject: {
+			id value = [_accessor objectValueOfModel:model];
+			if (_foldingOptions != 0 && [value isKindOfClass:NSString.class]) {
+				value = [value stringByFoldingWithOptions:_foldingOptions locale:nil];
+			}
+
+			_objectValues[index] = value;
+			break;
+		}
+	}
+}
+
+@end
+
+@implementation MTLModelSortKey
+
+#pragma mark Lifecycle
+
++ (instancetype)sortKeyWithPropertyKey:(NSString *)propertyKey ascending:(BOOL)ascending {
+	return [self sortKeyWithPropertyKey:propertyKey ascending:ascending options:0];
+}
+
++ (instancetype)sortKeyWithPropertyKey:(NSString *)propertyKey ascending:(BOOL)ascending options:(NSStringCompareOptions)options {
+	return [[self alloc] initWithPropertyKey:propertyKey ascending:ascending options:options];
+}
+
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey ascending:(BOOL)ascending options:(NSStringCompareOptions)options {
+	NSParameterAssert(propertyKey != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_propertyKey = [propertyKey copy];
+	_ascending = ascending;
+	_options = options;
+
+	return self;
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	return self;
+}
+
+#pragma mark NSObject
+
+- (NSUInteger)hash {
+	return self.propertyKey.hash ^ self.options ^ (NSUInteger)self.ascending;
+}
+
+- (BOOL)isEqual:(MTLModelSortKey *)sortKey {
+	if (self == sortKey) return YES;
+	if (![sortKey isKindOfClass:MTLModelSortKey.class]) return NO;
+
+	return [self.propertyKey isEqual:sortKey.propertyKey] && self.ascending == sortKey.ascending && self.options == sortKey.options;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ %@", self.class, self, self.propertyKey, self.ascending ? @"ascending" : @"descending"];
+}
+
+@end
+
+@interface MTLModelSorter ()
+
+// The accessors for each of `sortKeys`.
+@property (nonatomic, copy, readonly) NSArray<MTLPropertyAccessor *> *accessors;
+
+@end
+
+@implementation MTLModelSorter
+
+#pragma mark Lifecycle
+
++ (instancetype)sorterWithModelClass:(Class)modelClass sortKeys:(NSArray *)sortKeys error:(NSError **)error {
+	NSParameterAssert(modelClass != nil);
+	NSParameterAssert(sortKeys != nil);
+
+	NSMutableArray *accessors = [NSMutableArray arrayWithCapacity:sortKeys.count];
+	for (MTLModelSortKey *sortKey in sortKeys) {
+		MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:sortKey.propertyKey ofClass:modelClass];
+
+		BOOL comparable = (accessor != nil);
+		if (comparable && accessor.kind == MTLPropertyAccessorKindObject && accessor.objectClass != nil) {
+			comparable = [accessor.objectClass instancesRespondToSelector:@selector(compare:)];
+		}
+
+		if (!comparable) {
+			if (error != NULL) *error = MTLUnsupportedPropertyError(modelClass, sortKey.propertyKey);
+			return nil;
+		}
+
+		[accessors addObject:accessor];
+	}
+
+	return [[self alloc] initWithModelClass:modelClass sortKeys:sortKeys accessors:accessors];
+}
+
++ (instancetype)sorterWithModelClass:(Class)modelClass propertyKeys:(NSArray *)propertyKeys error:(NSError **)error {
+	NSParameterAssert(propertyKeys != nil);
+
+	NSMutableArray *sortKeys = [NSMutableArray arrayWithCapacity:propertyKeys.count];
+	for (NSString *propertyKey in propertyKeys) {
+		[sortKeys addObject:[MTLModelSortKey sortKeyWithPropertyKey:propertyKey ascending:YES]];
+	}
+
+	return [self sorterWithModelClass:modelClass sortKeys:sortKeys error:error];
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass sortKeys:(NSArray *)sortKeys accessors:(NSArray *)accessors {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_modelClass = modelClass;
+	_sortKeys = [sortKeys copy];
+	_accessors = [accessors copy];
+
+	NSArray *capturedSortKeys = _sortKeys;
+	NSArray *capturedAccessors = _accessors;
+
+	_comparator = [^ NSComparisonResult (id left, id right) {
+		for (NSUInteger i = 0; i < capturedAccessors.count; i++) {
+			MTLModelSortKey *sortKey = capturedSortKeys[i];
+			MTLPropertyAccessor *accessor = capturedAccessors[i];
+			NSComparisonResult result = NSOrderedSame;
+
+			switch (accessor.kind) {
+				case MTLPropertyAccessorKindInt64:
+					if (accessor.isUnsigned) {
+						result = MTLCompareScalars((uint64_t)[accessor int64ValueOfModel:left], (uint64_t)[accessor int64ValueOfModel:right]);
+					} else {
+						result = MTLCompareScalars([accessor int64ValueOfModel:left], [accessor int64ValueOfModel:right]);
+					}
+
+					break;
+
+				case MTLPropertyAccessorKindDouble:
+					result = MTLCompareScalars([accessor doubleValueOfModel:left], [accessor doubleValueOfModel:right]);
+					break;
+
+				case MTLPropertyAccessorKindObject:
+					result = MTLCompareSortObjects([accessor objectValueOfModel:left], [accessor objectValueOfModel:right], sortKey.options);
+					break;
+			}
+
+			if (result != NSOrderedSame) return (sortKey.ascending ? result : (NSComparisonResult)-result);
+		}
+
+		return NSOrderedSame;
+	} copy];
+
+	return self;
+}
+
+#pragma mark Sorting
+
+- (NSArray *)sortedArrayFromModels:(NSArray *)models options:(MTLModelSortOptions)options {
+	NSParameterAssert(models != nil);
+
+	NSUInteger count = models.count;
+	if (count < 2 || self.sortKeys.count == 0) return [models copy];
+
+	BOOL concurrent = (options & MTLModelSortOptionsConcurrent) != 0 && count >= MTLConcurrentSortMinimumCount;
+
+	NSMutableArray *buffers = [NSMutableArray arrayWithCapacity:self.sortKeys.count];
+	for (NSUInteger i = 0; i < self.sortKeys.count; i++) {
+		[buffers addObject:[[MTLModelSortBuffer alloc] initWithSortKey:self.sortKeys[i] accessor:self.accessors[i] count:count]];
+	}
+
+	__unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(*objects));
+	[models getObjects:objects range:NSMakeRange(0, count)];
+
+	// Read every sort key of every model once, so that comparisons don't call
+	// any getters.
+	void (^readRange)(NSRange) = ^(NSRange range) {
+		@autoreleasepool {
+			for (MTLModelSortBuffer *buffer in buffers) {
+				for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+					[buffer readModel:objects[i] atIndex:i];
+				}
+			}
+		}
+	};
+
+	if (concurrent) {
+		NSUInteger chunkCount = (count + MTLConcurrentSortChunkLength - 1) / MTLConcurrentSortChunkLength;
+		dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+			NSUInteger start = chunk * MTLConcurrentSortChunkLength;
+			readRange(NSMakeRange(start, MIN(MTLConcurrentSortChunkLength, count - start)));
+		});
+	} else {
+		readRange(NSMakeRange(0, count));
+	}
+
+	MTLSortColumn *columns = malloc(buffers.count * sizeof(*columns));
+	for (NSUInteger i = 0; i < buffers.count; i++) {
+		columns[i] = [buffers[i] column];
+	}
+
+	MTLSortContext context = { .columns = columns, .columnCount = buffers.count };
+
+	NSUInteger *indexes = malloc(count * sizeof(*indexes));
+	NSUInteger *scratch = malloc(count * sizeof(*scratch));
+	for (NSUInteger i = 0; i < count; i++) {
+		indexes[i] = i;
+	}
+
+	if (concurrent) {
+		MTLSortIndexesConcurrently(&context, indexes, scratch, count);
+	} else {
+		MTLSortIndexes(&context, indexes, scratch, count);
+	}
+
+	__unsafe_unretained id *sortedObjects = (__unsafe_unretained id *)malloc(count * sizeof(*sortedObjects));
+	for (NSUInteger i = 0; i < count; i++) {
+		sortedObjects[i] = objects[indexes[i]];
+	}
+
+	NSArray *sortedModels = [NSArray arrayWithObjects:sortedObjects count:count];
+
+	free(sortedObjects);
+	free(scratch);
+	free(indexes);
+	free(columns);
+	free(objects);
+
+	return sortedModels;
+}
+
+#pragma mark Grouping
+
+- (NSDictionary *)groupModels:(NSArray *)models byPropertyKey:(NSString *)propertyKey options:(MTLModelSortOptions)options error:(NSError **)error {
+	NSParameterAssert(models != nil);
+	NSParameterAssert(propertyKey != nil);
+
+	MTLPropertyAccessor *accessor = [MTLPropertyAccessor accessorForPropertyKey:propertyKey ofClass:self.modelClass];
+
+	BOOL groupable = (accessor != nil);
+	if (groupable && accessor.kind == MTLPropertyAccessorKindObject && accessor.objectClass != nil) {
+		groupable = [accessor.objectClass conformsToProtocol:@protocol(NSCopying)];
+	}
+
+	if (!groupable) {
+		if (error != NULL) *error = MTLUnsupportedPropertyError(self.modelClass, propertyKey);
+		return nil;
+	}
+
+	NSMutableDictionary *buckets = [NSMutableDictionary dictionary];
+
+	// Consecutive models often share a value, particularly when the sort keys
+	// begin with the grouped property, so remember the last bucket.
+	id lastValue = nil;
+	NSMutableArray *lastBucket = nil;
+
+	for (id model in [self sortedArrayFromModels:models options:options]) {
+		id value = [accessor objectValueOfModel:model] ?: NSNull.null;
+
+		if (lastBucket == nil || ![value isEqual:lastValue]) {
+			lastValue = value;
+			lastBucket = buckets[value];
+
+			if (lastBucket == nil) {
+				lastBucket = [NSMutableArray array];
+				buckets[value] = lastBucket;
+			}
+		}
+
+		[lastBucket addObject:model];
+	}
+
+	return buckets;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@ %@", self.class, self, self.modelClass, self.sortKeys];
+}
+
+@end
@@ -0,0 +1,135 @@
+//
+//  MTLModelStore.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The domain for errors originating from MTLModelStore.
+extern NSString * const MTLModelStoreErrorDomain;
+
+/// The store file is malformed or truncated.
+extern const NSInteger MTLModelStoreErrorInvalidStore;
+
+/// A model being written has no identity, or the same identity as another
+/// model.
+extern const NSInteger MTLModelStoreErrorInvalidIdentity;
+
+/// A read-only collection of models, backed by a memory-mapped file.
+///
+/// A store file holds every model as a separate MTLBinaryArchiver archive,
+/// preceded by a table of their offsets and optionally followed by an index of
+/// their identities. Opening a store only verifies its header, so it takes the
+/// same time regardless of the number of models. Models are unarchived when
+/// they are first accessed, and a bounded number of them is kept in memory for
+/// subsequent accesses.
+///
+/// Models returned from a store may be shared between accesses, and should be
+/// treated as immutable. Stores are safe to read from multiple threads.
+@interface MTLModelStore : NSObject <NSFastEnumeration>
+
+/// Serializes models into the store format.
+///
+/// models      - The models to store, in order. Every model must be archivable
+///               by MTLBinaryArchiver. This argument must not be nil.
+/// identityKey - If not nil, the property key whose value uniquely identifies
+///               each model. The values must be strings or numbers.
+/// error       - If not NULL, this may be set to an error that occurs during
+///               serialization.
+///
+/// Returns the serialized store, or nil if an error occurred.
++ (nullable NSData *)dataWithModels:(NSArray *)models identityKey:(nullable NSString *)identityKey error:(NSError **)error;
+
+/// Serializes models into the store format and writes them to a file.
+///
+/// This is equivalent to writing the result of
+/// +dataWithModels:identityKey:error: atomically.
+///
+/// Returns whether the store was written successfully.
++ (BOOL)writeModels:(NSArray *)models identityKey:(nullable NSString *)identityKey toURL:(NSURL *)URL error:(NSError **)error;
+
+/// Opens a store file, mapping it into memory if possible.
+///
+/// URL          - The file URL of a store. This argument must not be nil.
+/// modelClasses - The classes that the stored models may be instances of.
+///                This argument must not be nil.
+/// error        - If not NULL, this may be set to an error that occurs while
+///                opening the store.
+///
+/// Returns a store, or nil if the file could not be read or is not a store.
+- (nullable instancetype)initWithContentsOfURL:(NSURL *)URL modelClasses:(NSSet<Class> *)modelClasses error:(NSError **)error;
+
+/// Opens a store which is already in memory.
+///
+/// data         - The data of a store. This argument must not be nil.
+/// modelClasses - The classes that the stored models may be instances of.
+///                This argument must not be nil.
+/// error        - If not NULL, this may be set to an error that occurs while
+///                opening the store.
+///
+/// Returns a store, or nil if `data` is not a store.
+- (nullable instancetype)initWithData:(NSData *)data modelClasses:(NSSet<Class> *)modelClasses error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The number of models in the store.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/// Whether the store was written with an identity key, and therefore supports
+/// -modelWithIdentity:error:.
+@property (nonatomic, assign, readonly) BOOL hasIdentityIndex;
+
+/// The maximum number of unarchived models to keep in memory.
+///
+/// Defaults to 256. Setting this to 0 removes the limit.
+@property (atomic, assign) NSUInteger cacheCountLimit;
+
+/// An array of the models in the store.
+///
+/// Elements are unarchived when they are accessed. Accessing a model which
+/// cannot be unarchived raises NSInternalInconsistencyException.
+@property (nonatomic, copy, readonly) NSArray *models;
+
+/// Unarchives the model at an index.
+///
+/// index - The index of the model. An index not less than `count` raises
+///         NSRangeException.
+/// error - If not NULL, this may be set to an error that occurs while
+///         unarchiving the model.
+///
+/// Returns the model, or nil if it could not be unarchived.
+- (nullable id)modelAtIndex:(NSUInteger)index error:(NSError **)error;
+
+/// Looks up a model by the value of its identity key.
+///
+/// identity - A string or number. This argument must not be nil.
+/// error    - If not NULL, this may be set to an error that occurs while
+///            unarchiving the model.
+///
+/// Returns the model, or nil if the store has no model with that identity or
+/// it could not be unarchived.
+- (nullable id)modelWithIdentity:(id)identity error:(NSError **)error;
+
+/// Looks up the index of a model by the value of its identity key, without
+/// unarchiving it.
+///
+/// Returns the index of the model, or NSNotFound.
+- (NSUInteger)indexOfModelWithIdentity:(id)identity;
+
+/// Equivalent to -modelAtIndex:error: without an error.
+- (nullable id)objectAtIndexedSubscript:(NSUInteger)index;
+
+/// Equivalent to -modelWithIdentity:error: without an error.
+- (nullable id)objectForKeyedSubscript:(id)identity;
+
+/// Discards all models kept in memory.
+- (void)removeAllCachedModels;
+
+@end
+
+NS_ASSUME_NONNULL_END
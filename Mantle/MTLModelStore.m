@@ -0,0 +1,500 @@
+//
+//  MTLModelStore.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLModelStore.h"
+#import "MTLBinaryArchiver.h"
+
+NSString * const MTLModelStoreErrorDomain = @"MTLModelStoreErrorDomain";
+const NSInteger MTLModelStoreErrorInvalidStore = 1;
+const NSInteger MTLModelStoreErrorInvalidIdentity = 2;
+
+// Stores start with these bytes.
+static const uint8_t MTLModelStoreMagic[4] = { 'M', 'T', 'L', 'S' };
+static const uint32_t MTLModelStoreFormatVersion = 1;
+
+// The header consists of the magic bytes, the 32-bit format version, the
+// 64-bit number of models and the 64-bit offset of the identity index (or 0).
+//
+// It is followed by the 64-bit offsets of every model archive, plus the offset
+// where the last archive ends, and then the archives themselves.
+//
+// The identity index consists of one MTLModelStoreIdentityEntry per model,
+// sorted by hash and then by identity, followed by the identities as UTF-8.
+//
+// All integers are little-endian.
+static const NSUInteger MTLModelStoreHeaderLength = 4 + 4 + 8 + 8;
+
+typedef struct {
+	uint64_t hash;
+	uint64_t identityOffset;
+	uint32_t identityLength;
+	uint32_t index;
+} MTLModelStoreIdentityEntry;
+
+static const NSUInteger MTLModelStoreIdentityEntryLength = 8 + 8 + 4 + 4;
+
+// The default value of cacheCountLimit.
+static const NSUInteger MTLModelStoreDefaultCacheCountLimit = 256;
+
+#pragma mark Helpers
+
+static NSError *MTLModelStoreError(NSInteger code, NSString *description, NSString *failureReason, NSError *underlyingError) {
+	NSMutableDictionary *userInfo = [@{
+		NSLocalizedDescriptionKey: description,
+		NSLocalizedFailureReasonErrorKey: failureReason
+	} mutableCopy];
+
+	if (underlyingError != nil) userInfo[NSUnderlyingErrorKey] = underlyingError;
+
+	return [NSError errorWithDomain:MTLModelStoreErrorDomain code:code userInfo:userInfo];
+}
+
+static NSError *MTLModelStoreInvalidStoreError(void) {
+	return MTLModelStoreError(MTLModelStoreErrorInvalidStore, NSLocalizedString(@"Could not read model store", @""), NSLocalizedString(@"The data is not a valid model store.", @""), nil);
+}
+
+// Returns the UTF-8 string which identifies a model with the given identity
+// key value, or nil if it's neither a string nor a number.
+static NSString *MTLModelStoreIdentityString(id identity) {
+	if ([identity isKindOfClass:NSString.class]) return identity;
+	if ([identity isKindOfClass:NSNumber.class]) return [identity stringValue];
+
+	return nil;
+}
+
+// 64-bit FNV-1a, which unlike -[NSString hash] is stable across processes.
+static uint64_t MTLModelStoreHash(const uint8_t *bytes, NSUInteger length) {
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (NSUInteger i = 0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+static void MTLModelStoreAppendUInt32(NSMutableData *data, uint32_t value) {
+	value = CFSwapInt32HostToLittle(value);
+	[data appendBytes:&value length:sizeof(value)];
+}
+
+static void MTLModelStoreAppendUInt64(NSMutableData *data, uint64_t value) {
+	value = CFSwapInt64HostToLittle(value);
+	[data appendBytes:&value length:sizeof(value)];
+}
+
+static uint32_t MTLModelStoreReadUInt32(const uint8_t *bytes) {
+	uint32_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return CFSwapInt32LittleToHost(value);
+}
+
+static uint64_t MTLModelStoreReadUInt64(const uint8_t *bytes) {
+	uint64_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return CFSwapInt64LittleToHost(value);
+}
+
+// Exposes a store as an NSArray.
+@interface MTLModelStoreArray : NSArray
+
+- (instancetype)initWithStore:(MTLModelStore *)store;
+
+@end
+
+@implementation MTLModelStore {
+	NSData *_data;
+	NSSet *_modelClasses;
+
+	// Unarchived models, keyed by their index.
+	NSCache *_cache;
+
+	// Where the offset table, the archives and the identity index start.
+	NSUInteger _offsetTableOffset;
+	NSUInteger _archivesEnd;
+	NSUInteger _identityIndexOffset;
+}
+
+#pragma mark Writing
+
++ (NSData *)dataWithModels:(NSArray *)models identityKey:(NSString *)identityKey error:(NSError **)error {
+	NSParameterAssert(models != nil);
+
+	NSUInteger count = models.count;
+	NSMutableArray *archives = [[NSMutableArray alloc] initWithCapacity:count];
+	NSMutableArray *identities = (identityKey != nil ? [[NSMutableArray alloc] initWithCapacity:count] : nil);
+	NSMutableSet *uniqueIdentities = (identityKey != nil ? [[NSMutableSet alloc] initWithCapacity:count] : nil);
+
+	for (id model in models) {
+		if (identityKey != nil) {
+			NSString *identity = MTLModelStoreIdentityString([model valueForKey:identityKey]);
+			if (identity == nil || [uniqueIdentities containsObject:identity]) {
+				if (error != NULL) {
+					NSString *failureReason = (identity == nil
+						? [NSString stringWithFormat:NSLocalizedString(@"The value of \"%@\" of %@ is not a string or number.", @""), identityKey, model]
+						: [NSString stringWithFormat:NSLocalizedString(@"More than one model has the identity \"%@\".", @""), identity]);
+
+					*error = MTLModelStoreError(MTLModelStoreErrorInvalidIdentity, NSLocalizedString(@"Could not write model store", @""), failureReason, nil);
+				}
+
+				return nil;
+			}
+
+			[uniqueIdentities addObject:identity];
+			[identities addObject:identity];
+		}
+
+		NSError *archiveError = nil;
+		NSData *archive = [MTLBinaryArchiver archivedDataWithRootObject:model error:&archiveError];
+		if (archive == nil) {
+			if (error != NULL) {
+				NSString *failureReason = [NSString stringWithFormat:NSLocalizedString(@"%@ could not be archived.", @""), model];
+				*error = MTLModelStoreError(archiveError.code, NSLocalizedString(@"Could not write model store", @""), failureReason, archiveError);
+			}
+
+			return nil;
+		}
+
+		[archives addObject:archive];
+	}
+
+	NSMutableData *data = [[NSMutableData alloc] init];
+
+	uint64_t archivesOffset = MTLModelStoreHeaderLength + (count + 1) * sizeof(uint64_t);
+	uint64_t archivesEnd = archivesOffset;
+	for (NSData *archive in archives) {
+		archivesEnd += archive.length;
+	}
+
+	[data appendBytes:MTLModelStoreMagic length:sizeof(MTLModelStoreMagic)];
+	MTLModelStoreAppendUInt32(data, MTLModelStoreFormatVersion);
+	MTLModelStoreAppendUInt64(data, count);
+	MTLModelStoreAppendUInt64(data, (identities != nil ? archivesEnd : 0));
+
+	uint64_t offset = archivesOffset;
+	for (NSData *archive in archives) {
+		MTLModelStoreAppendUInt64(data, offset);
+		offset += archive.length;
+	}
+
+	MTLModelStoreAppendUInt64(data, offset);
+
+	for (NSData *archive in archives) {
+		[data appendData:archive];
+	}
+
+	if (identities == nil) return data;
+
+	NSMutableArray *identityBytes = [[NSMutableArray alloc] initWithCapacity:count];
+	NSMutableArray *hashes = [[NSMutableArray alloc] initWithCapacity:count];
+	NSMutableArray *indexes = [[NSMutableArray alloc] initWithCapacity:count];
+
+	for (NSUInteger i = 0; i < count; i++) {
+		NSData *bytes = [identities[i] dataUsingEncoding:NSUTF8StringEncoding];
+		[identityBytes addObject:bytes];
+		[hashes addObject:@(MTLModelStoreHash(bytes.bytes, bytes.length))];
+		[indexes addObject:@(i)];
+	}
+
+	// Sort by hash, and then by identity, to match the lookup.
+	[indexes sortUsingComparator:^ NSComparisonResult (NSNumber *index1, NSNumber *index2) {
+		NSComparisonResult result = [hashes[index1.unsignedIntegerValue] compare:hashes[index2.unsignedIntegerValue]];
+		if (result != NSOrderedSame) return result;
+
+		NSData *bytes1 = identityBytes[index1.unsignedIntegerValue];
+		NSData *bytes2 = identityBytes[index2.unsignedIntegerValue];
+
+		int comparison = memcmp(bytes1.bytes, bytes2.bytes, MIN(bytes1.length, bytes2.length));
+		if (comparison == 0) return [@(bytes1.length) compare:@(bytes2.length)];
+
+		return (comparison < 0 ? NSOrderedAscending : NSOrderedDescending);
+	}];
+
+	uint64_t identityOffset = archivesEnd + count * MTLModelStoreIdentityEntryLength;
+	for (NSNumber *index in indexes) {
+		NSData *bytes = identityBytes[index.unsignedIntegerValue];
+
+		MTLModelStoreAppendUInt64(data, [hashes[index.unsignedIntegerValue] unsignedLongLongValue]);
+		MTLModelStoreAppendUInt64(data, identityOffset);
+		MTLModelStoreAppendUInt32(data, (uint32_t)bytes.length);
+		MTLModelStoreAppendUInt32(data, (uint32_t)index.unsignedIntegerValue);
+
+		identityOffset += bytes.length;
+	}
+
+	for (NSNumber *index in indexes) {
+		[data appendData:identityBytes[index.unsignedIntegerValue]];
+	}
+
+	return data;
+}
+
++ (BOOL)writeModels:(NSArray *)models identityKey:(NSString *)identityKey toURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	NSData *data = [self dataWithModels:models identityKey:identityKey error:error];
+	if (data == nil) return NO;
+
+	return [data writeToURL:URL options:NSDataWritingAtomic error:error];
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithContentsOfURL:(NSURL *)URL modelClasses:(NSSet *)modelClasses error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	NSData *data = [NSData dataWithContentsOfURL:URL options:NSDataReadingMappedIfSafe error:error];
+	if (data == nil) return nil;
+
+	return [self initWithData:data modelClasses:modelClasses error:error];
+}
+
+- (instancetype)initWithData:(NSData *)data modelClasses:(NSSet *)modelClasses error:(NSError **)error {
+	NSParameterAssert(data != nil);
+	NSParameterAssert(modelClasses != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_data = [data copy];
+	_modelClasses = [modelClasses copy];
+
+	_cache = [[NSCache alloc] init];
+	_cache.countLimit = MTLModelStoreDefaultCacheCountLimit;
+
+	const uint8_t *bytes = _data.bytes;
+	NSUInteger length = _data.length;
+
+	if (length < MTLModelStoreHeaderLength || memcmp(bytes, MTLModelStoreMagic, sizeof(MTLModelStoreMagic)) != 0 || MTLModelStoreReadUInt32(bytes + 4) != MTLModelStoreFormatVersion) {
+		if (error != NULL) *error = MTLModelStoreInvalidStoreError();
+		return nil;
+	}
+
+	uint64_t count = MTLModelStoreReadUInt64(bytes + 8);
+	uint64_t identityIndexOffset = MTLModelStoreReadUInt64(bytes + 16);
+
+	// Only the sizes of the tables are verified here, so that opening a store
+	// doesn't depend on the number of models. Offsets are verified when they
+	// are used.
+	_offsetTableOffset = MTLModelStoreHeaderLength;
+	if (count >= (length - _offsetTableOffset) / sizeof(uint64_t)) {
+		if (error != NULL) *error = MTLModelStoreInvalidStoreError();
+		return nil;
+	}
+
+	_count = (NSUInteger)count;
+
+	NSUInteger offsetTableEnd = _offsetTableOffset + (_count + 1) * sizeof(uint64_t);
+	if (identityIndexOffset != 0) {
+		if (identityIndexOffset < offsetTableEnd || identityIndexOffset > length || (length - identityIndexOffset) / MTLModelStoreIdentityEntryLength < count) {
+			if (error != NULL) *error = MTLModelStoreInvalidStoreError();
+			return nil;
+		}
+
+		_identityIndexOffset = (NSUInteger)identityIndexOffset;
+		_archivesEnd = _identityIndexOffset;
+	} else {
+		_archivesEnd = length;
+	}
+
+	return self;
+}
+
+#pragma mark Properties
+
+- (BOOL)hasIdentityIndex {
+	return _identityIndexOffset != 0;
+}
+
+- (NSUInteger)cacheCountLimit {
+	return _cache.countLimit;
+}
+
+- (void)setCacheCountLimit:(NSUInteger)limit {
+	_cache.countLimit = limit;
+}
+
+- (NSArray *)models {
+	// Not cached, since the array retains the store.
+	return [[MTLModelStoreArray alloc] initWithStore:self];
+}
+
+#pragma mark Reading
+
+- (id)modelAtIndex:(NSUInteger)index error:(NSError **)error {
+	// Checked in release builds too, since the offset table is read directly.
+	if (index >= _count) {
+		[NSException raise:NSRangeException format:@"Index %lu is out of bounds of %@", (unsigned long)index, self];
+	}
+
+	NSNumber *key = @(index);
+	id model = [_cache objectForKey:key];
+	if (model != nil) return model;
+
+	const uint8_t *bytes = _data.bytes;
+	const uint8_t *offsets = bytes + _offsetTableOffset + index * sizeof(uint64_t);
+	uint64_t start = MTLModelStoreReadUInt64(offsets);
+	uint64_t end = MTLModelStoreReadUInt64(offsets + sizeof(uint64_t));
+
+	NSUInteger archivesOffset = _offsetTableOffset + (_count + 1) * sizeof(uint64_t);
+	if (start < archivesOffset || start > end || end > _archivesEnd) {
+		if (error != NULL) *error = MTLModelStoreInvalidStoreError();
+		return nil;
+	}
+
+	// The store's data outlives the unarchiver, which copies everything it
+	// decodes.
+	NSData *archive = [NSData dataWithBytesNoCopy:(void *)(bytes + start) length:(NSUInteger)(end - start) freeWhenDone:NO];
+
+	NSError *unarchiveError = nil;
+	model = [MTLBinaryUnarchiver unarchivedObjectOfClasses:_modelClasses fromData:archive error:&unarchiveError];
+	if (model == nil) {
+		if (error != NULL) {
+			NSString *failureReason = [NSString stringWithFormat:NSLocalizedString(@"The model at index %lu could not be unarchived.", @""), (unsigned long)index];
+			*error = MTLModelStoreError(MTLModelStoreErrorInvalidStore, NSLocalizedString(@"Could not read model store", @""), failureReason, unarchiveError);
+		}
+
+		return nil;
+	}
+
+	[_cache setObject:model forKey:key];
+	return model;
+}
+
+- (NSUInteger)indexOfModelWithIdentity:(id)identity {
+	NSParameterAssert(identity != nil);
+
+	if (_identityIndexOffset == 0) return NSNotFound;
+
+	NSString *identityString = MTLModelStoreIdentityString(identity);
+	if (identityString == nil) return NSNotFound;
+
+	NSData *identityBytes = [identityString dataUsingEncoding:NSUTF8StringEncoding];
+	uint64_t hash = MTLModelStoreHash(identityBytes.bytes, identityBytes.length);
+
+	const uint8_t *bytes = _data.bytes;
+	const uint8_t *entries = bytes + _identityIndexOffset;
+
+	// Find the first entry with the hash.
+	NSUInteger low = 0;
+	NSUInteger high = _count;
+	while (low < high) {
+		NSUInteger middle = low + (high - low) / 2;
+		if (MTLModelStoreReadUInt64(entries + middle * MTLModelStoreIdentityEntryLength) < hash) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	for (NSUInteger i = low; i < _count; i++) {
+		const uint8_t *entryBytes = entries + i * MTLModelStoreIdentityEntryLength;
+
+		MTLModelStoreIdentityEntry entry = {
+			.hash = MTLModelStoreReadUInt64(entryBytes),
+			.identityOffset = MTLModelStoreReadUInt64(entryBytes + 8),
+			.identityLength = MTLModelStoreReadUInt32(entryBytes + 16),
+			.index = MTLModelStoreReadUInt32(entryBytes + 20),
+		};
+
+		if (entry.hash != hash) break;
+		if (entry.identityLength != identityBytes.length) continue;
+		if (entry.identityOffset > _data.length || _data.length - entry.identityOffset < entry.identityLength) continue;
+		if (memcmp(bytes + entry.identityOffset, identityBytes.bytes, entry.identityLength) != 0) continue;
+
+		return (entry.index < _count ? entry.index : NSNotFound);
+	}
+
+	return NSNotFound;
+}
+
+- (id)modelWithIdentity:(id)identity error:(NSError **)error {
+	NSUInteger index = [self indexOfModelWithIdentity:identity];
+	if (index == NSNotFound) return nil;
+
+	return [self modelAtIndex:index error:error];
+}
+
+- (id)objectAtIndexedSubscript:(NSUInteger)index {
+	return [self modelAtIndex:index error:NULL];
+}
+
+- (id)objectForKeyedSubscript:(id)identity {
+	return [self modelWithIdentity:identity error:NULL];
+}
+
+- (void)removeAllCachedModels {
+	[_cache removeAllObjects];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length {
+	// The store never changes.
+	state->mutationsPtr = &state->extra[0];
+	state->itemsPtr = buffer;
+
+	NSUInteger index = state->state;
+	NSUInteger enumerated = 0;
+
+	while (index < _count && enumerated < length) {
+		// Keep the model alive until the next call, even if it's evicted from
+		// the cache.
+		__autoreleasing id model = [self modelAtIndex:index error:NULL];
+		if (model == nil) {
+			[NSException raise:NSInternalInconsistencyException format:@"Could not unarchive the model at index %lu of %@", (unsigned long)index, self];
+		}
+
+		buffer[enumerated++] = model;
+		index++;
+	}
+
+	state->state = index;
+	return enumerated;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> { count = %lu }", self.class, self, (unsigned long)_count];
+}
+
+@end
+
+@implementation MTLModelStoreArray {
+	MTLModelStore *_store;
+}
+
+- (instancetype)initWithStore:(MTLModelStore *)store {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_store = store;
+
+	return self;
+}
+
+- (NSUInteger)count {
+	return _store.count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+	NSError *error = nil;
+	id model = [_store modelAtIndex:index error:&error];
+	if (model == nil) {
+		[NSException raise:NSInternalInconsistencyException format:@"Could not unarchive the model at index %lu of %@: %@", (unsigned long)index, _store, error];
+	}
+
+	return model;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+	return self;
+}
+
+@end
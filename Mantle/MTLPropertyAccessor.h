@@ -0,0 +1,64 @@
+//
+//  MTLPropertyAccessor.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// How an MTLPropertyAccessor reads its property.
+typedef NS_ENUM(NSInteger, MTLPropertyAccessorKind) {
+	/// Integer and BOOL properties, read as int64_t.
+	MTLPropertyAccessorKindInt64,
+
+	/// float and double properties, read as double.
+	MTLPropertyAccessorKindDouble,
+
+	/// Object properties.
+	MTLPropertyAccessorKindObject,
+};
+
+/// Reads a property of models by calling the implementation of its getter
+/// directly, without going through KVC or boxing primitive values.
+///
+/// Accessors are immutable and safe to use from multiple threads.
+@interface MTLPropertyAccessor : NSObject
+
+/// Returns the accessor for a property of a class, creating and caching it if
+/// necessary.
+///
+/// Returns nil if the class has no such property, or if it is of a type other
+/// than an object, an integer, a BOOL or a floating point number.
++ (nullable instancetype)accessorForPropertyKey:(NSString *)propertyKey ofClass:(Class)modelClass;
+
+/// The property being read.
+@property (nonatomic, copy, readonly) NSString *propertyKey;
+
+/// How the property is read.
+@property (nonatomic, assign, readonly) MTLPropertyAccessorKind kind;
+
+/// The declared class of an object property, or nil.
+@property (nonatomic, strong, readonly, nullable) Class objectClass;
+
+/// Whether the property is of an unsigned integer type.
+@property (nonatomic, assign, readonly, getter = isUnsigned) BOOL unsignedInteger;
+
+/// Reads an MTLPropertyAccessorKindInt64 property.
+- (int64_t)int64ValueOfModel:(id)model;
+
+/// Reads a numeric property as a double.
+///
+/// For object properties, this reads the -doubleValue of NSNumbers and the
+/// -timeIntervalSinceReferenceDate of NSDates, and returns 0 for nil.
+- (double)doubleValueOfModel:(id)model;
+
+/// Reads the property as an object, boxing primitive values.
+- (nullable id)objectValueOfModel:(id)model;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,183 @@
+//
+//  MTLPropertyAccessor.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <objc/runtime.h>
+
+#import <Mantle/EXTRuntimeExtensions.h>
+#import <Mantle/EXTScope.h>
+#import "MTLPropertyAccessor.h"
+#import "MTLTracing.h"
+
+// Used to cache the accessors of a class, keyed by property key.
+static void *MTLPropertyAccessorsKey = &MTLPropertyAccessorsKey;
+
+@implementation MTLPropertyAccessor {
+	// The class the getter implementation was resolved on. Instances of other
+	// classes, such as subclasses overriding the getter, resolve it again.
+	Class _modelClass;
+
+	SEL _getter;
+	IMP _getterImplementation;
+
+	// The first character of the property's type encoding.
+	char _encoding;
+}
+
+#pragma mark Lifecycle
+
++ (instancetype)accessorForPropertyKey:(NSString *)propertyKey ofClass:(Class)modelClass {
+	NSParameterAssert(propertyKey != nil);
+	NSParameterAssert(modelClass != nil);
+
+	@synchronized (modelClass) {
+		NSMutableDictionary *accessors = objc_getAssociatedObject(modelClass, MTLPropertyAccessorsKey);
+		if (accessors == nil) {
+			accessors = [NSMutableDictionary dictionary];
+			objc_setAssociatedObject(modelClass, MTLPropertyAccessorsKey, accessors, OBJC_ASSOCIATION_RETAIN);
+		}
+
+		id accessor = accessors[propertyKey];
+		if (accessor == nil) {
+			MTL_PROBE2(cache__miss, class_getName(modelClass), "propertyAccessor");
+
+			accessor = [[self alloc] initWithPropertyKey:propertyKey modelClass:modelClass] ?: NSNull.null;
+			accessors[propertyKey] = accessor;
+		}
+
+		return (accessor != NSNull.null ? accessor : nil);
+	}
+}
+
+- (instancetype)initWithPropertyKey:(NSString *)propertyKey modelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	objc_property_t property = class_getProperty(modelClass, propertyKey.UTF8String);
+	if (property == NULL) return nil;
+
+	mtl_propertyAttributes *attributes = mtl_copyPropertyAttributes(property);
+	if (attributes == NULL) return nil;
+
+	@onExit {
+		free(attributes);
+	};
+
+	_propertyKey = [propertyKey copy];
+	_modelClass = modelClass;
+	_getter = attributes->getter;
+	_getterImplementation = [modelClass instanceMethodForSelector:_getter];
+	_encoding = attributes->type[0];
+
+	switch (_encoding) {
+		case 'C': case 'I': case 'S': case 'L': case 'Q':
+			_unsignedInteger = YES;
+			// fallthrough
+
+		case 'c': case 'i': case 's': case 'l': case 'q': case 'B':
+			_kind = MTLPropertyAccessorKindInt64;
+			break;
+
+		case 'f': case 'd':
+			_kind = MTLPropertyAccessorKindDouble;
+			break;
+
+		case '@':
+			_kind = MTLPropertyAccessorKindObject;
+			_objectClass = attributes->objectClass;
+			break;
+
+		default:
+			return nil;
+	}
+
+	return self;
+}
+
+#pragma mark Reading
+
+- (IMP)getterImplementationForModel:(id)model {
+	if (object_getClass(model) == _modelClass) return _getterImplementation;
+
+	return [model methodForSelector:_getter];
+}
+
+- (int64_t)int64ValueOfModel:(id)model {
+	NSAssert(_kind == MTLPropertyAccessorKindInt64, @"%@ is not an integer property", self.propertyKey);
+
+	IMP getter = [self getterImplementationForModel:model];
+
+	switch (_encoding) {
+		#define MTL_READ_INTEGER(ENCODING, TYPE) \
+			case ENCODING: \
+				return (int64_t)((TYPE (*)(id, SEL))getter)(model, _getter);
+
+		MTL_READ_INTEGER('c', char)
+		MTL_READ_INTEGER('i', int)
+		MTL_READ_INTEGER('s', short)
+		MTL_READ_INTEGER('l', long)
+		MTL_READ_INTEGER('q', long long)
+		MTL_READ_INTEGER('C', unsigned char)
+		MTL_READ_INTEGER('I', unsigned int)
+		MTL_READ_INTEGER('S', unsigned short)
+		MTL_READ_INTEGER('L', unsigned long)
+		MTL_READ_INTEGER('Q', unsigned long long)
+		MTL_READ_INTEGER('B', bool)
+
+		#undef MTL_READ_INTEGER
+
+		default:
+			return 0;
+	}
+}
+
+- (double)doubleValueOfModel:(id)model {
+	switch (_kind) {
+		case MTLPropertyAccessorKindInt64:
+			return (_unsignedInteger ? (double)(uint64_t)[self int64ValueOfModel:model] : (double)[self int64ValueOfModel:model]);
+
+		case MTLPropertyAccessorKindDouble: {
+			IMP getter = [self getterImplementationForModel:model];
+
+			if (_encoding == 'f') return ((float (*)(id, SEL))getter)(model, _getter);
+			return ((double (*)(id, SEL))getter)(model, _getter);
+		}
+
+		case MTLPropertyAccessorKindObject: {
+			id value = [self objectValueOfModel:model];
+
+			if ([value isKindOfClass:NSDate.class]) return [value timeIntervalSinceReferenceDate];
+			if ([value respondsToSelector:@selector(doubleValue)]) return [value doubleValue];
+
+			return 0;
+		}
+	}
+}
+
+- (id)objectValueOfModel:(id)model {
+	switch (_kind) {
+		case MTLPropertyAccessorKindInt64:
+			if (_encoding == 'B') return @((BOOL)[self int64ValueOfModel:model]);
+			if (_unsignedInteger) return @((uint64_t)[self int64ValueOfModel:model]);
+
+			return @([self int64ValueOfModel:model]);
+
+		case MTLPropertyAccessorKindDouble:
+			return @([self doubleValueOfModel:model]);
+
+		case MTLPropertyAccessorKindObject:
+			return ((id (*)(id, SEL))[self getterImplementationForModel:model])(model, _getter);
+	}
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> %@.%@", self.class, self, _modelClass, self.propertyKey];
+}
+
+@end
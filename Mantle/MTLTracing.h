@@ -0,0 +1,94 @@
+//
+//  MTLTracing.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// Static tracepoints (USDT probes) for tracing Mantle with tools like bpftrace
+// and SystemTap, under the "mantle" provider.
+//
+// The probes are only compiled in when MANTLE_USDT is defined to 1, which
+// requires Linux and SystemTap's <sys/sdt.h>. Otherwise every MTL_PROBE macro
+// expands to nothing, and its arguments aren't evaluated.
+//
+// Each probe has a semaphore, which tracers increment while attached, and its
+// arguments are only computed while it's nonzero. Untraced probes cost a load
+// and a branch.
+//
+// Class names and property keys are passed as C strings, and flags as ints:
+//
+//   decode__start(class)                      -modelFromJSONDictionary:error:
+//   decode__done(class, success)
+//   encode__start(class)                      -JSONDictionaryFromModel:error:
+//   encode__done(class, success)
+//   transform__start(class, key, reverse)     Every value transformation.
+//   transform__done(class, key, reverse, success)
+//   validate__start(class, key)               Every property validation.
+//   validate__done(class, key, success)
+//   coder__decode__start(class)               -initWithCoder:
+//   coder__decode__done(class, success)
+//   coder__encode__start(class)               -encodeWithCoder:
+//   coder__encode__done(class)
+//   cache__miss(class, cache)                 Per-class metadata being built.
+//
+// For example, to histogram decode latencies by class:
+//
+//   bpftrace -e '
+//     usdt:./app:mantle:decode__start { @start[tid] = nsecs; }
+//     usdt:./app:mantle:decode__done /@start[tid]/ {
+//       @ns[str(arg0)] = hist(nsecs - @start[tid]); delete(@start[tid]);
+//     }'
+
+#define MTL_PROBES(PROBE) \
+	PROBE(decode__start) \
+	PROBE(decode__done) \
+	PROBE(encode__start) \
+	PROBE(encode__done) \
+	PROBE(transform__start) \
+	PROBE(transform__done) \
+	PROBE(validate__start) \
+	PROBE(validate__done) \
+	PROBE(coder__decode__start) \
+	PROBE(coder__decode__done) \
+	PROBE(coder__encode__start) \
+	PROBE(coder__encode__done) \
+	PROBE(cache__miss)
+
+#if defined(MANTLE_USDT) && MANTLE_USDT
+
+#if !defined(__linux__) || !__has_include(<sys/sdt.h>)
+#error "MANTLE_USDT requires Linux and SystemTap's <sys/sdt.h>"
+#endif
+
+#define _SDT_HAS_SEMAPHORES 1
+#import <sys/sdt.h>
+
+#define MTL_PROBE_SEMAPHORE(name) mantle_##name##_semaphore
+
+#define MTL_DECLARE_PROBE_SEMAPHORE(name) extern unsigned short MTL_PROBE_SEMAPHORE(name);
+MTL_PROBES(MTL_DECLARE_PROBE_SEMAPHORE)
+#undef MTL_DECLARE_PROBE_SEMAPHORE
+
+#define MTL_PROBE_ENABLED(name) __builtin_expect(MTL_PROBE_SEMAPHORE(name) != 0, 0)
+
+#define MTL_PROBE1(name, arg1) \
+	do { if (MTL_PROBE_ENABLED(name)) STAP_PROBE1(mantle, name, arg1); } while (0)
+#define MTL_PROBE2(name, arg1, arg2) \
+	do { if (MTL_PROBE_ENABLED(name)) STAP_PROBE2(mantle, name, arg1, arg2); } while (0)
+#define MTL_PROBE3(name, arg1, arg2, arg3) \
+	do { if (MTL_PROBE_ENABLED(name)) STAP_PROBE3(mantle, name, arg1, arg2, arg3); } while (0)
+#define MTL_PROBE4(name, arg1, arg2, arg3, arg4) \
+	do { if (MTL_PROBE_ENABLED(name)) STAP_PROBE4(mantle, name, arg1, arg2, arg3, arg4); } while (0)
+
+#else
+
+#define MTL_PROBE1(name, arg1) do {} while (0)
+#define MTL_PROBE2(name, arg1, arg2) do {} while (0)
+#define MTL_PROBE3(name, arg1, arg2, arg3) do {} while (0)
+#define MTL_PROBE4(name, arg1, arg2, arg3, arg4) do {} while (0)
+
+#endif
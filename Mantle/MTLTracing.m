@@ -0,0 +1,19 @@
+//
+//  MTLTracing.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import "MTLTracing.h"
+
+#if defined(MANTLE_USDT) && MANTLE_USDT
+
+// Tracers find the semaphores through the notes emitted by each probe, and
+// expect them in the .probes section.
+#define MTL_DEFINE_PROBE_SEMAPHORE(name) __attribute__((used, section(".probes"))) unsigned short MTL_PROBE_SEMAPHORE(name) = 0;
+MTL_PROBES(MTL_DEFINE_PROBE_SEMAPHORE)
+#undef MTL_DEFINE_PROBE_SEMAPHORE
+
+#endif
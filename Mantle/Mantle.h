@@ -15,8 +15,18 @@ FOUNDATION_EXPORT double MantleVersionNumber;
 FOUNDATION_EXPORT const unsigned char MantleVersionString[];
 
 #import <Mantle/MTLJSONAdapter.h>
+#import <Mantle/MTLJSONAdapter+Metrics.h>
 #import <Mantle/MTLModel.h>
 #import <Mantle/MTLModel+NSCoding.h>
+#import <Mantle/MTLModel+Diffing.h>
+#import <Mantle/MTLModel+DirtyTracking.h>
+#import <Mantle/MTLModel+MemoryUsage.h>
+#import <Mantle/MTLBinaryArchiver.h>
+#import <Mantle/MTLModelStore.h>
+#import <Mantle/MTLColumnarBatch.h>
+#import <Mantle/MTLCompiledPredicate.h>
+#import <Mantle/MTLModelSorter.h>
+#import <Mantle/MTLModelCollection.h>
 #import <Mantle/MTLValueTransformer.h>
 #import <Mantle/MTLTransformerErrorHandling.h>
 #import <Mantle/NSArray+MTLManipulationAdditions.h>
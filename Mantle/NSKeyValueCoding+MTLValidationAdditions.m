@@ -8,6 +8,8 @@
 
 #import "NSKeyValueCoding+MTLValidationAdditions.h"
 #import "MTLReflection.h"
+#import "MTLTracing.h"
+#import <objc/runtime.h>
 #import "NSError+MTLModelException.h"
 
 BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUpdate, NSError **error) {
@@ -17,7 +19,11 @@ BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUpdate, N
 	__autoreleasing id validatedValue = value;
 
 	@try {
-		if (![obj validateValue:&validatedValue forKey:key error:error]) return NO;
+		MTL_PROBE2(validate__start, object_getClassName(obj), key.UTF8String);
+		BOOL valid = [obj validateValue:&validatedValue forKey:key error:error];
+		MTL_PROBE3(validate__done, object_getClassName(obj), key.UTF8String, valid);
+
+		if (!valid) return NO;
 
 		if (forceUpdate || value != validatedValue) {
 			[obj setValue:validatedValue forKey:key];
@@ -24,6 +24,40 @@ extern NSString * const MTLURLValueTransformerName;
 /// proper boolean.
 extern NSString * const MTLBooleanValueTransformerName;
 
+/// The name for a value transformer that converts base64 strings into NSData
+/// and back, using the standard alphabet (RFC 4648 §4).
+///
+/// Reverse transformations produce padded output. Forward transformations
+/// accept padded and unpadded input, but fail on any other character,
+/// including whitespace.
+extern NSString * const MTLBase64DataValueTransformerName;
+
+/// The name for a value transformer that converts base64 strings into NSData
+/// and back, using the URL and filename safe alphabet (RFC 4648 §5).
+///
+/// Reverse transformations produce unpadded output, as is customary for
+/// tokens and signatures. Forward transformations accept padded and unpadded
+/// input.
+extern NSString * const MTLBase64URLDataValueTransformerName;
+
+/// The name for a value transformer that converts hexadecimal strings into
+/// NSData and back.
+///
+/// Reverse transformations produce lowercase output. Forward transformations
+/// accept either case.
+extern NSString * const MTLHexDataValueTransformerName;
+
+/// Options for +mtl_arrayMappingTransformerWithTransformer:options:.
+typedef NS_OPTIONS(NSUInteger, MTLArrayMappingOptions) {
+	MTLArrayMappingOptionsNone = 0,
+
+	/// Transform large arrays in chunks on a concurrent queue.
+	///
+	/// The element transformer must be safe to use from multiple threads at
+	/// once. Small arrays are always transformed on the calling thread.
+	MTLArrayMappingOptionsConcurrent = 1 << 0,
+};
+
 @interface NSValueTransformer (MTLPredefinedTransformerAdditions)
 
 /// An optionally reversible transformer which applies the given transformer to
@@ -31,10 +65,17 @@ extern NSString * const MTLBooleanValueTransformerName;
 ///
 /// transformer - The transformer to apply to each element. If the transformer
 ///               is reversible, the transformer returned by this method will be
-///               reversible. This argument must not be nil.
+///               reversible. Its transformation methods are looked up once,
+///               when the returned transformer is created. This argument must
+///               not be nil.
+/// options     - Options controlling how arrays are transformed.
 ///
 /// Returns a transformer which applies a transformation to each element of an
 /// array.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer options:(MTLArrayMappingOptions)options;
+
+/// Returns a value transformer created by calling
+/// `+mtl_arrayMappingTransformerWithTransformer:options:` with no options.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer;
 
 /// A reversible value transformer to transform between the keys and objects of a
@@ -65,6 +106,32 @@ extern NSString * const MTLBooleanValueTransformerName;
 /// with a default value of `nil` and a reverse default value of `nil`.
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_valueMappingTransformerWithDictionary:(NSDictionary<NSString *, id> *)dictionary;
 
+/// A reversible value transformer to transform between strings and integer
+/// enum values.
+///
+/// This behaves like
+/// +mtl_valueMappingTransformerWithDictionary:defaultValue:reverseDefaultValue:,
+/// but is specialized for the common case of mapping JSON strings to an
+/// `NS_ENUM` property. The strings are compiled into a perfect hash up front,
+/// and each enum value is boxed once, so transformations in either direction
+/// neither search the dictionary nor allocate.
+///
+/// dictionary          - The strings and their enum values, boxed as
+///                       NSNumbers. The enum values must be unique. This
+///                       argument must not be nil.
+/// defaultValue        - The enum value to fall back to for unknown strings.
+/// reverseDefaultValue - The string to fall back to for unknown enum values.
+///
+///   NSValueTransformer *valueTransformer = [NSValueTransformer mtl_enumMappingTransformerWithDictionary:@{
+///     @"foo": @(EnumDataTypeFoo),
+///     @"bar": @(EnumDataTypeBar),
+///   } defaultValue:EnumDataTypeUndefined reverseDefaultValue:@"undefined"];
+///
+/// Returns a transformer which will map from strings to boxed enum values for
+/// forward transformations, and from enum values to strings for reverse
+/// transformations.
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_enumMappingTransformerWithDictionary:(NSDictionary<NSString *, NSNumber *> *)dictionary defaultValue:(NSInteger)defaultValue reverseDefaultValue:(nullable NSString *)reverseDefaultValue;
+
 /// A reversible value transformer to transform between a date and its string
 /// representation
 ///
@@ -6,18 +6,336 @@
 //  Copyright (c) 2012 GitHub. All rights reserved.
 //
 
+#import <errno.h>
+
 #import "NSValueTransformer+MTLPredefinedTransformerAdditions.h"
 #import "MTLJSONAdapter.h"
 #import "MTLModel.h"
 #import "MTLValueTransformer.h"
+#import "MTLDataEncoding.h"
+#import "MTLEnumMappingValueTransformer.h"
 
 NSString * const MTLURLValueTransformerName = @"MTLURLValueTransformerName";
 NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerName";
+NSString * const MTLBase64DataValueTransformerName = @"MTLBase64DataValueTransformerName";
+NSString * const MTLBase64URLDataValueTransformerName = @"MTLBase64URLDataValueTransformerName";
+NSString * const MTLHexDataValueTransformerName = @"MTLHexDataValueTransformerName";
 
-@implementation NSValueTransformer (MTLPredefinedTransformerAdditions)
+// Returns the characters of `string` as a byte buffer, without copying them if
+// the string is already stored as ASCII.
+//
+// Non-ASCII strings are returned as UTF-8, which the data decoders will reject.
+static const char *MTLCharactersOfString(NSString *string, size_t *length) {
+	const char *characters = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingASCII);
+	if (characters != NULL) {
+		*length = string.length;
+		return characters;
+	}
+
+	*length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+	return string.UTF8String;
+}
+
+// Returns the error reported when a buffer for the output of a data
+// transformer couldn't be allocated.
+static NSError *MTLDataTransformerOutOfMemoryError(NSString *description, id input) {
+	NSDictionary *userInfo = @{
+		NSLocalizedDescriptionKey: description,
+		NSLocalizedFailureReasonErrorKey: NSLocalizedString(@"Not enough memory was available", @""),
+		MTLTransformerErrorHandlingInputValueErrorKey : input
+	};
+
+	return [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:userInfo];
+}
+
+// Creates a transformer converting strings into NSData and back.
+//
+// encodingName    - The name of the encoding, for use in error messages.
+// decodedLength   - Returns an upper bound for the number of bytes decoded from
+//                   a given number of characters.
+// decode          - Decodes characters into a buffer, returning whether the
+//                   input was valid and the number of bytes written.
+// encodedLength   - Returns the number of characters needed to encode a given
+//                   number of bytes.
+// encode          - Encodes bytes into a buffer, returning the number of
+//                   characters written.
+static MTLValueTransformer *MTLDataTransformer(NSString *encodingName, size_t (^decodedLength)(size_t), BOOL (^decode)(const char *, size_t, uint8_t *, size_t *), size_t (^encodedLength)(size_t), size_t (^encode)(const uint8_t *, size_t, char *)) {
+	return [MTLValueTransformer
+		transformerUsingForwardBlock:^ id (NSString *str, BOOL *success, NSError **error) {
+			if (str == nil) return nil;
+
+			if (![str isKindOfClass:NSString.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert %@ string to data", @""), encodingName],
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSString, got: %@.", @""), str],
+						MTLTransformerErrorHandlingInputValueErrorKey : str
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			size_t length = 0;
+			const char *characters = MTLCharactersOfString(str, &length);
+
+			uint8_t *bytes = malloc(MAX(decodedLength(length), (size_t)1));
+			if (bytes == NULL) {
+				if (error != NULL) *error = MTLDataTransformerOutOfMemoryError([NSString stringWithFormat:NSLocalizedString(@"Could not convert %@ string to data", @""), encodingName], str);
+				*success = NO;
+				return nil;
+			}
+
+			size_t bytesLength = 0;
+
+			if (!decode(characters, length, bytes, &bytesLength)) {
+				free(bytes);
+
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert %@ string to data", @""), encodingName],
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Input string was not valid %@", @""), encodingName],
+						MTLTransformerErrorHandlingInputValueErrorKey : str
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			return [NSData dataWithBytesNoCopy:bytes length:bytesLength freeWhenDone:YES];
+		}
+		reverseBlock:^ id (NSData *data, BOOL *success, NSError **error) {
+			if (data == nil) return nil;
+
+			if (![data isKindOfClass:NSData.class]) {
+				if (error != NULL) {
+					NSDictionary *userInfo = @{
+						NSLocalizedDescriptionKey: [NSString stringWithFormat:NSLocalizedString(@"Could not convert data to %@ string", @""), encodingName],
+						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSData, got: %@.", @""), data],
+						MTLTransformerErrorHandlingInputValueErrorKey : data
+					};
+
+					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+				}
+				*success = NO;
+				return nil;
+			}
+
+			size_t length = encodedLength(data.length);
+			if (length == 0) return @"";
+
+			char *characters = malloc(length);
+			if (characters == NULL) {
+				if (error != NULL) *error = MTLDataTransformerOutOfMemoryError([NSString stringWithFormat:NSLocalizedString(@"Could not convert data to %@ string", @""), encodingName], data);
+				*success = NO;
+				return nil;
+			}
+
+			length = encode(data.bytes, data.length, characters);
+
+			return [[NSString alloc] initWithBytesNoCopy:characters length:length encoding:NSASCIIStringEncoding freeWhenDone:YES];
+		}];
+}
+
+// Creates a transformer converting base64 strings of the given alphabet into
+// NSData and back.
+static MTLValueTransformer *MTLBase64DataTransformer(MTLBase64Alphabet alphabet, BOOL padded) {
+	return MTLDataTransformer(@"base64",
+		^(size_t length) {
+			return MTLBase64DecodedLengthUpperBound(length);
+		},
+		^(const char *characters, size_t length, uint8_t *bytes, size_t *bytesLength) {
+			return MTLBase64Decode(characters, length, bytes, alphabet, bytesLength);
+		},
+		^(size_t length) {
+			return MTLBase64EncodedLength(length, padded);
+		},
+		^(const uint8_t *bytes, size_t length, char *characters) {
+			return MTLBase64Encode(bytes, length, characters, alphabet, padded);
+		});
+}
+
+// Arrays with fewer elements than this are never transformed concurrently.
+static const NSUInteger MTLConcurrentArrayMappingMinimumCount = 2048;
+
+// The number of elements transformed by each concurrent work item.
+static const NSUInteger MTLConcurrentArrayMappingChunkLength = 1024;
+
+typedef id (*MTLTransformValueIMP)(id, SEL, id);
+typedef id (*MTLTransformValueWithErrorIMP)(id, SEL, id, BOOL *, NSError **);
+// The capabilities of an element transformer used by
+// +mtl_arrayMappingTransformerWithTransformer:options:, resolved once when the
+// array transformer is created.
+typedef struct {
+	// Retained by the blocks capturing this structure.
+	__unsafe_unretained NSValueTransformer *transformer;
+
+	// The per-element selector, and whether it takes success and error
+	// arguments.
+	SEL selector;
+	IMP implementation;
+	BOOL handlesErrors;
+} MTLArrayElementTransformer;
+
+static MTLArrayElementTransformer MTLArrayElementTransformerMake(NSValueTransformer *transformer, BOOL reverse) {
+	MTLArrayElementTransformer elementTransformer = { .transformer = transformer };
+
+	SEL errorHandlingSelector = reverse ? @selector(reverseTransformedValue:success:error:) : @selector(transformedValue:success:error:);
+	elementTransformer.handlesErrors = [transformer respondsToSelector:errorHandlingSelector];
+
+	if (elementTransformer.handlesErrors) {
+		elementTransformer.selector = errorHandlingSelector;
+	} else {
+		elementTransformer.selector = reverse ? @selector(reverseTransformedValue:) : @selector(transformedValue:);
+	}
+
+	elementTransformer.implementation = [transformer methodForSelector:elementTransformer.selector];
+
+	return elementTransformer;
+}
+
+// Transforms the elements of `values` within `range`.
+//
+// On failure, returns nil and sets `failingIndex` to the index of the failing
+// element within `values`, and `error` (if not NULL) to the error it reported.
+static NSArray *MTLTransformArrayRange(const MTLArrayElementTransformer *elementTransformer, NSArray *values, NSRange range, NSUInteger *failingIndex, NSError **error) {
+	id transformer = elementTransformer->transformer;
+
+	NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:range.length];
+
+	for (NSUInteger index = range.location; index < NSMaxRange(range); index++) {
+		id value = values[index];
+
+		if (value == NSNull.null) {
+			[transformedValues addObject:NSNull.null];
+			continue;
+		}
+
+		id transformedValue = nil;
+		if (elementTransformer->handlesErrors) {
+			BOOL success = YES;
+			transformedValue = ((MTLTransformValueWithErrorIMP)elementTransformer->implementation)(transformer, elementTransformer->selector, value, &success, error);
+
+			if (!success) {
+				*failingIndex = index;
+				return nil;
+			}
+		} else {
+			transformedValue = ((MTLTransformValueIMP)elementTransformer->implementation)(transformer, elementTransformer->selector, value);
+		}
+
+		if (transformedValue == nil) continue;
+
+		[transformedValues addObject:transformedValue];
+	}
+
+	return transformedValues;
+}
+
+// Transforms `values` in chunks on a concurrent queue, reporting the failure
+// with the lowest index like MTLTransformArrayRange().
+static NSArray *MTLTransformArrayConcurrently(const MTLArrayElementTransformer *elementTransformer, NSArray *values, NSUInteger *failingIndex, NSError **error) {
+	NSUInteger count = values.count;
+	NSUInteger chunkCount = (count + MTLConcurrentArrayMappingChunkLength - 1) / MTLConcurrentArrayMappingChunkLength;
+	BOOL wantsError = (error != NULL);
+
+	__strong NSArray **chunkResults = (__strong NSArray **)calloc(chunkCount, sizeof(*chunkResults));
+	__strong NSError **chunkErrors = (__strong NSError **)calloc(chunkCount, sizeof(*chunkErrors));
+	NSUInteger *chunkFailingIndexes = calloc(chunkCount, sizeof(*chunkFailingIndexes));
+
+	dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+		@autoreleasepool {
+			NSRange range = NSMakeRange(chunk * MTLConcurrentArrayMappingChunkLength, 0);
+			range.length = MIN(MTLConcurrentArrayMappingChunkLength, count - range.location);
+
+			NSError * __autoreleasing chunkError = nil;
+			chunkResults[chunk] = MTLTransformArrayRange(elementTransformer, values, range, &chunkFailingIndexes[chunk], wantsError ? &chunkError : NULL);
+			chunkErrors[chunk] = chunkError;
+		}
+	});
+
+	NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+		if (chunkResults[chunk] == nil) {
+			*failingIndex = chunkFailingIndexes[chunk];
+			if (error != NULL) *error = chunkErrors[chunk];
+
+			transformedValues = nil;
+			break;
+		}
+
+		[transformedValues addObjectsFromArray:chunkResults[chunk]];
+	}
+
+	for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+		chunkResults[chunk] = nil;
+		chunkErrors[chunk] = nil;
+	}
+
+	free(chunkResults);
+	free(chunkErrors);
+	free(chunkFailingIndexes);
+
+	return transformedValues;
+}
+
+// The implementation of both directions of
+// +mtl_arrayMappingTransformerWithTransformer:options:.
+static NSArray *MTLTransformArray(const MTLArrayElementTransformer *elementTransformer, BOOL concurrent, NSArray *values, BOOL *success, NSError **error) {
+	if (values == nil) return nil;
+
+	if (![values isKindOfClass:NSArray.class]) {
+		if (error != NULL) {
+			NSDictionary *userInfo = @{
+				NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform non-array type", @""),
+				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), values],
+				MTLTransformerErrorHandlingInputValueErrorKey: values
+			};
+
+			*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+		}
+		*success = NO;
+		return nil;
+	}
+
+	NSUInteger failingIndex = NSNotFound;
+	NSError * __autoreleasing underlyingError = nil;
+	NSError * __autoreleasing *underlyingErrorPointer = (error != NULL ? &underlyingError : NULL);
+
+	NSArray *transformedValues = nil;
+	if (concurrent && values.count >= MTLConcurrentArrayMappingMinimumCount) {
+		transformedValues = MTLTransformArrayConcurrently(elementTransformer, values, &failingIndex, underlyingErrorPointer);
+	} else {
+		transformedValues = MTLTransformArrayRange(elementTransformer, values, NSMakeRange(0, values.count), &failingIndex, underlyingErrorPointer);
+	}
+
+	if (transformedValues == nil) {
+		if (error != NULL) {
+			NSMutableDictionary *userInfo = [@{
+				NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform array", @""),
+				NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Could not transform value at index %lu", @""), (unsigned long)failingIndex],
+				MTLTransformerErrorHandlingInputValueErrorKey: values
+			} mutableCopy];
+
+			if (underlyingError != nil) userInfo[NSUnderlyingErrorKey] = underlyingError;
+
+			*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
+		}
+		*success = NO;
+		return nil;
+	}
+
+	return transformedValues;
+}
 
 #pragma mark Category Loading
 
+@implementation NSValueTransformer (MTLPredefinedTransformerAdditions)
+
 + (void)load {
 	@autoreleasepool {
 		MTLValueTransformer *URLValueTransformer = [MTLValueTransformer
@@ -98,134 +416,61 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 			}];
 
 		[NSValueTransformer setValueTransformer:booleanValueTransformer forName:MTLBooleanValueTransformerName];
+
+		[NSValueTransformer setValueTransformer:MTLBase64DataTransformer(MTLBase64AlphabetStandard, YES) forName:MTLBase64DataValueTransformerName];
+		[NSValueTransformer setValueTransformer:MTLBase64DataTransformer(MTLBase64AlphabetURLSafe, NO) forName:MTLBase64URLDataValueTransformerName];
+
+		MTLValueTransformer *hexDataValueTransformer = MTLDataTransformer(@"hexadecimal",
+			^(size_t length) {
+				return length / 2;
+			},
+			^(const char *characters, size_t length, uint8_t *bytes, size_t *bytesLength) {
+				*bytesLength = length / 2;
+				return MTLHexDecode(characters, length, bytes);
+			},
+			^(size_t length) {
+				return length * 2;
+			},
+			^(const uint8_t *bytes, size_t length, char *characters) {
+				MTLHexEncode(bytes, length, characters);
+				return length * 2;
+			});
+
+		[NSValueTransformer setValueTransformer:hexDataValueTransformer forName:MTLHexDataValueTransformerName];
 	}
 }
 
 #pragma mark Customizable Transformers
 
-+ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer {
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer options:(MTLArrayMappingOptions)options {
 	NSParameterAssert(transformer != nil);
-	
+
+	BOOL concurrent = (options & MTLArrayMappingOptionsConcurrent) != 0;
+
+	MTLArrayElementTransformer forwardElementTransformer = MTLArrayElementTransformerMake(transformer, NO);
 	id (^forwardBlock)(NSArray *values, BOOL *success, NSError **error) = ^ id (NSArray *values, BOOL *success, NSError **error) {
-		if (values == nil) return nil;
-		
-		if (![values isKindOfClass:NSArray.class]) {
-			if (error != NULL) {
-				NSDictionary *userInfo = @{
-					NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform non-array type", @""),
-					NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), values],
-					MTLTransformerErrorHandlingInputValueErrorKey: values
-				};
-				
-				*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-			}
-			*success = NO;
-			return nil;
-		}
-		
-		NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:values.count];
-		NSInteger index = -1;
-		for (id value in values) {
-			index++;
-			if (value == NSNull.null) {
-				[transformedValues addObject:NSNull.null];
-				continue;
-			}
-			
-			id transformedValue = nil;
-			if ([transformer conformsToProtocol:@protocol(MTLTransformerErrorHandling)]) {
-				NSError *underlyingError = nil;
-				transformedValue = [(id<MTLTransformerErrorHandling>)transformer transformedValue:value success:success error:&underlyingError];
-				
-				if (*success == NO) {
-					if (error != NULL) {
-						NSDictionary *userInfo = @{
-							NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform array", @""),
-							NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Could not transform value at index %d", @""), index],
-							NSUnderlyingErrorKey: underlyingError,
-							MTLTransformerErrorHandlingInputValueErrorKey: values
-						};
+		// Keeps the element transformer alive for as long as the block.
+		(void)transformer;
 
-						*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-					}
-					return nil;
-				}
-			} else {
-				transformedValue = [transformer transformedValue:value];
-			}
-			
-			if (transformedValue == nil) continue;
-			
-			[transformedValues addObject:transformedValue];
-		}
-		
-		return transformedValues;
+		return MTLTransformArray(&forwardElementTransformer, concurrent, values, success, error);
 	};
-	
-	id (^reverseBlock)(NSArray *values, BOOL *success, NSError **error) = nil;
-	if (transformer.class.allowsReverseTransformation) {
-		reverseBlock = ^ id (NSArray *values, BOOL *success, NSError **error) {
-			if (values == nil) return nil;
-			
-			if (![values isKindOfClass:NSArray.class]) {
-				if (error != NULL) {
-					NSDictionary *userInfo = @{
-						NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform non-array type", @""),
-						NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Expected an NSArray, got: %@.", @""), values],
-						MTLTransformerErrorHandlingInputValueErrorKey: values
-					};
 
-					*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-				}
-				*success = NO;
-				return nil;
-			}
-			
-			NSMutableArray *transformedValues = [NSMutableArray arrayWithCapacity:values.count];
-			NSInteger index = -1;
-			for (id value in values) {
-				index++;
-				if (value == NSNull.null) {
-					[transformedValues addObject:NSNull.null];
-
-					continue;
-				}
-				
-				id transformedValue = nil;
-				if ([transformer respondsToSelector:@selector(reverseTransformedValue:success:error:)]) {
-					NSError *underlyingError = nil;
-					transformedValue = [(id<MTLTransformerErrorHandling>)transformer reverseTransformedValue:value success:success error:&underlyingError];
-					
-					if (*success == NO) {
-						if (error != NULL) {
-							NSDictionary *userInfo = @{
-								NSLocalizedDescriptionKey: NSLocalizedString(@"Could not transform array", @""),
-								NSLocalizedFailureReasonErrorKey: [NSString stringWithFormat:NSLocalizedString(@"Could not transform value at index %d", @""), index],
-								NSUnderlyingErrorKey: underlyingError,
-								MTLTransformerErrorHandlingInputValueErrorKey: values
-							};
-							
-							*error = [NSError errorWithDomain:MTLTransformerErrorHandlingErrorDomain code:MTLTransformerErrorHandlingErrorInvalidInput userInfo:userInfo];
-						}
-						return nil;
-					}
-				} else {
-					transformedValue = [transformer reverseTransformedValue:value];
-				}
-				
-				if (transformedValue == nil) continue;
-				
-				[transformedValues addObject:transformedValue];
-			}
-			
-			return transformedValues;
-		};
-	}
-	if (reverseBlock != nil) {
-		return [MTLValueTransformer transformerUsingForwardBlock:forwardBlock reverseBlock:reverseBlock];
-	} else {
+	if (!transformer.class.allowsReverseTransformation) {
 		return [MTLValueTransformer transformerUsingForwardBlock:forwardBlock];
 	}
+
+	MTLArrayElementTransformer reverseElementTransformer = MTLArrayElementTransformerMake(transformer, YES);
+	id (^reverseBlock)(NSArray *values, BOOL *success, NSError **error) = ^ id (NSArray *values, BOOL *success, NSError **error) {
+		(void)transformer;
+
+		return MTLTransformArray(&reverseElementTransformer, concurrent, values, success, error);
+	};
+
+	return [MTLValueTransformer transformerUsingForwardBlock:forwardBlock reverseBlock:reverseBlock];
+}
+
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_arrayMappingTransformerWithTransformer:(NSValueTransformer *)transformer {
+	return [self mtl_arrayMappingTransformerWithTransformer:transformer options:MTLArrayMappingOptionsNone];
 }
 
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_validatingTransformerForClass:(Class)modelClass {
@@ -254,11 +499,32 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 	NSParameterAssert(dictionary != nil);
 	NSParameterAssert(dictionary.count == [[NSSet setWithArray:dictionary.allValues] count]);
 
+	// Invert the dictionary once up front, so that reverse transformations
+	// don't have to search it. Values that can't be used as dictionary keys
+	// fall back to a linear search.
+	NSDictionary *keysByValue = nil;
+
+	BOOL valuesAreCopyable = YES;
+	for (id value in dictionary.objectEnumerator) {
+		if (![value conformsToProtocol:@protocol(NSCopying)]) {
+			valuesAreCopyable = NO;
+			break;
+		}
+	}
+
+	if (valuesAreCopyable) {
+		keysByValue = [NSDictionary dictionaryWithObjects:dictionary.allKeys forKeys:[dictionary objectsForKeys:dictionary.allKeys notFoundMarker:NSNull.null]];
+	}
+
 	return [MTLValueTransformer
 			transformerUsingForwardBlock:^ id (id <NSCopying> key, BOOL *success, NSError **error) {
 				return dictionary[key ?: NSNull.null] ?: defaultValue;
 			}
 			reverseBlock:^ id (id value, BOOL *success, NSError **error) {
+				if (value == nil) return reverseDefaultValue;
+
+				if (keysByValue != nil) return keysByValue[value] ?: reverseDefaultValue;
+
 				__block id result = nil;
 				[dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id anObject, BOOL *stop) {
 					if ([value isEqual:anObject]) {
@@ -275,6 +541,10 @@ NSString * const MTLBooleanValueTransformerName = @"MTLBooleanValueTransformerNa
 	return [self mtl_valueMappingTransformerWithDictionary:dictionary defaultValue:nil reverseDefaultValue:nil];
 }
 
++ (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_enumMappingTransformerWithDictionary:(NSDictionary *)dictionary defaultValue:(NSInteger)defaultValue reverseDefaultValue:(NSString *)reverseDefaultValue {
+	return [[MTLEnumMappingValueTransformer alloc] initWithDictionary:dictionary defaultValue:defaultValue reverseDefaultValue:reverseDefaultValue];
+}
+
 + (NSValueTransformer<MTLTransformerErrorHandling> *)mtl_dateTransformerWithDateFormat:(NSString *)dateFormat calendar:(NSCalendar *)calendar locale:(NSLocale *)locale timeZone:(NSTimeZone *)timeZone defaultDate:(NSDate *)defaultDate {
 	NSParameterAssert(dateFormat.length);
 
@@ -0,0 +1,180 @@
+//
+//  MTLAllocationBudgetSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLAllocationCounter.h"
+#import "MTLTestModel.h"
+
+// How many times each operation is counted, keeping the fewest allocations.
+static const NSUInteger MTLAllocationRuns = 5;
+
+// Each budget is the allocations of a baseline doing the unavoidable part of
+// the work, measured in the same run, plus a margin for what Mantle adds on
+// top. Measuring the baseline alongside keeps the budgets tight across
+// Foundation versions. A failing budget reports the measured count, so lower a
+// margin when an optimization lands, and only raise it with a good reason.
+
+// The adapter's key path components for "nested.name", the transformed count,
+// and the value dictionary, on top of initializing the model from it.
+static const NSUInteger MTLDecodeAllocationMargin = 8;
+static const NSUInteger MTLDecodeByteMargin = 512;
+
+// The set of keys to serialize and the nested dictionary for "nested.name", on
+// top of the model's dictionary value and a mutable JSON dictionary.
+static const NSUInteger MTLEncodeAllocationMargin = 8;
+static const NSUInteger MTLEncodeByteMargin = 512;
+
+// Nothing on top of allocating the copy, since immutable values are shared
+// rather than copied.
+static const NSUInteger MTLCopyAllocationMargin = 0;
+static const NSUInteger MTLCopyByteMargin = 0;
+
+// Properties are compared through their getters, without boxing.
+static const NSUInteger MTLEqualityAllocationMargin = 0;
+static const NSUInteger MTLEqualityByteMargin = 0;
+
+// The model's class name and version, on top of archiving its dictionary
+// value.
+static const NSUInteger MTLCodingAllocationMargin = 32;
+static const NSUInteger MTLCodingByteMargin = 2 * 1024;
+
+// Expects `counts` to be within `margin` allocations and `byteMargin` bytes of
+// `baseline`.
+static void MTLExpectWithinBudget(MTLAllocationCounts counts, MTLAllocationCounts baseline, NSUInteger margin, NSUInteger byteMargin) {
+	expect(@(counts.count)).to(beLessThanOrEqualTo(@(baseline.count + margin)));
+	expect(@(counts.bytes)).to(beLessThanOrEqualTo(@(baseline.bytes + byteMargin)));
+}
+
+QuickSpecBegin(MTLAllocationBudgetSpec)
+
+if (!MTLCanCountAllocations()) {
+	pending(@"allocation budgets, since allocations can't be counted on this platform", ^{});
+	return;
+}
+
+__block MTLTestModel *model;
+__block NSDictionary *JSONDictionary;
+
+beforeEach(^{
+	JSONDictionary = @{
+		@"username": @"foo",
+		@"count": @"5",
+		@"nested": @{ @"name": @"bar" },
+	};
+
+	model = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:JSONDictionary error:NULL];
+	expect(model).notTo(beNil());
+});
+
+it(@"should count allocations", ^{
+	MTLAllocationCounts noCounts = MTLCountAllocations(MTLAllocationRuns, ^{});
+	expect(@(noCounts.count)).to(equal(@0));
+	expect(@(noCounts.bytes)).to(equal(@0));
+
+	MTLAllocationCounts dataCounts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[NSMutableData dataWithLength:4096];
+	});
+
+	expect(@(dataCounts.count)).to(beGreaterThanOrEqualTo(@1));
+	expect(@(dataCounts.bytes)).to(beGreaterThanOrEqualTo(@4096));
+});
+
+it(@"should decode a model within budget", ^{
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+	NSDictionary *dictionaryValue = model.dictionaryValue;
+
+	MTLAllocationCounts baseline = MTLCountAllocations(MTLAllocationRuns, ^{
+		(void)[[MTLTestModel alloc] initWithDictionary:dictionaryValue error:NULL];
+	});
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[adapter modelFromJSONDictionary:JSONDictionary error:NULL];
+	});
+
+	MTLExpectWithinBudget(counts, baseline, MTLDecodeAllocationMargin, MTLDecodeByteMargin);
+});
+
+it(@"should decode a class cluster within budget", ^{
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLClassClusterModel.class];
+	NSDictionary *chocolateDictionary = @{
+		@"flavor": @"chocolate",
+		@"chocolate_bitterness": @"100",
+	};
+
+	MTLChocolateClassClusterModel *chocolate = [adapter modelFromJSONDictionary:chocolateDictionary error:NULL];
+	expect(chocolate).notTo(beNil());
+
+	NSDictionary *dictionaryValue = chocolate.dictionaryValue;
+
+	MTLAllocationCounts baseline = MTLCountAllocations(MTLAllocationRuns, ^{
+		(void)[[MTLChocolateClassClusterModel alloc] initWithDictionary:dictionaryValue error:NULL];
+	});
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[adapter modelFromJSONDictionary:chocolateDictionary error:NULL];
+	});
+
+	MTLExpectWithinBudget(counts, baseline, MTLDecodeAllocationMargin, MTLDecodeByteMargin);
+});
+
+it(@"should encode a model within budget", ^{
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+	MTLAllocationCounts baseline = MTLCountAllocations(MTLAllocationRuns, ^{
+		[model.dictionaryValue mutableCopy];
+	});
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[adapter JSONDictionaryFromModel:model error:NULL];
+	});
+
+	MTLExpectWithinBudget(counts, baseline, MTLEncodeAllocationMargin, MTLEncodeByteMargin);
+});
+
+it(@"should copy a model within budget", ^{
+	MTLAllocationCounts baseline = MTLCountAllocations(MTLAllocationRuns, ^{
+		(void)[MTLTestModel alloc];
+	});
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[model copy];
+	});
+
+	MTLExpectWithinBudget(counts, baseline, MTLCopyAllocationMargin, MTLCopyByteMargin);
+});
+
+it(@"should compare models within budget", ^{
+	MTLTestModel *equalModel = [model copy];
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		[model isEqual:equalModel];
+	});
+
+	MTLExpectWithinBudget(counts, (MTLAllocationCounts){ 0, 0 }, MTLEqualityAllocationMargin, MTLEqualityByteMargin);
+});
+
+it(@"should round trip through NSCoding within budget", ^{
+	NSDictionary *dictionaryValue = model.dictionaryValue;
+
+	MTLAllocationCounts baseline = MTLCountAllocations(MTLAllocationRuns, ^{
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:dictionaryValue];
+		[NSKeyedUnarchiver unarchiveObjectWithData:data];
+	});
+
+	MTLAllocationCounts counts = MTLCountAllocations(MTLAllocationRuns, ^{
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:model];
+		[NSKeyedUnarchiver unarchiveObjectWithData:data];
+	});
+
+	MTLExpectWithinBudget(counts, baseline, MTLCodingAllocationMargin, MTLCodingByteMargin);
+});
+
+QuickSpecEnd
@@ -0,0 +1,34 @@
+//
+//  MTLAllocationCounter.h
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+// The heap allocations made while running a block.
+typedef struct {
+	NSUInteger count;
+	NSUInteger bytes;
+} MTLAllocationCounts;
+
+// Whether allocations can be counted on this platform.
+//
+// Allocations are counted through libmalloc's `malloc_logger` hook, which is
+// meant for malloc stack logging. It isn't documented or declared in any
+// public header, so it may change or go away in any OS release, and doesn't
+// exist outside of Apple platforms. Specs relying on it should be skipped when
+// this returns NO.
+extern BOOL MTLCanCountAllocations(void);
+
+// Runs `block` once to warm up any caches, then `runs` more times, each in its
+// own autorelease pool, and returns the fewest allocations made by the current
+// thread during a single run.
+//
+// Taking the minimum filters out one-off allocations, such as a hash table
+// growing, so that a budget only fails if every run exceeds it.
+//
+// Returns zeroes if MTLCanCountAllocations() is NO.
+extern MTLAllocationCounts MTLCountAllocations(NSUInteger runs, void (^block)(void));
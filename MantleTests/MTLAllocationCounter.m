@@ -0,0 +1,90 @@
+//
+//  MTLAllocationCounter.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <pthread.h>
+
+#import "MTLAllocationCounter.h"
+
+#if __has_include(<malloc/malloc.h>)
+#define MTL_CAN_COUNT_ALLOCATIONS 1
+#else
+#define MTL_CAN_COUNT_ALLOCATIONS 0
+#endif
+
+#if MTL_CAN_COUNT_ALLOCATIONS
+
+// libmalloc calls this hook, meant for malloc stack logging, for every
+// allocation and deallocation in every zone. It is undocumented, so it's
+// declared here rather than imported.
+typedef void (MTLMallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfFramesToSkip);
+extern MTLMallocLogger *malloc_logger;
+
+// The flags passed as `type` to the malloc logger.
+static const uint32_t MTLMallocLogTypeAllocate = 2;
+static const uint32_t MTLMallocLogTypeDeallocate = 4;
+
+// The thread whose allocations are being counted, and its counts so far.
+//
+// These are only written while no logger is installed, and the logger mustn't
+// allocate, so they're kept in plain statics.
+static pthread_t MTLCountingThread;
+static MTLAllocationCounts MTLCurrentCounts;
+
+static void MTLCountAllocation(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3, uintptr_t result, uint32_t numberOfFramesToSkip) {
+	if ((type & MTLMallocLogTypeAllocate) == 0) return;
+	if (!pthread_equal(pthread_self(), MTLCountingThread)) return;
+
+	// realloc() logs the old pointer in `arg2` and the new size in `arg3`.
+	NSUInteger size = ((type & MTLMallocLogTypeDeallocate) != 0 ? arg3 : arg2);
+
+	MTLCurrentCounts.count++;
+	MTLCurrentCounts.bytes += size;
+}
+
+#endif
+
+BOOL MTLCanCountAllocations(void) {
+	return MTL_CAN_COUNT_ALLOCATIONS;
+}
+
+MTLAllocationCounts MTLCountAllocations(NSUInteger runs, void (^block)(void)) {
+	NSCParameterAssert(runs > 0);
+	NSCParameterAssert(block != nil);
+
+	@autoreleasepool {
+		block();
+	}
+
+	MTLAllocationCounts fewestCounts = { 0, 0 };
+
+#if MTL_CAN_COUNT_ALLOCATIONS
+	NSCAssert(malloc_logger == NULL, @"Allocations are already being counted or logged");
+
+	fewestCounts.count = NSUIntegerMax;
+	fewestCounts.bytes = NSUIntegerMax;
+
+	MTLCountingThread = pthread_self();
+
+	for (NSUInteger i = 0; i < runs; i++) {
+		MTLCurrentCounts = (MTLAllocationCounts){ 0, 0 };
+
+		malloc_logger = MTLCountAllocation;
+
+		@autoreleasepool {
+			block();
+		}
+
+		malloc_logger = NULL;
+
+		fewestCounts.count = MIN(fewestCounts.count, MTLCurrentCounts.count);
+		fewestCounts.bytes = MIN(fewestCounts.bytes, MTLCurrentCounts.bytes);
+	}
+#endif
+
+	return fewestCounts;
+}
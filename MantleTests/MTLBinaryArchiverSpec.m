@@ -0,0 +1,185 @@
+//
+//  MTLBinaryArchiverSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+// Conforms to NSCoding, but not NSSecureCoding.
+@interface MTLInsecureCodingObject : NSObject <NSCoding>
+@end
+
+@implementation MTLInsecureCodingObject
+
+- (instancetype)initWithCoder:(NSCoder *)coder {
+	return [super init];
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder {
+}
+
+@end
+
+QuickSpecBegin(MTLBinaryArchiverSpec)
+
+__block MTLEmptyTestModel *emptyModel;
+__block MTLTestModel *model;
+
+beforeEach(^{
+	MTLTestModel.modelVersion = 1;
+
+	emptyModel = [[MTLEmptyTestModel alloc] init];
+	expect(emptyModel).notTo(beNil());
+
+	NSError *error = nil;
+	model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foobar", @"count": @5 } error:&error];
+	expect(model).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should archive and unarchive a model", ^{
+	NSError *error = nil;
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:model error:&error];
+	expect(data).notTo(beNil());
+	expect(error).to(beNil());
+
+	MTLTestModel *unarchivedModel = [MTLBinaryUnarchiver unarchivedObjectOfClass:MTLTestModel.class fromData:data error:&error];
+	expect(unarchivedModel).to(equal(model));
+	expect(error).to(beNil());
+});
+
+it(@"should be smaller than a keyed archive", ^{
+	NSArray *models = @[ model, [model copy], [model copy] ];
+
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:models error:NULL];
+	expect(@(data.length)).to(beLessThan(@([NSKeyedArchiver archivedDataWithRootObject:models].length)));
+});
+
+it(@"should archive values natively", ^{
+	NSDictionary *values = @{
+		@"string": @"foo",
+		@"integer": @(-42),
+		@"unsigned": @(UINT64_MAX),
+		@"double": @3.5,
+		@"bool": @YES,
+		@"data": [@"bar" dataUsingEncoding:NSUTF8StringEncoding],
+		@"date": [NSDate dateWithTimeIntervalSinceReferenceDate:1000],
+		@"URL": [NSURL URLWithString:@"https://github.com/"],
+		@"array": @[ @1, NSNull.null ],
+		@"set": [NSSet setWithObject:@"baz"],
+		@"decimal": [NSDecimalNumber decimalNumberWithString:@"1.25"]
+	};
+
+	NSSet *classes = [NSSet setWithObjects:NSDictionary.class, NSString.class, NSNumber.class, NSData.class, NSDate.class, NSURL.class, NSArray.class, NSSet.class, NSNull.class, NSDecimalNumber.class, nil];
+
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:values error:NULL];
+	NSDictionary *unarchivedValues = [MTLBinaryUnarchiver unarchivedObjectOfClasses:classes fromData:data error:NULL];
+	expect(unarchivedValues).to(equal(values));
+	expect(unarchivedValues[@"bool"]).to(beIdenticalTo(@YES));
+});
+
+it(@"should archive shared models once", ^{
+	NSArray *models = @[ model, model ];
+
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:models error:NULL];
+	NSArray *unarchivedModels = [MTLBinaryUnarchiver unarchivedObjectOfClasses:[NSSet setWithObjects:NSArray.class, MTLTestModel.class, nil] fromData:data error:NULL];
+
+	expect(@(unarchivedModels.count)).to(equal(@2));
+	expect(unarchivedModels[0]).to(equal(model));
+	expect(unarchivedModels[1]).to(beIdenticalTo(unarchivedModels[0]));
+});
+
+it(@"should archive conditional properties if encoded earlier", ^{
+	model.weakModel = emptyModel;
+
+	NSSet *classes = [NSSet setWithObjects:NSArray.class, MTLTestModel.class, MTLEmptyTestModel.class, nil];
+
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:@[ emptyModel, model ] error:NULL];
+	NSArray *objects = [MTLBinaryUnarchiver unarchivedObjectOfClasses:classes fromData:data error:NULL];
+	expect(objects[1]).to(equal(model));
+	expect([objects[1] weakModel]).to(beIdenticalTo(objects[0]));
+
+	data = [MTLBinaryArchiver archivedDataWithRootObject:model error:NULL];
+	MTLTestModel *unarchivedModel = [MTLBinaryUnarchiver unarchivedObjectOfClasses:classes fromData:data error:NULL];
+	expect(unarchivedModel).notTo(beNil());
+	expect(unarchivedModel.weakModel).to(beNil());
+});
+
+it(@"should invoke custom decoding logic", ^{
+	MTLTestModel.modelVersion = 0;
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:model error:NULL];
+
+	MTLTestModel.modelVersion = 1;
+	MTLTestModel *unarchivedModel = [MTLBinaryUnarchiver unarchivedObjectOfClass:MTLTestModel.class fromData:data error:NULL];
+	expect(unarchivedModel.name).to(equal(@"M: foobar"));
+	expect(@(unarchivedModel.count)).to(equal(@5));
+});
+
+it(@"should not unarchive models archived by newer versions", ^{
+	MTLTestModel.modelVersion = 2;
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:model error:NULL];
+
+	MTLTestModel.modelVersion = 1;
+
+	NSError *error = nil;
+	expect([MTLBinaryUnarchiver unarchivedObjectOfClass:MTLTestModel.class fromData:data error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLBinaryArchiverErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorModelInitialization)));
+});
+
+it(@"should reject classes which are not allowed", ^{
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:@[ model ] error:NULL];
+
+	NSError *error = nil;
+	expect([MTLBinaryUnarchiver unarchivedObjectOfClass:NSArray.class fromData:data error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLBinaryArchiverErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorDisallowedClass)));
+});
+
+it(@"should reject truncated archives", ^{
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:model error:NULL];
+
+	for (NSUInteger length = 0; length < data.length; length++) {
+		NSError *error = nil;
+		expect([MTLBinaryUnarchiver unarchivedObjectOfClass:MTLTestModel.class fromData:[data subdataWithRange:NSMakeRange(0, length)] error:&error]).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorInvalidArchive)));
+	}
+});
+
+it(@"should reject trailing bytes", ^{
+	NSMutableData *data = [[MTLBinaryArchiver archivedDataWithRootObject:model error:NULL] mutableCopy];
+	[data appendBytes:"\0" length:1];
+
+	NSError *error = nil;
+	expect([MTLBinaryUnarchiver unarchivedObjectOfClass:MTLTestModel.class fromData:data error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLBinaryArchiverErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorInvalidArchive)));
+});
+
+it(@"should fail to archive objects not conforming to NSCoding", ^{
+	NSError *error = nil;
+	expect([MTLBinaryArchiver archivedDataWithRootObject:@[ [[NSObject alloc] init] ] error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLBinaryArchiverErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorUnsupportedValue)));
+});
+
+it(@"should fail to archive objects not supporting NSSecureCoding", ^{
+	NSError *error = nil;
+	expect([MTLBinaryArchiver archivedDataWithRootObject:@[ [[MTLInsecureCodingObject alloc] init] ] error:&error]).to(beNil());
+	expect(error.domain).to(equal(MTLBinaryArchiverErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLBinaryArchiverErrorUnsupportedValue)));
+
+	NSValue *value = [NSValue valueWithRange:NSMakeRange(1, 2)];
+	NSData *data = [MTLBinaryArchiver archivedDataWithRootObject:@[ value ] error:&error];
+	expect(data).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+QuickSpecEnd
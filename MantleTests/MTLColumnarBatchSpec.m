@@ -0,0 +1,103 @@
+//
+//  MTLColumnarBatchSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLColumnarBatchSpec)
+
+__block NSArray *JSONArray;
+
+beforeEach(^{
+	JSONArray = @[
+		@{ @"username": @"foo", @"count": @"2" },
+		@{ @"username": @"bar", @"count": @"7" },
+		@{ @"count": @"4" },
+		@{ @"username": @"foo", @"count": @"1" },
+	];
+});
+
+it(@"should store properties of models in columns", ^{
+	NSArray *models = [MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL];
+	expect(models).notTo(beNil());
+
+	NSError *error = nil;
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:models ofClass:MTLTestModel.class propertyKeys:@[ @"count", @"name" ] error:&error];
+	expect(batch).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(@(batch.count)).to(equal(@4));
+	expect(@(batch.columns.count)).to(equal(@2));
+
+	MTLColumn *counts = [batch columnForPropertyKey:@"count"];
+	expect(@(counts.type)).to(equal(@(MTLColumnTypeInt64)));
+	expect(@(counts.nullCount)).to(equal(@0));
+	expect(@(counts.int64Values[1])).to(equal(@7));
+	expect(@([counts doubleValueAtIndex:2])).to(equal(@4));
+
+	MTLColumn *names = [batch columnForPropertyKey:@"name"];
+	expect(@(names.type)).to(equal(@(MTLColumnTypeString)));
+	expect(@(names.nullCount)).to(equal(@1));
+	expect(names.stringDictionary).to(equal(@[ @"foo", @"bar" ]));
+	expect([names stringAtIndex:1]).to(equal(@"bar"));
+	expect([names stringAtIndex:2]).to(beNil());
+	expect(@([names isValidAtIndex:2])).to(beFalsy());
+	expect(@([names indexesOfString:@"foo"].count)).to(equal(@2));
+});
+
+it(@"should store properties deserialized from JSON", ^{
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+	NSError *error = nil;
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithJSONArray:JSONArray JSONAdapter:adapter propertyKeys:@[ @"name" ] error:&error];
+	expect(batch).notTo(beNil());
+	expect(error).to(beNil());
+
+	MTLColumn *names = [batch columnForPropertyKey:@"name"];
+	expect(@(names.count)).to(equal(@4));
+
+	NSMutableIndexSet *expectedIndexes = [NSMutableIndexSet indexSetWithIndex:0];
+	[expectedIndexes addIndex:3];
+	expect([names indexesOfString:@"foo"]).to(equal(expectedIndexes));
+	expect([names indexesOfString:@"baz"]).to(equal([NSIndexSet indexSet]));
+});
+
+it(@"should compute aggregates of numeric columns", ^{
+	MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithJSONArray:JSONArray JSONAdapter:adapter propertyKeys:@[ @"count" ] error:NULL];
+
+	MTLColumn *counts = [batch columnForPropertyKey:@"count"];
+
+	expect(@(counts.sum)).to(equal(@14));
+
+	double minimum = 0;
+	double maximum = 0;
+	expect(@([counts getMinimum:&minimum maximum:&maximum])).to(beTruthy());
+	expect(@(minimum)).to(equal(@1));
+	expect(@(maximum)).to(equal(@7));
+
+	NSMutableIndexSet *expectedIndexes = [NSMutableIndexSet indexSetWithIndex:0];
+	[expectedIndexes addIndex:2];
+	expect([counts indexesOfValuesBetween:2 and:5]).to(equal(expectedIndexes));
+});
+
+it(@"should fail for unsupported properties", ^{
+	NSError *error = nil;
+	MTLColumnarBatch *batch = [MTLColumnarBatch batchWithModels:@[] ofClass:MTLTestModel.class propertyKeys:@[ @"weakModel" ] error:&error];
+	expect(batch).to(beNil());
+	expect(error.domain).to(equal(MTLColumnarBatchErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLColumnarBatchErrorUnsupportedProperty)));
+
+	batch = [MTLColumnarBatch batchWithModels:@[] ofClass:MTLTestModel.class propertyKeys:@[ @"nonexistent" ] error:&error];
+	expect(batch).to(beNil());
+});
+
+QuickSpecEnd
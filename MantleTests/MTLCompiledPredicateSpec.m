@@ -0,0 +1,130 @@
+//
+//  MTLCompiledPredicateSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLCompiledPredicateSpec)
+
+__block NSArray *models;
+
+beforeEach(^{
+	NSArray *names = @[ @"Alice", @"bob", @"Carol", @"dave", @"Éve" ];
+
+	models = [MTLTestModel modelsWithCount:names.count dictionaryAtIndex:^(NSUInteger i) {
+		return @{ @"name": names[i], @"count": @(i * 2) };
+	}];
+});
+
+MTLCompiledPredicate * (^compile)(NSString *, NSArray *) = ^(NSString *format, NSArray *arguments) {
+	NSError *error = nil;
+	MTLCompiledPredicate *predicate = [MTLCompiledPredicate predicateWithFormat:format argumentArray:arguments modelClass:MTLTestModel.class error:&error];
+	expect(predicate).notTo(beNil());
+	expect(error).to(beNil());
+
+	return predicate;
+};
+
+void (^expectSameResults)(MTLCompiledPredicate *) = ^(MTLCompiledPredicate *predicate) {
+	expect([predicate filteredArrayFromModels:models options:MTLPredicateEvaluationOptionsNone]).to(equal([models filteredArrayUsingPredicate:predicate.predicate]));
+};
+
+it(@"should compile numeric comparisons", ^{
+	MTLCompiledPredicate *predicate = compile(@"count > 2 AND count <= 6", nil);
+	expect(@(predicate.fullyCompiled)).to(beTruthy());
+	expect([predicate indexesOfModelsInArray:models options:MTLPredicateEvaluationOptionsNone]).to(equal([NSIndexSet indexSetWithIndexesInRange:NSMakeRange(2, 2)]));
+
+	expect(@([compile(@"3 < count", nil) evaluateWithModel:models[2]])).to(beTruthy());
+	expect(@([compile(@"count == 4.0", nil) evaluateWithModel:models[2]])).to(beTruthy());
+	expect(@([compile(@"count != 4", nil) evaluateWithModel:models[2]])).to(beFalsy());
+	expect(@([compile(@"count > -1", nil) evaluateWithModel:models[0]])).to(beTruthy());
+});
+
+it(@"should compile string comparisons", ^{
+	NSArray *formats = @[
+		@"name == 'bob'",
+		@"name ==[c] 'BOB'",
+		@"name ==[cd] 'eve'",
+		@"name BEGINSWITH[c] 'c'",
+		@"name ENDSWITH 'ce'",
+		@"name CONTAINS[c] 'A'",
+		@"name < 'C'",
+		@"NOT name IN {'Alice', 'dave'}",
+	];
+
+	for (NSString *format in formats) {
+		MTLCompiledPredicate *predicate = compile(format, nil);
+		expect(@(predicate.fullyCompiled)).to(beTruthy());
+
+		expectSameResults(predicate);
+	}
+});
+
+it(@"should compile IN and BETWEEN", ^{
+	MTLCompiledPredicate *predicate = compile(@"count IN %@ OR count BETWEEN {7, 8}", @[ @[ @0, @4, @5 ] ]);
+	expect(@(predicate.fullyCompiled)).to(beTruthy());
+
+	NSMutableIndexSet *expectedIndexes = [NSMutableIndexSet indexSet];
+	[expectedIndexes addIndex:0];
+	[expectedIndexes addIndex:2];
+	[expectedIndexes addIndex:4];
+	expect([predicate indexesOfModelsInArray:models options:MTLPredicateEvaluationOptionsNone]).to(equal(expectedIndexes));
+});
+
+it(@"should compile constant predicates", ^{
+	expect([compile(@"TRUEPREDICATE", nil) filteredArrayFromModels:models options:MTLPredicateEvaluationOptionsNone]).to(equal(models));
+	expect([compile(@"FALSEPREDICATE", nil) filteredArrayFromModels:models options:MTLPredicateEvaluationOptionsNone]).to(equal(@[]));
+});
+
+it(@"should fall back to NSPredicate for unsupported comparisons", ^{
+	MTLCompiledPredicate *predicate = compile(@"count > 2 AND name MATCHES '[a-z]+'", nil);
+	expect(@(predicate.fullyCompiled)).to(beFalsy());
+
+	expectSameResults(predicate);
+
+	predicate = compile(@"dynamicName.length == 5", nil);
+	expect(@(predicate.fullyCompiled)).to(beFalsy());
+
+	expectSameResults(predicate);
+});
+
+it(@"should fail to compile a predicate with an unknown key", ^{
+	NSError *error = nil;
+	MTLCompiledPredicate *predicate = [MTLCompiledPredicate predicateWithFormat:@"foobar == 1" argumentArray:nil modelClass:MTLTestModel.class error:&error];
+	expect(predicate).to(beNil());
+	expect(error.domain).to(equal(MTLCompiledPredicateErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLCompiledPredicateErrorInvalidPredicate)));
+});
+
+it(@"should fail to compile an invalid format", ^{
+	NSError *error = nil;
+	MTLCompiledPredicate *predicate = [MTLCompiledPredicate predicateWithFormat:@"count >" argumentArray:nil modelClass:MTLTestModel.class error:&error];
+	expect(predicate).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLCompiledPredicateErrorInvalidPredicate)));
+});
+
+it(@"should evaluate large arrays concurrently", ^{
+	NSMutableArray *manyModels = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 10000; i++) {
+		[manyModels addObject:[[MTLTestModel alloc] initWithDictionary:@{ @"count": @(i % 97) } error:NULL]];
+	}
+
+	MTLCompiledPredicate *predicate = compile(@"count BETWEEN {10, 20} OR count == 50", nil);
+
+	NSIndexSet *serialIndexes = [predicate indexesOfModelsInArray:manyModels options:MTLPredicateEvaluationOptionsNone];
+	NSIndexSet *concurrentIndexes = [predicate indexesOfModelsInArray:manyModels options:MTLPredicateEvaluationOptionsConcurrent];
+
+	expect(@(serialIndexes.count)).to(beGreaterThan(@0));
+	expect(concurrentIndexes).to(equal(serialIndexes));
+	expect([manyModels objectsAtIndexes:serialIndexes]).to(equal([manyModels filteredArrayUsingPredicate:predicate.predicate]));
+});
+
+QuickSpecEnd
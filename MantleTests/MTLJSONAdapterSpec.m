@@ -385,6 +385,102 @@ it(@"should serialize different model classes", ^{
 	})));
 });
 
+describe(@"class discriminators", ^{
+	__block MTLJSONAdapter *adapter;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLShapeModel.class];
+		expect(adapter).notTo(beNil());
+	});
+
+	it(@"should parse the class for each discriminator value", ^{
+		NSError *error = nil;
+		MTLCircleShapeModel *circle = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"circle" }, @"name": @"foo", @"radius": @3 } error:&error];
+		expect(circle).to(beAnInstanceOf(MTLCircleShapeModel.class));
+		expect(circle.name).to(equal(@"foo"));
+		expect(@(circle.radius)).to(equal(@3));
+		expect(error).to(beNil());
+
+		MTLSquareShapeModel *square = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @4 }, @"side": @2 } error:&error];
+		expect(square).to(beAnInstanceOf(MTLSquareShapeModel.class));
+		expect(@(square.side)).to(equal(@2));
+		expect(error).to(beNil());
+
+		MTLShapeModel *shape = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"shape" }, @"name": @"bar" } error:&error];
+		expect(shape).to(beAnInstanceOf(MTLShapeModel.class));
+		expect(shape.name).to(equal(@"bar"));
+		expect(error).to(beNil());
+	});
+
+	it(@"should parse arrays of different classes", ^{
+		NSArray *JSONArray = @[
+			@{ @"shape": @{ @"kind": @"circle" }, @"radius": @1 },
+			@{ @"shape": @{ @"kind": @"square" }, @"side": @2 }
+		];
+
+		NSError *error = nil;
+		NSArray *models = [MTLJSONAdapter modelsOfClass:MTLShapeModel.class fromJSONArray:JSONArray error:&error];
+		expect(error).to(beNil());
+		expect(models[0]).to(beAnInstanceOf(MTLCircleShapeModel.class));
+		expect(models[1]).to(beAnInstanceOf(MTLSquareShapeModel.class));
+	});
+
+	it(@"should fall back to +classForParsingJSONDictionary: for unknown values", ^{
+		NSError *error = nil;
+		MTLCircleShapeModel *circle = [adapter modelFromJSONDictionary:@{ @"legacy_radius": @5, @"radius": @5 } error:&error];
+		expect(circle).to(beAnInstanceOf(MTLCircleShapeModel.class));
+		expect(@(circle.radius)).to(equal(@5));
+		expect(error).to(beNil());
+
+		MTLShapeModel *shape = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"hexagon" } } error:&error];
+		expect(shape).to(beNil());
+		expect(error.domain).to(equal(MTLJSONAdapterErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorNoClassFound)));
+	});
+
+	it(@"should serialize discriminated classes", ^{
+		MTLSquareShapeModel *square = [MTLSquareShapeModel modelWithDictionary:@{ @"name": @"foo", @"side": @2 } error:NULL];
+
+		NSError *error = nil;
+		NSDictionary *JSONDictionary = [adapter JSONDictionaryFromModel:square error:&error];
+		expect(error).to(beNil());
+		expect(JSONDictionary).to(equal((@{ @"name": @"foo", @"side": @2 })));
+	});
+
+	it(@"should create adapters for subclasses inheriting the discriminator", ^{
+		NSError *error = nil;
+		MTLCircleShapeModel *circle = [MTLJSONAdapter modelOfClass:MTLCircleShapeModel.class fromJSONDictionary:@{ @"legacy_radius": @3, @"name": @"foo", @"radius": @3 } error:&error];
+		expect(circle).to(beAnInstanceOf(MTLCircleShapeModel.class));
+		expect(@(circle.radius)).to(equal(@3));
+		expect(error).to(beNil());
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:circle error:&error];
+		expect(JSONDictionary).to(equal((@{ @"name": @"foo", @"radius": @3 })));
+		expect(error).to(beNil());
+	});
+
+	it(@"should apply discriminators declared by subclasses", ^{
+		NSError *error = nil;
+		MTLTriangleShapeModel *triangle = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"polygon" }, @"polygon": @{ @"kind": @"triangle" }, @"sides": @3 } error:&error];
+		expect(triangle).to(beAnInstanceOf(MTLTriangleShapeModel.class));
+		expect(@(triangle.sides)).to(equal(@3));
+		expect(error).to(beNil());
+
+		MTLPolygonShapeModel *polygon = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"polygon" }, @"polygon": @{ @"kind": @"polygon" }, @"sides": @5 } error:&error];
+		expect(polygon).to(beAnInstanceOf(MTLPolygonShapeModel.class));
+		expect(@(polygon.sides)).to(equal(@5));
+		expect(error).to(beNil());
+
+		triangle = [adapter modelFromJSONDictionary:@{ @"legacy_sides": @3, @"polygon": @{ @"kind": @"triangle" }, @"sides": @3 } error:&error];
+		expect(triangle).to(beAnInstanceOf(MTLTriangleShapeModel.class));
+		expect(error).to(beNil());
+
+		triangle = [MTLJSONAdapter modelOfClass:MTLPolygonShapeModel.class fromJSONDictionary:@{ @"polygon": @{ @"kind": @"triangle" }, @"sides": @3 } error:&error];
+		expect(triangle).to(beAnInstanceOf(MTLTriangleShapeModel.class));
+		expect(error).to(beNil());
+	});
+});
+
 it(@"should parse model classes not inheriting from MTLModel", ^{
 	NSDictionary *values = @{
 		@"name": @"foo",
@@ -665,4 +761,505 @@ it(@"should not automatically transform a property that conforms to MTLModel but
 	expect(@(error.code)).to(equal(@(MTLTransformerErrorHandlingErrorInvalidInput)));
 });
 
+describe(@"projections", ^{
+	it(@"should only deserialize projected properties", ^{
+		NSDictionary *values = @{
+			@"username": @"foo",
+			@"count": @"5",
+			@"nested": @{ @"name": @"bar" },
+		};
+
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+		MTLJSONProjection *projection = [MTLJSONProjection projectionWithPropertyKeys:[NSSet setWithObjects:@"name", @"count", @"weakModel", nil]];
+
+		NSError *error = nil;
+		MTLTestModel *model = [adapter modelFromJSONDictionary:values projection:projection error:&error];
+		expect(model).to(beAnInstanceOf(MTLTestModel.class));
+		expect(error).to(beNil());
+
+		expect(model.name).to(equal(@"foo"));
+		expect(@(model.count)).to(equal(@5));
+		expect(model.nestedName).to(beNil());
+
+		model = [adapter modelFromJSONDictionary:@{ @"username": @"baz" } projection:projection error:&error];
+		expect(model.name).to(equal(@"baz"));
+		expect(@(model.count)).to(equal(@1));
+	});
+
+	it(@"should not run transformers of other properties", ^{
+		NSDictionary *values = @{
+			@"owner": @{ @"name": @"Cameron" },
+			@"users": @"not an array",
+		};
+
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLRecursiveGroupModel.class];
+
+		NSError *error = nil;
+		MTLRecursiveGroupModel *group = [adapter modelFromJSONDictionary:values propertyKeys:[NSSet setWithObject:@"owner"] error:&error];
+		expect(group).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(group.owner.name).to(equal(@"Cameron"));
+		expect(group.users).to(beNil());
+	});
+
+	it(@"should validate projected properties", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		NSError *error = nil;
+		MTLTestModel *model = [adapter modelFromJSONDictionary:@{ @"username": @"this name is too long" } propertyKeys:[NSSet setWithObject:@"name"] error:&error];
+		expect(model).to(beNil());
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+	});
+
+	it(@"should project dispatched classes", ^{
+		MTLJSONAdapter *adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLShapeModel.class];
+		MTLJSONProjection *projection = [MTLJSONProjection projectionWithPropertyKeys:[NSSet setWithObject:@"radius"]];
+
+		MTLCircleShapeModel *circle = [adapter modelFromJSONDictionary:@{ @"shape": @{ @"kind": @"circle" }, @"name": @"foo", @"radius": @3 } projection:projection error:NULL];
+		expect(circle).to(beAnInstanceOf(MTLCircleShapeModel.class));
+		expect(@(circle.radius)).to(equal(@3));
+		expect(circle.name).to(beNil());
+	});
+});
+
+describe(@"scanning", ^{
+	__block MTLJSONAdapter *adapter;
+	__block NSArray *JSONArray;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		JSONArray = @[
+			@{ @"username": @"foo", @"count": @"2", @"nested": @{ @"name": @"bar" } },
+			@{ @"username": @"baz", @"count": @"3" },
+			@{ @"count": @"4" },
+		];
+	});
+
+	it(@"should reuse one model for every dictionary", ^{
+		NSMutableSet *models = [NSMutableSet set];
+		NSMutableArray *names = [NSMutableArray array];
+		NSMutableArray *nestedNames = [NSMutableArray array];
+		__block NSUInteger total = 0;
+
+		NSError *error = nil;
+		BOOL success = [adapter enumerateModelsFromJSONArray:JSONArray projection:nil error:&error usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			[models addObject:[NSValue valueWithNonretainedObject:model]];
+			[names addObject:model.name ?: NSNull.null];
+			[nestedNames addObject:model.nestedName ?: NSNull.null];
+			total += model.count;
+		}];
+
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(@(models.count)).to(equal(@1));
+		expect(names).to(equal(@[ @"foo", @"baz", NSNull.null ]));
+		expect(nestedNames).to(equal(@[ @"bar", NSNull.null, NSNull.null ]));
+		expect(@(total)).to(equal(@9));
+	});
+
+	it(@"should match models deserialized individually", ^{
+		NSMutableArray *models = [NSMutableArray array];
+
+		[adapter enumerateModelsFromJSONArray:JSONArray projection:nil error:NULL usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			[models addObject:[model copy]];
+		}];
+
+		expect(models).to(equal([MTLJSONAdapter modelsOfClass:MTLTestModel.class fromJSONArray:JSONArray error:NULL]));
+	});
+
+	it(@"should stop", ^{
+		__block NSUInteger count = 0;
+
+		BOOL success = [adapter enumerateModelsFromJSONArray:JSONArray projection:nil error:NULL usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			count++;
+			*stop = YES;
+		}];
+
+		expect(@(success)).to(beTruthy());
+		expect(@(count)).to(equal(@1));
+	});
+
+	it(@"should only deserialize projected properties", ^{
+		MTLJSONProjection *projection = [MTLJSONProjection projectionWithPropertyKeys:[NSSet setWithObject:@"count"]];
+		__block NSUInteger total = 0;
+
+		[adapter enumerateModelsFromJSONArray:JSONArray projection:projection error:NULL usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			expect(model.name).to(beNil());
+			total += model.count;
+		}];
+
+		expect(@(total)).to(equal(@9));
+	});
+
+	it(@"should fail for invalid elements", ^{
+		__block NSUInteger count = 0;
+
+		NSError *error = nil;
+		BOOL success = [adapter enumerateModelsFromJSONArray:@[ @{ @"username": @"foo" }, @"bar" ] projection:nil error:&error usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			count++;
+		}];
+
+		expect(@(success)).to(beFalsy());
+		expect(@(count)).to(equal(@1));
+		expect(@(error.code)).to(equal(@(MTLJSONAdapterErrorInvalidJSONDictionary)));
+
+		success = [adapter enumerateModelsFromJSONArray:@[ @{ @"username": @"this name is too long" } ] projection:nil error:&error usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			count++;
+		}];
+
+		expect(@(success)).to(beFalsy());
+		expect(@(count)).to(equal(@1));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+	});
+
+	it(@"should reset the model when a dictionary fails", ^{
+		__block MTLTestModel *reusedModel = nil;
+
+		BOOL success = [adapter enumerateModelsFromJSONArray:@[ @{ @"username": @"foo", @"count": @"2" }, @{ @"count": @"3", @"username": @"this name is too long" } ] projection:nil error:NULL usingBlock:^(MTLTestModel *model, NSUInteger index, BOOL *stop) {
+			reusedModel = model;
+		}];
+
+		expect(@(success)).to(beFalsy());
+		expect(reusedModel.name).to(beNil());
+		expect(@(reusedModel.count)).to(equal(@1));
+		expect(reusedModel.nestedName).to(beNil());
+	});
+});
+
+describe(@"lazy models", ^{
+	it(@"should transform properties on first access", ^{
+		NSDictionary *values = @{
+			@"username": @"foo",
+			@"count": @"5",
+			@"nested": @{ @"name": @"bar" },
+		};
+
+		NSError *error = nil;
+		MTLTestModel *model = [MTLJSONAdapter lazyModelOfClass:MTLTestModel.class fromJSONDictionary:values error:&error];
+		expect(model).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(model).to(beAKindOf(MTLTestModel.class));
+		expect(model.class).to(equal(MTLTestModel.class));
+		expect(@([MTLJSONAdapter isLazyModelFault:model])).to(beTruthy());
+
+		// Primitive properties are transformed immediately.
+		expect(@(model.count)).to(equal(@5));
+
+		expect(model.name).to(equal(@"foo"));
+		expect(@([MTLJSONAdapter isLazyModelFault:model])).to(beTruthy());
+
+		expect(model.nestedName).to(equal(@"bar"));
+		expect(@([MTLJSONAdapter isLazyModelFault:model])).to(beFalsy());
+
+		MTLTestModel *eagerModel = [MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL];
+		expect(model).to(equal(eagerModel));
+		expect(eagerModel).to(equal(model));
+	});
+
+	it(@"should defer nested models", ^{
+		NSDictionary *values = @{
+			@"owner": @{ @"name": @"Cameron", @"groups": @[] },
+			@"users": @[ @{ @"name": @"Dimitri" } ],
+		};
+
+		MTLRecursiveGroupModel *group = [MTLJSONAdapter lazyModelOfClass:MTLRecursiveGroupModel.class fromJSONDictionary:values error:NULL];
+		expect(group).notTo(beNil());
+
+		expect(group.owner).to(beAKindOf(MTLRecursiveUserModel.class));
+		expect(group.owner.name).to(equal(@"Cameron"));
+		expect(@([MTLJSONAdapter isLazyModelFault:group])).to(beTruthy());
+
+		expect([group.users.firstObject name]).to(equal(@"Dimitri"));
+		expect(@([MTLJSONAdapter isLazyModelFault:group])).to(beFalsy());
+	});
+
+	it(@"should not overwrite properties set before they're read", ^{
+		MTLTestModel *model = [MTLJSONAdapter lazyModelOfClass:MTLTestModel.class fromJSONDictionary:@{ @"username": @"foo" } error:NULL];
+
+		model.name = @"bar";
+		expect(model.name).to(equal(@"bar"));
+
+		[model setValue:@"baz" forKey:@"nestedName"];
+		expect(model.nestedName).to(equal(@"baz"));
+	});
+
+	it(@"should materialize every property", ^{
+		MTLTestModel *model = [MTLJSONAdapter lazyModelOfClass:MTLTestModel.class fromJSONDictionary:@{ @"username": @"foo", @"nested": @{ @"name": @"bar" } } error:NULL];
+
+		NSError *error = nil;
+		expect(@([MTLJSONAdapter materializeLazyModel:model error:&error])).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(@([MTLJSONAdapter isLazyModelFault:model])).to(beFalsy());
+		expect(model.name).to(equal(@"foo"));
+		expect(model.nestedName).to(equal(@"bar"));
+	});
+
+	it(@"should report errors when materializing", ^{
+		MTLTestModel *model = [MTLJSONAdapter lazyModelOfClass:MTLTestModel.class fromJSONDictionary:@{ @"username": @"this name is too long" } error:NULL];
+		expect(model).notTo(beNil());
+
+		expect(model.name).to(beNil());
+
+		NSError *error = nil;
+		expect(@([MTLJSONAdapter materializeLazyModel:model error:&error])).to(beFalsy());
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+	});
+
+	it(@"should dispatch to class discriminators", ^{
+		MTLShapeModel *shape = [MTLJSONAdapter lazyModelOfClass:MTLShapeModel.class fromJSONDictionary:@{ @"shape": @{ @"kind": @"circle" }, @"radius": @3 } error:NULL];
+
+		expect(shape.class).to(equal(MTLCircleShapeModel.class));
+		expect(@([(MTLCircleShapeModel *)shape radius])).to(equal(@3));
+	});
+});
+
+describe(@"cached JSON dictionaries", ^{
+	__block MTLCachingJSONTestModel *model;
+
+	beforeEach(^{
+		model = [MTLCachingJSONTestModel modelWithDictionary:@{ @"name": @"foo", @"count": @5 } error:NULL];
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should return the cached dictionary", ^{
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{ @"username": @"foo", @"count": @"5", @"nested": @{ @"name": NSNull.null } }));
+
+		expect([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]).to(beIdenticalTo(JSONDictionary));
+		expect([MTLJSONAdapter JSONDictionaryFromModel:[model copy] error:NULL]).to(beIdenticalTo(JSONDictionary));
+	});
+
+	it(@"should cache immutable nested dictionaries", ^{
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+
+		expect(JSONDictionary[@"nested"]).to(equal(@{ @"name": NSNull.null }));
+		expect(JSONDictionary[@"nested"]).notTo(beAKindOf(NSMutableDictionary.class));
+	});
+
+	it(@"should discard the cache when a property is set", ^{
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+
+		model.count = 6;
+		NSDictionary *updatedDictionary = [MTLJSONAdapter JSONDictionaryFromModel:model error:NULL];
+		expect(updatedDictionary).notTo(beIdenticalTo(JSONDictionary));
+		expect(updatedDictionary[@"count"]).to(equal(@"6"));
+
+		[model setValue:@"bar" forKey:@"name"];
+		expect([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL][@"username"]).to(equal(@"bar"));
+	});
+
+	it(@"should reuse the cached dictionaries of nested models", ^{
+		MTLPropertyDefaultAdapterModel *outerModel = [[MTLPropertyDefaultAdapterModel alloc] init];
+		outerModel.conformingMTLJSONSerializingProperty = model;
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:outerModel error:NULL];
+		expect(JSONDictionary[@"conformingMTLJSONSerializingProperty"]).to(beIdenticalTo([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]));
+	});
+
+	it(@"should share the cached dictionaries of nested models when caching", ^{
+		MTLCachingPropertyDefaultAdapterModel *outerModel = [[MTLCachingPropertyDefaultAdapterModel alloc] init];
+		outerModel.conformingMTLJSONSerializingProperty = model;
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromModel:outerModel error:NULL];
+		expect([MTLJSONAdapter JSONDictionaryFromModel:outerModel error:NULL]).to(beIdenticalTo(JSONDictionary));
+		expect(JSONDictionary[@"conformingMTLJSONSerializingProperty"]).to(beIdenticalTo([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]));
+	});
+});
+
+describe(@"patching", ^{
+	__block MTLJSONAdapter *adapter;
+	__block MTLTestModel *model;
+
+	beforeEach(^{
+		adapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLTestModel.class];
+
+		NSDictionary *values = @{
+			@"username": @"foo",
+			@"count": @"5",
+			@"nested": @{ @"name": @"bar" },
+		};
+
+		model = [adapter modelFromJSONDictionary:values error:NULL];
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should only update properties present in the dictionary", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"count": @"7" } options:MTLJSONPatchOptionsNone error:&error];
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		expect(@(model.count)).to(equal(@7));
+		expect(model.name).to(equal(@"foo"));
+		expect(model.nestedName).to(equal(@"bar"));
+	});
+
+	it(@"should update properties mapped to nested key paths", ^{
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"nested": @{ @"name": @"baz" } } options:MTLJSONPatchOptionsNone error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(model.nestedName).to(equal(@"baz"));
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should leave the model unchanged if validation fails", ^{
+		NSError *error = nil;
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"username": @"this is too long a name", @"count": @"9" } options:MTLJSONPatchOptionsNone error:&error];
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+
+		expect(model.name).to(equal(@"foo"));
+		expect(@(model.count)).to(equal(@5));
+	});
+
+	it(@"should update a copy", ^{
+		MTLTestModel *updatedModel = [adapter modelByUpdatingModel:model fromJSONDictionary:@{ @"username": @"baz" } options:MTLJSONPatchOptionsNone error:NULL];
+		expect(updatedModel).notTo(beIdenticalTo(model));
+		expect(updatedModel.name).to(equal(@"baz"));
+		expect(@(updatedModel.count)).to(equal(@5));
+
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should transform null values without merge patch semantics", ^{
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"username": NSNull.null, @"count": NSNull.null } options:MTLJSONPatchOptionsNone error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(model.name).to(beNil());
+		expect(@(model.count)).to(equal(@0));
+	});
+
+	it(@"should restore default values for removed members of merge patches", ^{
+		BOOL success = [adapter updateModel:model fromJSONDictionary:@{ @"count": NSNull.null, @"nested": NSNull.null } options:MTLJSONPatchOptionsMergePatch error:NULL];
+		expect(@(success)).to(beTruthy());
+
+		expect(@(model.count)).to(equal(@1));
+		expect(model.nestedName).to(beNil());
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should merge nested models for merge patches", ^{
+		MTLPropertyDefaultAdapterModel *outerModel = [[MTLPropertyDefaultAdapterModel alloc] init];
+		outerModel.conformingMTLJSONSerializingProperty = model;
+
+		MTLJSONAdapter *outerAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLPropertyDefaultAdapterModel.class];
+		NSDictionary *patch = @{ @"conformingMTLJSONSerializingProperty": @{ @"count": @"6" } };
+
+		MTLPropertyDefaultAdapterModel *mergedModel = [outerAdapter modelByUpdatingModel:outerModel fromJSONDictionary:patch options:MTLJSONPatchOptionsMergePatch error:NULL];
+		expect(mergedModel.conformingMTLJSONSerializingProperty.name).to(equal(@"foo"));
+		expect(@(mergedModel.conformingMTLJSONSerializingProperty.count)).to(equal(@6));
+		expect(@(model.count)).to(equal(@5));
+
+		MTLPropertyDefaultAdapterModel *replacedModel = [outerAdapter modelByUpdatingModel:outerModel fromJSONDictionary:patch options:MTLJSONPatchOptionsNone error:NULL];
+		expect(replacedModel.conformingMTLJSONSerializingProperty.name).to(beNil());
+		expect(@(replacedModel.conformingMTLJSONSerializingProperty.count)).to(equal(@6));
+	});
+
+	it(@"should mark patched properties clean", ^{
+		MTLJSONAdapter *trackingAdapter = [[MTLJSONAdapter alloc] initWithModelClass:MTLDirtyTrackingTestModel.class];
+		MTLDirtyTrackingTestModel *trackingModel = [trackingAdapter modelFromJSONDictionary:@{ @"username": @"foo" } error:NULL];
+
+		trackingModel.name = @"bar";
+		trackingModel.count = 2;
+
+		[trackingAdapter updateModel:trackingModel fromJSONDictionary:@{ @"username": @"baz" } options:MTLJSONPatchOptionsNone error:NULL];
+		expect(trackingModel.dirtyPropertyKeys).to(equal([NSSet setWithObject:@"count"]));
+	});
+});
+
+describe(@"metrics", ^{
+	NSDictionary *values = @{
+		@"username": @"foo",
+		@"count": @"5",
+		@"nested": @{ @"name": @"bar" },
+	};
+
+	beforeEach(^{
+		[MTLJSONAdapter resetMetrics];
+		[MTLJSONAdapter setRecordsMetrics:YES];
+	});
+
+	afterEach(^{
+		[MTLJSONAdapter setRecordsMetrics:NO];
+		[MTLJSONAdapter resetMetrics];
+	});
+
+	it(@"should not record anything while disabled", ^{
+		[MTLJSONAdapter setRecordsMetrics:NO];
+
+		expect([MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL]).notTo(beNil());
+		expect([MTLJSONAdapter metricsSnapshot]).to(equal(@{}));
+	});
+
+	it(@"should record decoded models and properties", ^{
+		expect([MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL]).notTo(beNil());
+
+		NSDictionary *metrics = [MTLJSONAdapter metricsSnapshot][@"MTLTestModel"];
+		expect(metrics[@"encode"]).to(beNil());
+		expect(metrics[@"decode"][@"count"]).to(equal(@1));
+		expect(metrics[@"decode"][@"failures"]).to(equal(@0));
+		expect(metrics[@"decode"][@"objects"]).to(equal(@3));
+		expect(metrics[@"decode"][@"bytes"]).to(equal(@6));
+		expect([metrics[@"decode"][@"histogram"] valueForKeyPath:@"@sum.count"]).to(equal(@1));
+
+		NSDictionary *countMetrics = metrics[@"properties"][@"count"][@"decode"];
+		expect(countMetrics[@"count"]).to(equal(@1));
+		expect(countMetrics[@"objects"]).to(equal(@1));
+	});
+
+	it(@"should record failures", ^{
+		NSDictionary *invalidValues = @{ @"username": @"this is too long a name" };
+		expect([MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:invalidValues error:NULL]).to(beNil());
+
+		NSDictionary *metrics = [MTLJSONAdapter metricsSnapshot][@"MTLTestModel"];
+		expect(metrics[@"decode"][@"count"]).to(equal(@1));
+		expect(metrics[@"decode"][@"failures"]).to(equal(@1));
+		expect(metrics[@"decode"][@"objects"]).to(equal(@0));
+	});
+
+	it(@"should record encoded models and properties", ^{
+		MTLTestModel *model = [MTLTestModel modelWithDictionary:@{ @"name": @"foo", @"count": @12 } error:NULL];
+		expect([MTLJSONAdapter JSONDictionaryFromModel:model error:NULL]).notTo(beNil());
+
+		NSDictionary *metrics = [MTLJSONAdapter metricsSnapshot][@"MTLTestModel"];
+		expect(metrics[@"decode"]).to(beNil());
+		expect(metrics[@"encode"][@"count"]).to(equal(@1));
+
+		NSDictionary *countMetrics = metrics[@"properties"][@"count"][@"encode"];
+		expect(countMetrics[@"count"]).to(equal(@1));
+		expect(countMetrics[@"bytes"]).to(equal(@2));
+	});
+
+	it(@"should record nested models under their own class", ^{
+		NSDictionary *outerValues = @{ @"conformingMTLJSONSerializingProperty": values };
+		expect([MTLJSONAdapter modelOfClass:MTLPropertyDefaultAdapterModel.class fromJSONDictionary:outerValues error:NULL]).notTo(beNil());
+
+		NSDictionary *snapshot = [MTLJSONAdapter metricsSnapshot];
+		expect(snapshot[@"MTLPropertyDefaultAdapterModel"][@"decode"][@"count"]).to(equal(@1));
+		expect(snapshot[@"MTLTestModel"][@"decode"][@"count"]).to(equal(@1));
+	});
+
+	it(@"should serialize a snapshot into JSON", ^{
+		expect([MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL]).notTo(beNil());
+
+		NSData *data = [MTLJSONAdapter metricsSnapshotJSONData];
+		expect([NSJSONSerialization JSONObjectWithData:data options:0 error:NULL]).to(equal([MTLJSONAdapter metricsSnapshot]));
+	});
+
+	it(@"should reset the counters", ^{
+		expect([MTLJSONAdapter modelOfClass:MTLTestModel.class fromJSONDictionary:values error:NULL]).notTo(beNil());
+		expect([MTLJSONAdapter metricsSnapshot]).notTo(equal(@{}));
+
+		[MTLJSONAdapter resetMetrics];
+		expect([MTLJSONAdapter metricsSnapshot]).to(equal(@{}));
+	});
+});
+
 QuickSpecEnd
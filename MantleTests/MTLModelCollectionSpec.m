@@ -0,0 +1,156 @@
+//
+//  MTLModelCollectionSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelCollectionSpec)
+
+__block MTLModelCollection *collection;
+__block NSArray *models;
+
+beforeEach(^{
+	NSError *error = nil;
+	collection = [MTLModelCollection collectionWithModelClass:MTLTestModel.class hashIndexKeys:@[ @"name" ] orderedIndexKeys:@[ @"count" ] error:&error];
+	expect(collection).notTo(beNil());
+	expect(error).to(beNil());
+
+	models = [MTLTestModel modelsWithCount:10 dictionaryAtIndex:^(NSUInteger i) {
+		if (i % 3 == 0) return @{ @"count": @(i % 5) };
+
+		return @{ @"name": [NSString stringWithFormat:@"owner %lu", (unsigned long)(i % 3)], @"count": @(i % 5) };
+	}];
+
+	[collection addModels:models];
+});
+
+// Models are compared by identity, so compare sets of their pointers.
+NSSet * (^identities)(NSArray *) = ^(NSArray *array) {
+	NSMutableSet *set = [NSMutableSet set];
+	for (id object in array) {
+		[set addObject:[NSValue valueWithNonretainedObject:object]];
+	}
+
+	return set;
+};
+
+it(@"should contain the models added", ^{
+	expect(@(collection.count)).to(equal(@10));
+	expect(@([collection containsModel:models[4]])).to(beTruthy());
+	expect(@([collection containsModel:[models[4] copy]])).to(beFalsy());
+	expect(identities(collection.allModels)).to(equal(identities(models)));
+
+	NSMutableArray *enumeratedModels = [NSMutableArray array];
+	for (MTLTestModel *model in collection) {
+		[enumeratedModels addObject:model];
+	}
+
+	expect(identities(enumeratedModels)).to(equal(identities(models)));
+});
+
+it(@"should find models by equality", ^{
+	expect(identities([collection modelsWithValue:@"owner 1" forKey:@"name"])).to(equal(identities(@[ models[1], models[4], models[7] ])));
+	expect(identities([collection modelsWithValue:nil forKey:@"name"])).to(equal(identities(@[ models[0], models[3], models[6], models[9] ])));
+	expect([collection modelsWithValue:@"owner 3" forKey:@"name"]).to(equal(@[]));
+
+	expect(identities([collection modelsWithValue:@2 forKey:@"count"])).to(equal(identities(@[ models[2], models[7] ])));
+});
+
+it(@"should find models in a range", ^{
+	NSArray *rangeModels = [collection modelsWithValuesFrom:@1 to:@2 forKey:@"count"];
+	expect(@(rangeModels.count)).to(equal(@4));
+	expect([rangeModels valueForKey:@"count"]).to(equal(@[ @1, @1, @2, @2 ]));
+
+	expect(@([collection modelsWithValuesFrom:@3 to:nil forKey:@"count"].count)).to(equal(@4));
+	expect(@([collection modelsWithValuesFrom:nil to:@0 forKey:@"count"].count)).to(equal(@2));
+	expect([collection modelsWithValuesFrom:@4 to:@1 forKey:@"count"]).to(equal(@[]));
+});
+
+it(@"should remove models", ^{
+	[collection removeModel:models[1]];
+	expect(@(collection.count)).to(equal(@9));
+	expect(@([collection containsModel:models[1]])).to(beFalsy());
+
+	expect(identities([collection modelsWithValue:@"owner 1" forKey:@"name"])).to(equal(identities(@[ models[4], models[7] ])));
+	expect(identities([collection modelsWithValue:@1 forKey:@"count"])).to(equal(identities(@[ models[6] ])));
+
+	[collection removeAllModels];
+	expect(@(collection.count)).to(equal(@0));
+	expect([collection modelsWithValue:@"owner 2" forKey:@"name"]).to(equal(@[]));
+	expect([collection modelsWithValuesFrom:nil to:nil forKey:@"count"]).to(equal(@[]));
+});
+
+it(@"should replace models", ^{
+	MTLTestModel *newModel = [models[1] copy];
+	newModel.name = @"owner 3";
+	newModel.count = 4;
+
+	[collection replaceModel:models[1] withModel:newModel];
+	expect(@(collection.count)).to(equal(@10));
+	expect([collection modelsWithValue:@"owner 3" forKey:@"name"]).to(equal(@[ newModel ]));
+	expect(identities([collection modelsWithValue:@1 forKey:@"count"])).to(equal(identities(@[ models[6] ])));
+	expect(identities([collection modelsWithValue:@4 forKey:@"count"])).to(equal(identities(@[ models[4], models[9], newModel ])));
+});
+
+it(@"should reindex changed models", ^{
+	MTLTestModel *model = models[2];
+	model.name = @"owner 1";
+	model.count = 0;
+
+	// The indexes still have the old values until the model is reindexed.
+	expect(@([[collection modelsWithValue:@"owner 1" forKey:@"name"] indexOfObjectIdenticalTo:model])).to(equal(@(NSNotFound)));
+
+	[collection reindexModel:model];
+	expect(@([[collection modelsWithValue:@"owner 1" forKey:@"name"] indexOfObjectIdenticalTo:model])).notTo(equal(@(NSNotFound)));
+	expect(@([[collection modelsWithValue:@"owner 2" forKey:@"name"] indexOfObjectIdenticalTo:model])).to(equal(@(NSNotFound)));
+	expect(identities([collection modelsWithValue:@0 forKey:@"count"])).to(equal(identities(@[ models[0], model, models[5] ])));
+});
+
+it(@"should keep large ordered indexes sorted", ^{
+	NSArray *largeModels = [MTLTestModel modelsWithCount:3000 dictionaryAtIndex:^(NSUInteger i) {
+		return @{ @"count": @((i * 7919) % 1000) };
+	}];
+
+	// Build part of the index in bulk, add the rest one at a time, then remove
+	// enough models for blocks to be merged.
+	[collection removeAllModels];
+	[collection addModels:[largeModels subarrayWithRange:NSMakeRange(0, 2000)]];
+	for (MTLTestModel *model in [largeModels subarrayWithRange:NSMakeRange(2000, 1000)]) {
+		[collection addModel:model];
+	}
+
+	for (NSUInteger i = 0; i < largeModels.count; i += 3) {
+		[collection removeModel:largeModels[i]];
+	}
+
+	NSMutableArray *remainingModels = [NSMutableArray array];
+	for (NSUInteger i = 0; i < largeModels.count; i++) {
+		if (i % 3 != 0) [remainingModels addObject:largeModels[i]];
+	}
+
+	NSArray *sortedModels = [collection modelsWithValuesFrom:nil to:nil forKey:@"count"];
+	expect(identities(sortedModels)).to(equal(identities(remainingModels)));
+	expect([sortedModels valueForKey:@"count"]).to(equal([[remainingModels valueForKey:@"count"] sortedArrayUsingSelector:@selector(compare:)]));
+
+	NSArray *rangeModels = [collection modelsWithValuesFrom:@100 to:@199 forKey:@"count"];
+	expect(identities(rangeModels)).to(equal(identities([remainingModels filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"count BETWEEN { 100, 199 }"]])));
+	expect(@([collection modelsWithValue:@500 forKey:@"count"].count)).to(equal(@([remainingModels filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"count == 500"]].count)));
+});
+
+it(@"should fail to index unsupported properties", ^{
+	NSError *error = nil;
+	MTLModelCollection *invalidCollection = [MTLModelCollection collectionWithModelClass:MTLTestModel.class hashIndexKeys:@[] orderedIndexKeys:@[ @"weakModel" ] error:&error];
+	expect(invalidCollection).to(beNil());
+	expect(error.domain).to(equal(MTLModelCollectionErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLModelCollectionErrorUnsupportedProperty)));
+});
+
+QuickSpecEnd
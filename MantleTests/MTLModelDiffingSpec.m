@@ -0,0 +1,105 @@
+//
+//  MTLModelDiffingSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelDiffingSpec)
+
+describe(@"changed key paths", ^{
+	it(@"should be empty for equal models", ^{
+		MTLTestModel *model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @5 } error:NULL];
+		expect([model changedKeyPathsComparedToModel:[model copy]]).to(equal([NSSet set]));
+	});
+
+	it(@"should report changed properties", ^{
+		MTLTestModel *oldModel = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @5, @"nestedName": @"bar" } error:NULL];
+		MTLTestModel *newModel = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @6 } error:NULL];
+
+		expect([oldModel changedKeyPathsComparedToModel:newModel]).to(equal([NSSet setWithObjects:@"count", @"nestedName", nil]));
+	});
+
+	it(@"should not report transitory properties", ^{
+		MTLTestModel *oldModel = [[MTLTestModel alloc] init];
+		MTLTestModel *newModel = [oldModel copy];
+		newModel.weakModel = [[MTLEmptyTestModel alloc] init];
+
+		expect([oldModel changedKeyPathsComparedToModel:newModel]).to(equal([NSSet set]));
+	});
+
+	it(@"should recurse into nested models", ^{
+		MTLPropertyDefaultAdapterModel *oldModel = [[MTLPropertyDefaultAdapterModel alloc] init];
+		oldModel.property = @"foo";
+		oldModel.conformingMTLJSONSerializingProperty = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @1 } error:NULL];
+
+		MTLPropertyDefaultAdapterModel *newModel = [oldModel copy];
+		newModel.conformingMTLJSONSerializingProperty = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"bar", @"count": @1 } error:NULL];
+
+		expect([oldModel changedKeyPathsComparedToModel:newModel]).to(equal([NSSet setWithObject:@"conformingMTLJSONSerializingProperty.name"]));
+
+		newModel.conformingMTLJSONSerializingProperty = nil;
+		expect([oldModel changedKeyPathsComparedToModel:newModel]).to(equal([NSSet setWithObject:@"conformingMTLJSONSerializingProperty"]));
+	});
+});
+
+describe(@"array diffs", ^{
+	MTLTestModel * (^model)(NSString *, NSUInteger) = ^(NSString *name, NSUInteger count) {
+		return [[MTLTestModel alloc] initWithDictionary:@{ @"name": name, @"count": @(count) } error:NULL];
+	};
+
+	it(@"should have no changes for equal arrays", ^{
+		NSArray *models = @[ model(@"a", 1), model(@"b", 2) ];
+
+		MTLModelArrayDiff *diff = [MTLTestModel diffFromModels:models toModels:[[NSArray alloc] initWithArray:models copyItems:YES] identityKey:@"name"];
+		expect(@(diff.hasChanges)).to(beFalsy());
+	});
+
+	it(@"should report inserts, deletes and updates", ^{
+		NSArray *oldModels = @[ model(@"a", 1), model(@"b", 2), model(@"c", 3) ];
+		NSArray *newModels = @[ model(@"a", 1), model(@"c", 4), model(@"d", 5) ];
+
+		MTLModelArrayDiff *diff = [MTLTestModel diffFromModels:oldModels toModels:newModels identityKey:@"name"];
+		expect(@(diff.hasChanges)).to(beTruthy());
+		expect(diff.deletedIndexes).to(equal([NSIndexSet indexSetWithIndex:1]));
+		expect(diff.insertedIndexes).to(equal([NSIndexSet indexSetWithIndex:2]));
+		expect(diff.updatedIndexes).to(equal([NSIndexSet indexSetWithIndex:1]));
+		expect(@(diff.moveCount)).to(equal(@0));
+	});
+
+	it(@"should report the fewest moves", ^{
+		NSArray *oldModels = @[ model(@"a", 1), model(@"b", 1), model(@"c", 1), model(@"d", 1), model(@"e", 1) ];
+		NSArray *newModels = @[ model(@"e", 1), model(@"a", 1), model(@"b", 1), model(@"d", 1), model(@"c", 1) ];
+
+		MTLModelArrayDiff *diff = [MTLTestModel diffFromModels:oldModels toModels:newModels identityKey:@"name"];
+		expect(diff.deletedIndexes).to(equal([NSIndexSet indexSet]));
+		expect(diff.insertedIndexes).to(equal([NSIndexSet indexSet]));
+		expect(diff.updatedIndexes).to(equal([NSIndexSet indexSet]));
+		expect(@(diff.moveCount)).to(equal(@2));
+
+		NSMutableArray *moves = [NSMutableArray array];
+		[diff enumerateMovesUsingBlock:^(NSUInteger fromIndex, NSUInteger toIndex) {
+			[moves addObject:@[ @(fromIndex), @(toIndex) ]];
+		}];
+
+		expect(moves).to(equal(@[ @[ @4, @0 ], @[ @3, @3 ] ]));
+	});
+
+	it(@"should match only the first of duplicate identities", ^{
+		NSArray *oldModels = @[ model(@"a", 1), model(@"a", 2) ];
+		NSArray *newModels = @[ model(@"a", 1) ];
+
+		MTLModelArrayDiff *diff = [MTLTestModel diffFromModels:oldModels toModels:newModels identityKey:@"name"];
+		expect(diff.deletedIndexes).to(equal([NSIndexSet indexSetWithIndex:1]));
+		expect(@(diff.updatedIndexes.count)).to(equal(@0));
+	});
+});
+
+QuickSpecEnd
@@ -0,0 +1,116 @@
+//
+//  MTLModelDirtyTrackingSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelDirtyTrackingSpec)
+
+__block MTLDirtyTrackingTestModel *model;
+
+beforeEach(^{
+	NSDictionary *values = @{
+		@"username": @"foo",
+		@"count": @"5",
+		@"nested": @{ @"name": @"bar" },
+	};
+
+	model = [MTLJSONAdapter modelOfClass:MTLDirtyTrackingTestModel.class fromJSONDictionary:values error:NULL];
+	expect(model).notTo(beNil());
+});
+
+it(@"should not track models by default", ^{
+	MTLTestModel *untrackedModel = [[MTLTestModel alloc] init];
+	untrackedModel.name = @"foo";
+
+	expect(@([MTLTestModel tracksDirtyPropertyKeys])).to(beFalsy());
+	expect(untrackedModel.dirtyPropertyKeys).to(equal([NSSet set]));
+});
+
+it(@"should track models whose +initialize doesn't call super", ^{
+	MTLInitializingDirtyTrackingTestModel *initializingModel = [[MTLInitializingDirtyTrackingTestModel alloc] init];
+	initializingModel.name = @"foo";
+
+	expect(initializingModel.dirtyPropertyKeys).to(equal([NSSet setWithObject:@"name"]));
+});
+
+it(@"should start out clean when deserialized from JSON", ^{
+	expect(model.dirtyPropertyKeys).to(equal([NSSet set]));
+});
+
+it(@"should mark properties set through setters or KVC dirty", ^{
+	model.name = @"baz";
+	model.count = 6;
+	[model setValue:@"qux" forKey:@"nestedName"];
+
+	expect(model.dirtyPropertyKeys).to(equal([NSSet setWithObjects:@"name", @"count", @"nestedName", nil]));
+});
+
+it(@"should mark only changed properties dirty when merging changed values", ^{
+	MTLDirtyTrackingTestModel *source = [model copy];
+	source.nestedName = @"baz";
+
+	// -mergeCountFromModel: always sets the count.
+	[model mergeChangedValuesForKeysFromModel:source];
+	expect(model.dirtyPropertyKeys).to(equal([NSSet setWithObjects:@"count", @"nestedName", nil]));
+});
+
+it(@"should clear dirty properties when snapshotted", ^{
+	model.name = @"baz";
+
+	expect([model snapshotDirtyPropertyKeys]).to(equal([NSSet setWithObject:@"name"]));
+	expect(model.dirtyPropertyKeys).to(equal([NSSet set]));
+});
+
+it(@"should copy dirty properties", ^{
+	model.name = @"baz";
+
+	MTLDirtyTrackingTestModel *copiedModel = [model copy];
+	expect(copiedModel.dirtyPropertyKeys).to(equal([NSSet setWithObject:@"name"]));
+
+	copiedModel.count = 2;
+	expect(model.dirtyPropertyKeys).to(equal([NSSet setWithObject:@"name"]));
+});
+
+describe(@"serializing dirty properties", ^{
+	it(@"should serialize nothing for a clean model", ^{
+		NSError *error = nil;
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromDirtyPropertiesOfModel:model error:&error];
+
+		expect(JSONDictionary).to(equal(@{}));
+		expect(error).to(beNil());
+	});
+
+	it(@"should serialize only dirty properties", ^{
+		model.count = 7;
+		model.name = nil;
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromDirtyPropertiesOfModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{ @"count": @"7", @"username": NSNull.null }));
+	});
+
+	it(@"should serialize nested key paths", ^{
+		model.nestedName = @"baz";
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromDirtyPropertiesOfModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{ @"nested": @{ @"name": @"baz" } }));
+	});
+
+	it(@"should skip unmapped properties", ^{
+		model.weakModel = [[MTLEmptyTestModel alloc] init];
+		expect(model.dirtyPropertyKeys).to(equal([NSSet setWithObject:@"weakModel"]));
+
+		NSDictionary *JSONDictionary = [MTLJSONAdapter JSONDictionaryFromDirtyPropertiesOfModel:model error:NULL];
+		expect(JSONDictionary).to(equal(@{}));
+	});
+});
+
+QuickSpecEnd
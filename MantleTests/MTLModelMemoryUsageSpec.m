@@ -0,0 +1,76 @@
+//
+//  MTLModelMemoryUsageSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelMemoryUsageSpec)
+
+it(@"should measure a single model", ^{
+	// Non-ASCII strings are never tagged pointers, so this one lives on the
+	// heap.
+	NSString *name = [@"føø" stringByAppendingString:@"bår"];
+	MTLTestModel *model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": name, @"count": @5 } error:NULL];
+
+	MTLModelMemoryUsage *usage = model.memoryUsage;
+	expect(usage.usageByClassName.allKeys).to(equal(@[ @"MTLTestModel" ]));
+
+	MTLModelClassMemoryUsage *classUsage = usage.usageByClassName[@"MTLTestModel"];
+	expect(classUsage.modelClass).to(beIdenticalTo(MTLTestModel.class));
+	expect(@(classUsage.instanceCount)).to(equal(@1));
+	expect(@(classUsage.shallowBytes)).to(beGreaterThan(@0));
+	expect(@(classUsage.retainedBytes)).to(beGreaterThan(@(classUsage.shallowBytes)));
+	expect(@(usage.totalBytes)).to(equal(@(classUsage.retainedBytes)));
+});
+
+it(@"should not walk transitory properties", ^{
+	MTLEmptyTestModel *emptyModel = [[MTLEmptyTestModel alloc] init];
+	MTLTestModel *model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"weakModel": emptyModel } error:NULL];
+
+	expect(model.memoryUsage.usageByClassName[@"MTLEmptyTestModel"]).to(beNil());
+});
+
+it(@"should count shared models once", ^{
+	MTLTestModel *sharedModel = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"shared" } error:NULL];
+
+	MTLPropertyDefaultAdapterModel *firstModel = [[MTLPropertyDefaultAdapterModel alloc] init];
+	firstModel.conformingMTLJSONSerializingProperty = sharedModel;
+
+	MTLPropertyDefaultAdapterModel *secondModel = [[MTLPropertyDefaultAdapterModel alloc] init];
+	secondModel.conformingMTLJSONSerializingProperty = sharedModel;
+
+	MTLModelMemoryUsage *usage = [MTLModelMemoryUsage memoryUsageOfObjects:@[ firstModel, secondModel, sharedModel ]];
+	expect(@(usage.usageByClassName[@"MTLPropertyDefaultAdapterModel"].instanceCount)).to(equal(@2));
+	expect(@(usage.usageByClassName[@"MTLTestModel"].instanceCount)).to(equal(@1));
+	expect(@(usage.totalBytes)).to(beGreaterThan(@(usage.usageByClassName[@"MTLTestModel"].retainedBytes)));
+});
+
+it(@"should handle cyclic references", ^{
+	MTLRecursiveUserModel *user = [[MTLRecursiveUserModel alloc] initWithDictionary:@{ @"name": @"foo" } error:NULL];
+	MTLRecursiveGroupModel *group = [[MTLRecursiveGroupModel alloc] initWithDictionary:@{ @"owner": user, @"users": @[ user ] } error:NULL];
+	[user setValue:@[ group ] forKey:@"groups"];
+
+	MTLModelMemoryUsage *usage = user.memoryUsage;
+	expect(@(usage.usageByClassName[@"MTLRecursiveUserModel"].instanceCount)).to(equal(@1));
+	expect(@(usage.usageByClassName[@"MTLRecursiveGroupModel"].instanceCount)).to(equal(@1));
+
+	NSUInteger retainedBytes = 0;
+	for (MTLModelClassMemoryUsage *classUsage in usage.usageByClassName.allValues) {
+		retainedBytes += classUsage.retainedBytes;
+	}
+
+	expect(@(usage.totalBytes)).to(equal(@(retainedBytes)));
+
+	// Break the cycle so the models can be deallocated.
+	[user setValue:nil forKey:@"groups"];
+});
+
+QuickSpecEnd
@@ -124,6 +124,16 @@ describe(@"archiving", ^{
 		expect(@(unarchivedModel.count)).to(equal(@5));
 	});
 
+	it(@"should validate unarchived values", ^{
+		// Bypasses validation.
+		model.name = @"this name is too long";
+
+		NSData *data = [NSKeyedArchiver archivedDataWithRootObject:model];
+		expect(data).notTo(beNil());
+
+		expect([NSKeyedUnarchiver unarchiveObjectWithData:data]).to(beNil());
+	});
+
 	it(@"should unarchive an external representation from the old model format", ^{
 		NSURL *archiveURL = [[NSBundle bundleForClass:self.class] URLForResource:@"MTLTestModel-OldArchive" withExtension:@"plist"];
 		expect(archiveURL).notTo(beNil());
@@ -0,0 +1,119 @@
+//
+//  MTLModelSorterSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelSorterSpec)
+
+__block NSArray *models;
+
+beforeEach(^{
+	NSArray *dictionaries = @[
+		@{ @"name": @"bob", @"count": @3 },
+		@{ @"name": @"Alice", @"count": @1 },
+		@{ @"name": @"carol", @"count": @3 },
+		@{ @"name": @"Bob", @"count": @2 },
+		@{ @"name": @"alice", @"count": @2 },
+	];
+
+	models = [MTLTestModel modelsWithCount:dictionaries.count dictionaryAtIndex:^(NSUInteger i) {
+		return dictionaries[i];
+	}];
+});
+
+it(@"should sort by multiple keys", ^{
+	NSArray *sortKeys = @[
+		[MTLModelSortKey sortKeyWithPropertyKey:@"count" ascending:NO],
+		[MTLModelSortKey sortKeyWithPropertyKey:@"name" ascending:YES],
+	];
+
+	NSError *error = nil;
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class sortKeys:sortKeys error:&error];
+	expect(sorter).notTo(beNil());
+	expect(error).to(beNil());
+
+	NSArray *expectedModels = [models sortedArrayUsingDescriptors:@[
+		[NSSortDescriptor sortDescriptorWithKey:@"count" ascending:NO],
+		[NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES],
+	]];
+
+	expect([sorter sortedArrayFromModels:models options:MTLModelSortOptionsNone]).to(equal(expectedModels));
+	expect([models sortedArrayUsingComparator:sorter.comparator]).to(equal(expectedModels));
+});
+
+it(@"should sort strings with options", ^{
+	MTLModelSortKey *sortKey = [MTLModelSortKey sortKeyWithPropertyKey:@"name" ascending:YES options:NSCaseInsensitiveSearch];
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class sortKeys:@[ sortKey ] error:NULL];
+
+	NSArray *sortedModels = [sorter sortedArrayFromModels:models options:MTLModelSortOptionsNone];
+	expect([sortedModels valueForKey:@"name"]).to(equal(@[ @"Alice", @"alice", @"bob", @"Bob", @"carol" ]));
+});
+
+it(@"should sort stably", ^{
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class propertyKeys:@[ @"count" ] error:NULL];
+
+	NSArray *sortedModels = [sorter sortedArrayFromModels:models options:MTLModelSortOptionsNone];
+	expect([sortedModels valueForKey:@"name"]).to(equal(@[ @"Alice", @"Bob", @"alice", @"bob", @"carol" ]));
+});
+
+it(@"should sort large arrays concurrently", ^{
+	NSMutableArray *manyModels = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 10000; i++) {
+		NSString *name = [NSString stringWithFormat:@"%lu", (unsigned long)(i % 13)];
+		[manyModels addObject:[[MTLTestModel alloc] initWithDictionary:@{ @"name": name, @"count": @((i * 7919) % 101) } error:NULL]];
+	}
+
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class propertyKeys:@[ @"count" ] error:NULL];
+
+	NSArray *serialModels = [sorter sortedArrayFromModels:manyModels options:MTLModelSortOptionsNone];
+	NSArray *concurrentModels = [sorter sortedArrayFromModels:manyModels options:MTLModelSortOptionsConcurrent];
+
+	NSArray *expectedModels = [manyModels sortedArrayWithOptions:NSSortStable usingComparator:sorter.comparator];
+	expect(@(serialModels.count)).to(equal(@10000));
+	expect(@(concurrentModels.count)).to(equal(@10000));
+
+	// Many models are equal, so compare identities to check stability.
+	BOOL identical = YES;
+	for (NSUInteger i = 0; i < expectedModels.count; i++) {
+		identical = identical && serialModels[i] == expectedModels[i] && concurrentModels[i] == expectedModels[i];
+	}
+
+	expect(@(identical)).to(beTruthy());
+});
+
+it(@"should group models", ^{
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class propertyKeys:@[ @"name" ] error:NULL];
+
+	NSError *error = nil;
+	NSDictionary *groups = [sorter groupModels:models byPropertyKey:@"count" options:MTLModelSortOptionsNone error:&error];
+	expect(groups).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(@(groups.count)).to(equal(@3));
+	expect([groups[@1] valueForKey:@"name"]).to(equal(@[ @"Alice" ]));
+	expect([groups[@2] valueForKey:@"name"]).to(equal(@[ @"Bob", @"alice" ]));
+	expect([groups[@3] valueForKey:@"name"]).to(equal(@[ @"bob", @"carol" ]));
+});
+
+it(@"should fail to sort by unsupported properties", ^{
+	NSError *error = nil;
+	MTLModelSorter *sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class propertyKeys:@[ @"weakModel" ] error:&error];
+	expect(sorter).to(beNil());
+	expect(error.domain).to(equal(MTLModelSorterErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLModelSorterErrorUnsupportedProperty)));
+
+	sorter = [MTLModelSorter sorterWithModelClass:MTLTestModel.class propertyKeys:@[] error:NULL];
+	expect([sorter groupModels:models byPropertyKey:@"foobar" options:MTLModelSortOptionsNone error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLModelSorterErrorUnsupportedProperty)));
+});
+
+QuickSpecEnd
@@ -135,6 +135,77 @@ it(@"should merge two models together", ^{
 	expect(@(target.count)).to(equal(@8));
 });
 
+it(@"should merge only changed values and return their keys", ^{
+	MTLTestModel *target = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @(5), @"nestedName": @"baz" } error:NULL];
+	MTLTestModel *source = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @(3), @"nestedName": @"qux" } error:NULL];
+
+	NSSet *changedKeys = [target mergeChangedValuesForKeysFromModel:source];
+	expect(changedKeys).to(equal([NSSet setWithObjects:@"count", @"nestedName", nil]));
+	expect(target.name).to(equal(@"foo"));
+	expect(@(target.count)).to(equal(@8));
+	expect(target.nestedName).to(equal(@"qux"));
+
+	changedKeys = [target mergeChangedValuesForKeysFromModel:[target copy]];
+	expect(changedKeys).to(equal([NSSet setWithObject:@"count"]));
+	expect(@(target.count)).to(equal(@16));
+});
+
+it(@"should copy readonly and struct properties", ^{
+	NSDictionary *values = @{
+		@"range": [NSValue valueWithRange:NSMakeRange(1, 2)],
+		@"nestedRange": [NSValue valueWithRange:NSMakeRange(3, 4)],
+	};
+
+	MTLMultiKeypathModel *model = [[MTLMultiKeypathModel alloc] initWithDictionary:values error:NULL];
+	MTLMultiKeypathModel *copiedModel = [model copy];
+
+	expect(@(NSEqualRanges(copiedModel.range, model.range))).to(beTruthy());
+	expect(@(NSEqualRanges(copiedModel.nestedRange, model.nestedRange))).to(beTruthy());
+});
+
+describe(@"updating values in a copy", ^{
+	__block MTLTestModel *model;
+
+	beforeEach(^{
+		model = [[MTLTestModel alloc] initWithDictionary:@{ @"name": @"foo", @"count": @(5), @"nestedName": @"bar" } error:NULL];
+		expect(model).notTo(beNil());
+	});
+
+	it(@"should only change the given values", ^{
+		NSError *error = nil;
+		MTLTestModel *updatedModel = [model modelByUpdatingValues:@{ @"count": @(7), @"nestedName": NSNull.null } error:&error];
+		expect(updatedModel).notTo(beNil());
+		expect(error).to(beNil());
+
+		expect(@(updatedModel.count)).to(equal(@7));
+		expect(updatedModel.nestedName).to(beNil());
+		expect(updatedModel.name).to(beIdenticalTo(model.name));
+
+		expect(@(model.count)).to(equal(@5));
+		expect(model.nestedName).to(equal(@"bar"));
+	});
+
+	it(@"should validate the given values", ^{
+		NSError *error = nil;
+		MTLTestModel *updatedModel = [model modelByUpdatingValues:@{ @"name": @"this is too long a name" } error:&error];
+		expect(updatedModel).to(beNil());
+
+		expect(error.domain).to(equal(MTLTestModelErrorDomain));
+		expect(@(error.code)).to(equal(@(MTLTestModelNameTooLong)));
+		expect(model.name).to(equal(@"foo"));
+	});
+
+	it(@"should keep the dirty properties of the receiver", ^{
+		MTLDirtyTrackingTestModel *trackingModel = [[MTLDirtyTrackingTestModel alloc] init];
+		trackingModel.name = @"foo";
+		[trackingModel snapshotDirtyPropertyKeys];
+		trackingModel.count = 2;
+
+		MTLDirtyTrackingTestModel *updatedModel = [trackingModel modelByUpdatingValues:@{ @"name": @"foo", @"nestedName": @"bar" } error:NULL];
+		expect(updatedModel.dirtyPropertyKeys).to(equal([NSSet setWithObjects:@"count", @"nestedName", nil]));
+	});
+});
+
 it(@"should consider primitive properties permanent", ^{
 	expect(@([MTLStorageBehaviorModel storageBehaviorForPropertyWithKey:@"primitive"])).to(equal(@(MTLPropertyStoragePermanent)));
 });
@@ -0,0 +1,130 @@
+//
+//  MTLModelStoreSpec.m
+//  Mantle
+//
+//  Created by Mantle Contributors on 2026-10-19.
+//  Copyright (c) 2026 GitHub. All rights reserved.
+//
+
+#import <Mantle/Mantle.h>
+#import <Nimble/Nimble.h>
+#import <Quick/Quick.h>
+
+#import "MTLTestModel.h"
+
+QuickSpecBegin(MTLModelStoreSpec)
+
+__block NSArray *models;
+__block NSSet *modelClasses;
+
+beforeEach(^{
+	MTLTestModel.modelVersion = 1;
+
+	models = [MTLTestModel modelsWithCount:20 dictionaryAtIndex:^(NSUInteger i) {
+		return @{ @"name": [NSString stringWithFormat:@"model %lu", (unsigned long)i], @"count": @(i) };
+	}];
+	modelClasses = [NSSet setWithObject:MTLTestModel.class];
+});
+
+it(@"should read models by index", ^{
+	NSError *error = nil;
+	NSData *data = [MTLModelStore dataWithModels:models identityKey:nil error:&error];
+	expect(data).notTo(beNil());
+	expect(error).to(beNil());
+
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:data modelClasses:modelClasses error:&error];
+	expect(store).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(@(store.count)).to(equal(@20));
+	expect(@(store.hasIdentityIndex)).to(beFalsy());
+
+	expect([store modelAtIndex:7 error:&error]).to(equal(models[7]));
+	expect(store[19]).to(equal(models[19]));
+	expectAction(^{ [store modelAtIndex:20 error:NULL]; }).to(raiseException().named(NSRangeException));
+	expectAction(^{ (void)store[20]; }).to(raiseException().named(NSRangeException));
+	expect(store.models).to(equal(models));
+});
+
+it(@"should read models by identity", ^{
+	NSData *data = [MTLModelStore dataWithModels:models identityKey:@"count" error:NULL];
+	expect(data).notTo(beNil());
+
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:data modelClasses:modelClasses error:NULL];
+	expect(@(store.hasIdentityIndex)).to(beTruthy());
+
+	for (NSUInteger i = 0; i < models.count; i++) {
+		expect(@([store indexOfModelWithIdentity:@(i)])).to(equal(@(i)));
+		expect(store[@(i)]).to(equal(models[i]));
+	}
+
+	expect(@([store indexOfModelWithIdentity:@20])).to(equal(@(NSNotFound)));
+	expect(store[@"model 1"]).to(beNil());
+});
+
+it(@"should enumerate models", ^{
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:[MTLModelStore dataWithModels:models identityKey:nil error:NULL] modelClasses:modelClasses error:NULL];
+	store.cacheCountLimit = 2;
+
+	NSMutableArray *enumeratedModels = [NSMutableArray array];
+	for (MTLTestModel *model in store) {
+		[enumeratedModels addObject:model];
+	}
+
+	expect(enumeratedModels).to(equal(models));
+});
+
+it(@"should keep models in memory", ^{
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:[MTLModelStore dataWithModels:models identityKey:nil error:NULL] modelClasses:modelClasses error:NULL];
+
+	MTLTestModel *model = store[3];
+	expect(store[3]).to(beIdenticalTo(model));
+
+	[store removeAllCachedModels];
+	expect(store[3]).notTo(beIdenticalTo(model));
+	expect(store[3]).to(equal(model));
+});
+
+it(@"should read a store from a file", ^{
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString]];
+
+	NSError *error = nil;
+	BOOL success = [MTLModelStore writeModels:models identityKey:@"name" toURL:URL error:&error];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	MTLModelStore *store = [[MTLModelStore alloc] initWithContentsOfURL:URL modelClasses:modelClasses error:&error];
+	expect(store).notTo(beNil());
+	expect(error).to(beNil());
+
+	expect(store[@"model 12"]).to(equal(models[12]));
+
+	[NSFileManager.defaultManager removeItemAtURL:URL error:NULL];
+});
+
+it(@"should not write duplicate identities", ^{
+	NSError *error = nil;
+	NSData *data = [MTLModelStore dataWithModels:@[ models[0], models[0] ] identityKey:@"name" error:&error];
+	expect(data).to(beNil());
+	expect(error.domain).to(equal(MTLModelStoreErrorDomain));
+	expect(@(error.code)).to(equal(@(MTLModelStoreErrorInvalidIdentity)));
+});
+
+it(@"should fail to open invalid data", ^{
+	NSError *error = nil;
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:[@"not a store" dataUsingEncoding:NSUTF8StringEncoding] modelClasses:modelClasses error:&error];
+	expect(store).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLModelStoreErrorInvalidStore)));
+});
+
+it(@"should fail to read models of disallowed classes", ^{
+	MTLModelStore *store = [[MTLModelStore alloc] initWithData:[MTLModelStore dataWithModels:models identityKey:nil error:NULL] modelClasses:[NSSet setWithObject:MTLEmptyTestModel.class] error:NULL];
+	expect(store).notTo(beNil());
+
+	NSError *error = nil;
+	expect([store modelAtIndex:0 error:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(MTLModelStoreErrorInvalidStore)));
+	expect(error.userInfo[NSUnderlyingErrorKey]).notTo(beNil());
+});
+
+QuickSpecEnd
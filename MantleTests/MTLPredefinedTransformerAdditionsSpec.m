@@ -90,6 +90,148 @@ describe(@"The number transformer", ^{
 	});
 });
 
+describe(@"The base64 data transformer", ^{
+	__block NSValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [NSValueTransformer valueTransformerForName:MTLBase64DataValueTransformerName];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert base64 strings to NSData and back", ^{
+		NSData *data = [@"Mantle makes it easy" dataUsingEncoding:NSUTF8StringEncoding];
+		NSString *string = @"TWFudGxlIG1ha2VzIGl0IGVhc3k=";
+
+		expect([transformer transformedValue:string]).to(equal(data));
+		expect([transformer reverseTransformedValue:data]).to(equal(string));
+
+		expect([transformer transformedValue:@"TWFudGxlIG1ha2VzIGl0IGVhc3k"]).to(equal(data));
+		expect([transformer transformedValue:@""]).to(equal([NSData data]));
+		expect([transformer reverseTransformedValue:[NSData data]]).to(equal(@""));
+
+		expect([transformer transformedValue:nil]).to(beNil());
+		expect([transformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should match Foundation for every length and byte value", ^{
+		NSMutableData *data = [NSMutableData dataWithLength:259];
+		uint8_t *bytes = data.mutableBytes;
+		for (NSUInteger i = 0; i < data.length; i++) {
+			bytes[i] = (uint8_t)(i * 7 + 3);
+		}
+
+		for (NSUInteger length = 0; length <= data.length; length++) {
+			NSData *subdata = [data subdataWithRange:NSMakeRange(0, length)];
+			NSString *expected = [subdata base64EncodedStringWithOptions:0];
+
+			expect([transformer reverseTransformedValue:subdata]).to(equal(expected));
+			expect([transformer transformedValue:expected]).to(equal(subdata));
+		}
+	});
+
+	it(@"should reject characters outside of the alphabet", ^{
+		NSError *error = nil;
+		BOOL success = YES;
+
+		expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:@"TWFu dGxl" success:&success error:&error]).to(beNil());
+		expect(@(success)).to(beFalsy());
+		expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+
+		success = YES;
+		expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:@"TWFu-_xl" success:&success error:NULL]).to(beNil());
+		expect(@(success)).to(beFalsy());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"not base64!",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
+describe(@"The URL-safe base64 data transformer", ^{
+	__block NSValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [NSValueTransformer valueTransformerForName:MTLBase64URLDataValueTransformerName];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert unpadded URL-safe strings to NSData and back", ^{
+		const uint8_t bytes[] = { 0xFB, 0xFF, 0xBF, 0x00, 0x3E };
+		NSData *data = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+
+		expect([transformer reverseTransformedValue:data]).to(equal(@"-_-_AD4"));
+		expect([transformer transformedValue:@"-_-_AD4"]).to(equal(data));
+		expect([transformer transformedValue:@"-_-_AD4="]).to(equal(data));
+	});
+
+	it(@"should reject the standard alphabet", ^{
+		BOOL success = YES;
+
+		expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:@"+/+/AD4" success:&success error:NULL]).to(beNil());
+		expect(@(success)).to(beFalsy());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"+/+/",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
+describe(@"The hex data transformer", ^{
+	__block NSValueTransformer *transformer;
+
+	beforeEach(^{
+		transformer = [NSValueTransformer valueTransformerForName:MTLHexDataValueTransformerName];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should convert hex strings to NSData and back", ^{
+		NSMutableData *data = [NSMutableData dataWithLength:256];
+		NSMutableString *string = [NSMutableString string];
+
+		uint8_t *bytes = data.mutableBytes;
+		for (NSUInteger i = 0; i < data.length; i++) {
+			bytes[i] = (uint8_t)i;
+			[string appendFormat:@"%02x", (unsigned)i];
+		}
+
+		expect([transformer reverseTransformedValue:data]).to(equal(string));
+		expect([transformer transformedValue:string]).to(equal(data));
+		expect([transformer transformedValue:string.uppercaseString]).to(equal(data));
+
+		expect([transformer transformedValue:nil]).to(beNil());
+		expect([transformer reverseTransformedValue:nil]).to(beNil());
+	});
+
+	it(@"should reject odd lengths", ^{
+		BOOL success = YES;
+
+		expect([(id<MTLTransformerErrorHandling>)transformer transformedValue:@"abc" success:&success error:NULL]).to(beNil());
+		expect(@(success)).to(beFalsy());
+	});
+
+	itBehavesLike(MTLTransformerErrorExamples, ^{
+		return @{
+			MTLTransformerErrorExamplesTransformer: transformer,
+			MTLTransformerErrorExamplesInvalidTransformationInput: @"0x1234",
+			MTLTransformerErrorExamplesInvalidReverseTransformationInput: NSNull.null
+		};
+	});
+});
+
 describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 	__block NSValueTransformer *transformer;
 
@@ -142,6 +284,97 @@ describe(@"+mtl_arrayMappingTransformerWithTransformer:", ^{
 		});
 	});
 
+	describe(@"when called with a transformer without error handling", ^{
+		beforeEach(^{
+			NSValueTransformer *appliedTransformer = [NSValueTransformer valueTransformerForName:NSNegateBooleanTransformerName];
+			transformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:appliedTransformer];
+			expect(transformer).notTo(beNil());
+		});
+
+		it(@"should apply the transformer to each element", ^{
+			expect([transformer transformedValue:@[ @YES, NSNull.null, @NO ]]).to(equal((@[ @NO, NSNull.null, @YES ])));
+		});
+
+		it(@"should apply the transformer to each element in reverse", ^{
+			expect([transformer reverseTransformedValue:@[ @NO, @YES ]]).to(equal((@[ @YES, @NO ])));
+		});
+	});
+
+	describe(@"when an element cannot be transformed", ^{
+		beforeEach(^{
+			NSValueTransformer *appliedTransformer = [NSValueTransformer valueTransformerForName:MTLURLValueTransformerName];
+			transformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:appliedTransformer];
+		});
+
+		it(@"should report the failing index and the underlying error", ^{
+			BOOL success = YES;
+			NSError *error = nil;
+			id value = [(id<MTLTransformerErrorHandling>)transformer transformedValue:@[ @"https://github.com/", @5 ] success:&success error:&error];
+
+			expect(value).to(beNil());
+			expect(@(success)).to(beFalsy());
+			expect(error.domain).to(equal(MTLTransformerErrorHandlingErrorDomain));
+			expect(error.localizedFailureReason).to(equal(@"Could not transform value at index 1"));
+			expect(error.userInfo[NSUnderlyingErrorKey]).notTo(beNil());
+		});
+
+		it(@"should fail without an error pointer", ^{
+			BOOL success = YES;
+			id value = [(id<MTLTransformerErrorHandling>)transformer transformedValue:@[ @5 ] success:&success error:NULL];
+
+			expect(value).to(beNil());
+			expect(@(success)).to(beFalsy());
+		});
+	});
+
+	describe(@"when transforming concurrently", ^{
+		__block NSMutableArray *numbers;
+		__block NSMutableArray *strings;
+
+		beforeEach(^{
+			NSValueTransformer *appliedTransformer = [MTLValueTransformer
+				transformerUsingForwardBlock:^ id (NSString *str, BOOL *success, NSError **error) {
+					if (![str isKindOfClass:NSString.class]) {
+						*success = NO;
+						return nil;
+					}
+
+					return @(str.integerValue);
+				}
+				reverseBlock:^(NSNumber *number, BOOL *success, NSError **error) {
+					return number.stringValue;
+				}];
+
+			transformer = [NSValueTransformer mtl_arrayMappingTransformerWithTransformer:appliedTransformer options:MTLArrayMappingOptionsConcurrent];
+			expect(transformer).notTo(beNil());
+
+			numbers = [NSMutableArray array];
+			strings = [NSMutableArray array];
+			for (NSInteger i = 0; i < 10000; i++) {
+				[numbers addObject:@(i)];
+				[strings addObject:@(i).stringValue];
+			}
+		});
+
+		it(@"should preserve the order of elements", ^{
+			expect([transformer transformedValue:strings]).to(equal(numbers));
+			expect([transformer reverseTransformedValue:numbers]).to(equal(strings));
+		});
+
+		it(@"should report the lowest failing index", ^{
+			strings[3000] = @3000;
+			strings[9000] = @9000;
+
+			BOOL success = YES;
+			NSError *error = nil;
+			id value = [(id<MTLTransformerErrorHandling>)transformer transformedValue:strings success:&success error:&error];
+
+			expect(value).to(beNil());
+			expect(@(success)).to(beFalsy());
+			expect(error.localizedFailureReason).to(equal(@"Could not transform value at index 3000"));
+		});
+	});
+
 	itBehavesLike(MTLTransformerErrorExamples, ^{
 		return @{
 			MTLTransformerErrorExamplesTransformer: transformer,
@@ -193,6 +426,70 @@ describe(@"value mapping transformer", ^{
 	});
 });
 
+describe(@"enum mapping transformer", ^{
+	__block NSValueTransformer<MTLTransformerErrorHandling> *transformer;
+
+	NSDictionary *dictionary = @{
+		@"negative": @(MTLPredefinedTransformerAdditionsSpecEnumNegative),
+		@"zero": @(MTLPredefinedTransformerAdditionsSpecEnumZero),
+		@"positive": @(MTLPredefinedTransformerAdditionsSpecEnumPositive),
+	};
+
+	beforeEach(^{
+		transformer = [NSValueTransformer mtl_enumMappingTransformerWithDictionary:dictionary defaultValue:MTLPredefinedTransformerAdditionsSpecEnumDefault reverseDefaultValue:@"default"];
+
+		expect(transformer).notTo(beNil());
+		expect(@([transformer.class allowsReverseTransformation])).to(beTruthy());
+	});
+
+	it(@"should transform strings into enum values", ^{
+		expect([transformer transformedValue:@"negative"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumNegative)));
+		expect([transformer transformedValue:@"zero"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumZero)));
+		expect([transformer transformedValue:@"positive"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumPositive)));
+	});
+
+	it(@"should transform enum values into strings", ^{
+		expect([transformer reverseTransformedValue:@(MTLPredefinedTransformerAdditionsSpecEnumNegative)]).to(equal(@"negative"));
+		expect([transformer reverseTransformedValue:@(MTLPredefinedTransformerAdditionsSpecEnumZero)]).to(equal(@"zero"));
+		expect([transformer reverseTransformedValue:@(MTLPredefinedTransformerAdditionsSpecEnumPositive)]).to(equal(@"positive"));
+	});
+
+	it(@"should fall back to the default values", ^{
+		expect([transformer transformedValue:@"unknown"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumDefault)));
+		expect([transformer transformedValue:@"zer"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumDefault)));
+		expect([transformer transformedValue:@"zéro"]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumDefault)));
+		expect([transformer transformedValue:NSNull.null]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumDefault)));
+		expect([transformer transformedValue:nil]).to(equal(@(MTLPredefinedTransformerAdditionsSpecEnumDefault)));
+
+		expect([transformer reverseTransformedValue:@(MTLPredefinedTransformerAdditionsSpecEnumDefault)]).to(equal(@"default"));
+		expect([transformer reverseTransformedValue:@0.5]).to(equal(@"default"));
+		expect([transformer reverseTransformedValue:nil]).to(equal(@"default"));
+	});
+
+	it(@"should map non-ASCII cases", ^{
+		transformer = [NSValueTransformer mtl_enumMappingTransformerWithDictionary:@{ @"zéro": @0, @"ünö": @1 } defaultValue:-1 reverseDefaultValue:nil];
+
+		expect([transformer transformedValue:@"zéro"]).to(equal(@0));
+		expect([transformer transformedValue:@"ünö"]).to(equal(@1));
+		expect([transformer reverseTransformedValue:@1]).to(equal(@"ünö"));
+		expect([transformer reverseTransformedValue:@2]).to(beNil());
+	});
+
+	it(@"should map every case of a large enum", ^{
+		NSMutableDictionary *cases = [NSMutableDictionary dictionary];
+		for (NSInteger i = 0; i < 500; i++) {
+			cases[[NSString stringWithFormat:@"case_%ld", (long)i]] = @(i * 3 - 700);
+		}
+
+		transformer = [NSValueTransformer mtl_enumMappingTransformerWithDictionary:cases defaultValue:NSIntegerMax reverseDefaultValue:nil];
+
+		[cases enumerateKeysAndObjectsUsingBlock:^(NSString *string, NSNumber *value, BOOL *stop) {
+			expect([transformer transformedValue:string]).to(equal(value));
+			expect([transformer reverseTransformedValue:value]).to(equal(string));
+		}];
+	});
+});
+
 describe(@"date format transformer", ^{
 	__block NSValueTransformer<MTLTransformerErrorHandling> *transformer;
 
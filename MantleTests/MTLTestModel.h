@@ -23,6 +23,10 @@ extern const NSInteger MTLTestModelNameMissing;
 // emulate a migration.
 + (void)setModelVersion:(NSUInteger)version;
 
+// Returns `count` models, initialized from the dictionaries returned by
+// `dictionaryAtIndex` for each index. Every dictionary must be valid.
++ (NSArray *)modelsWithCount:(NSUInteger)count dictionaryAtIndex:(NSDictionary * (^)(NSUInteger index))dictionaryAtIndex;
+
 // Must be less than 10 characters.
 //
 // This property is associated with a "username" key in JSON.
@@ -53,6 +57,18 @@ extern const NSInteger MTLTestModelNameMissing;
 
 @end
 
+// Tracks its dirty properties.
+@interface MTLDirtyTrackingTestModel : MTLTestModel
+@end
+
+// Tracks its dirty properties, and overrides +initialize without calling super.
+@interface MTLInitializingDirtyTrackingTestModel : MTLTestModel
+@end
+
+// Caches its JSON dictionary.
+@interface MTLCachingJSONTestModel : MTLTestModel
+@end
+
 @interface MTLArrayTestModel : MTLModel <MTLJSONSerializing>
 
 // This property is associated with a "users.username" key in JSON.
@@ -177,6 +193,42 @@ extern const NSInteger MTLTestModelNameMissing;
 
 @end
 
+// Dispatches to its subclasses based on the "shape.kind" JSON key path, and
+// through +classForParsingJSONDictionary: to MTLCircleShapeModel if a
+// "legacy_radius" key is present instead, or to MTLPolygonShapeModel if a
+// "legacy_sides" key is.
+@interface MTLShapeModel : MTLModel <MTLJSONSerializing>
+
+// Associated with the "name" JSON key.
+@property (readwrite, nonatomic, copy) NSString *name;
+
+@end
+
+@interface MTLCircleShapeModel : MTLShapeModel
+
+// Associated with the "radius" JSON key.
+@property (readwrite, nonatomic, assign) NSUInteger radius;
+
+@end
+
+@interface MTLSquareShapeModel : MTLShapeModel
+
+// Associated with the "side" JSON key.
+@property (readwrite, nonatomic, assign) NSUInteger side;
+
+@end
+
+// Dispatches to its subclasses based on the "polygon.kind" JSON key path.
+@interface MTLPolygonShapeModel : MTLShapeModel
+
+// Associated with the "sides" JSON key.
+@property (readwrite, nonatomic, assign) NSUInteger sides;
+
+@end
+
+@interface MTLTriangleShapeModel : MTLPolygonShapeModel
+@end
+
 
 @protocol MTLOptionalPropertyProtocol
 
@@ -213,3 +265,7 @@ extern const NSInteger MTLTestModelNameMissing;
 @property (readwrite, nonatomic, strong) NSString *property;
 
 @end
+
+// Caches its JSON dictionary.
+@interface MTLCachingPropertyDefaultAdapterModel : MTLPropertyDefaultAdapterModel
+@end
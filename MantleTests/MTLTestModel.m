@@ -49,6 +49,19 @@ static NSUInteger modelVersion = 1;
 
 #pragma mark Lifecycle
 
++ (NSArray *)modelsWithCount:(NSUInteger)count dictionaryAtIndex:(NSDictionary * (^)(NSUInteger index))dictionaryAtIndex {
+	NSMutableArray *models = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		NSError *error = nil;
+		MTLTestModel *model = [[self alloc] initWithDictionary:dictionaryAtIndex(i) error:&error];
+		NSAssert(model != nil, @"Could not create test model %lu: %@", (unsigned long)i, error);
+
+		[models addObject:model];
+	}
+
+	return models;
+}
+
 - (instancetype)init {
 	self = [super init];
 	if (self == nil) return nil;
@@ -140,6 +153,33 @@ static NSUInteger modelVersion = 1;
 @implementation MTLSubclassTestModel
 @end
 
+@implementation MTLDirtyTrackingTestModel
+
++ (BOOL)tracksDirtyPropertyKeys {
+	return YES;
+}
+
+@end
+
+@implementation MTLInitializingDirtyTrackingTestModel
+
++ (void)initialize {
+}
+
++ (BOOL)tracksDirtyPropertyKeys {
+	return YES;
+}
+
+@end
+
+@implementation MTLCachingJSONTestModel
+
++ (BOOL)cachesJSONDictionary {
+	return YES;
+}
+
+@end
+
 @implementation MTLArrayTestModel
 
 + (NSDictionary *)JSONKeyPathsByPropertyKey {
@@ -488,6 +528,81 @@ static NSUInteger modelVersion = 1;
 
 @end
 
+@implementation MTLShapeModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return @{
+		@"name": @"name"
+	};
+}
+
++ (NSString *)classDiscriminatorJSONKeyPath {
+	return @"shape.kind";
+}
+
++ (NSDictionary *)classesByDiscriminatorValue {
+	return @{
+		@"shape": MTLShapeModel.class,
+		@"circle": MTLCircleShapeModel.class,
+		@"square": MTLSquareShapeModel.class,
+		@"polygon": MTLPolygonShapeModel.class,
+		@4: MTLSquareShapeModel.class
+	};
+}
+
++ (Class)classForParsingJSONDictionary:(NSDictionary *)JSONDictionary {
+	if (JSONDictionary[@"legacy_radius"] != nil) return MTLCircleShapeModel.class;
+	if (JSONDictionary[@"legacy_sides"] != nil) return MTLPolygonShapeModel.class;
+
+	return nil;
+}
+
+@end
+
+@implementation MTLCircleShapeModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [[super JSONKeyPathsByPropertyKey] mtl_dictionaryByAddingEntriesFromDictionary:@{
+		@"radius": @"radius"
+	}];
+}
+
+@end
+
+@implementation MTLSquareShapeModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [[super JSONKeyPathsByPropertyKey] mtl_dictionaryByAddingEntriesFromDictionary:@{
+		@"side": @"side"
+	}];
+}
+
+@end
+
+@implementation MTLPolygonShapeModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+	return [[super JSONKeyPathsByPropertyKey] mtl_dictionaryByAddingEntriesFromDictionary:@{
+		@"sides": @"sides"
+	}];
+}
+
++ (NSString *)classDiscriminatorJSONKeyPath {
+	return @"polygon.kind";
+}
+
++ (NSDictionary *)classesByDiscriminatorValue {
+	return @{
+		@"polygon": MTLPolygonShapeModel.class,
+		@"triangle": MTLTriangleShapeModel.class
+	};
+}
+
+@end
+
+@implementation MTLTriangleShapeModel
+@end
+
 @implementation MTLOptionalPropertyModel
 
 @end
@@ -537,3 +652,11 @@ static NSUInteger modelVersion = 1;
 }
 
 @end
+
+@implementation MTLCachingPropertyDefaultAdapterModel
+
++ (BOOL)cachesJSONDictionary {
+	return YES;
+}
+
+@end